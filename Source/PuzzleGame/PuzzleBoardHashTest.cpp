@@ -0,0 +1,90 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "PuzzleZobristHash.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPuzzleBoardHashFuzzTest, "PuzzleGame.Board.ZobristHashFuzz",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FPuzzleBoardHashFuzzTest::RunTest(const FString& Parameters)
+{
+    const int32 NumCells = 12 * 12;
+
+    // Her tohum farklı yazım dizisi, boş board'dan başlar
+    for (int32 Seed = 1; Seed <= 4; Seed++)
+    {
+        TArray<int32> Occupancy;
+        Occupancy.Init(-1, NumCells);
+        TArray<int32> PieceCells;
+        PieceCells.Init(-1, NumCells);
+
+        FPuzzleZobristHash Hash;
+        auto SetCell = [&Occupancy, &PieceCells, &Hash](int32 GridID, int32 PieceID)
+        {
+            const int32 OldPieceID = Occupancy[GridID];
+            if (OldPieceID >= 0 && PieceCells[OldPieceID] == GridID)
+            {
+                PieceCells[OldPieceID] = -1;
+            }
+            Occupancy[GridID] = PieceID;
+            if (PieceID >= 0)
+            {
+                PieceCells[PieceID] = GridID;
+            }
+            Hash.OnCellChanged(GridID, OldPieceID, PieceID);
+        };
+
+        FRandomStream Stream(Seed);
+        for (int32 Iteration = 0; Iteration < 5000; Iteration++)
+        {
+            const int32 CellA = Stream.RandRange(0, NumCells - 1);
+            const int32 CellB = Stream.RandRange(0, NumCells - 1);
+            const int32 PieceID = Stream.RandRange(0, NumCells - 1);
+
+            // Oyundaki yazım dizileri: yerleştirme (eski hücre boşalır), takas ve boşaltma
+            switch (Stream.RandRange(0, 3))
+            {
+            case 0:
+                if (PieceCells[PieceID] >= 0 && PieceCells[PieceID] != CellA)
+                {
+                    SetCell(PieceCells[PieceID], -1);
+                }
+                SetCell(CellA, PieceID);
+                break;
+            case 1:
+            case 2:
+            {
+                const int32 PieceA = Occupancy[CellA];
+                SetCell(CellA, Occupancy[CellB]);
+                SetCell(CellB, PieceA);
+                break;
+            }
+            default:
+                SetCell(CellA, -1);
+                break;
+            }
+
+            const uint64 Expected = FPuzzleZobristHash::Compute(Occupancy);
+            if (Hash.Get() != Expected)
+            {
+                AddError(FString::Printf(TEXT("Seed %d, iteration %d: incremental hash %016llx != recomputed %016llx"),
+                    Seed, Iteration, Hash.Get(), Expected));
+                break;
+            }
+        }
+
+        // Board boşaltılınca hash sıfıra döner
+        for (int32 GridID = 0; GridID < NumCells; GridID++)
+        {
+            SetCell(GridID, -1);
+        }
+        TestEqual(FString::Printf(TEXT("Seed %d: cleared board hash"), Seed), Hash.Get(), (uint64)0);
+    }
+
+    return true;
+}
+
+#endif
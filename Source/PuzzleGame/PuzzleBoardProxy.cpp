@@ -0,0 +1,107 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "PuzzleBoardProxy.h"
+#include "Engine/StaticMesh.h"
+#include "UObject/ConstructorHelpers.h"
+
+APuzzleBoardProxy::APuzzleBoardProxy()
+{
+    PrimaryActorTick.bCanEverTick = false;
+
+    ChunkInstances = CreateDefaultSubobject<UInstancedStaticMeshComponent>(TEXT("ChunkInstances"));
+    RootComponent = ChunkInstances;
+
+    // Proxy'ler sadece görsel - collision ve gölge yok
+    ChunkInstances->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    ChunkInstances->SetCastShadow(false);
+    ChunkInstances->NumCustomDataFloats = 6;
+
+    static ConstructorHelpers::FObjectFinder<UStaticMesh> PlaneMeshFinder(TEXT("/Engine/BasicShapes/Plane"));
+    if (PlaneMeshFinder.Succeeded())
+    {
+        ChunkInstances->SetStaticMesh(PlaneMeshFinder.Object);
+    }
+
+    TextureParameterName = TEXT("BoardTexture");
+    ProxyMaterialInstance = nullptr;
+    bHasPendingUpdates = false;
+}
+
+void APuzzleBoardProxy::InitializeChunks(int32 InWidth, int32 InHeight, int32 ChunkSize, UMaterialInterface* ProxyMaterial, UTexture* BoardAtlas)
+{
+    ClearChunks();
+
+    if (InWidth <= 0 || InHeight <= 0 || ChunkSize <= 0)
+    {
+        return;
+    }
+
+    const int32 ChunksX = FMath::DivideAndRoundUp(InWidth, ChunkSize);
+    const int32 NumChunks = ChunksX * FMath::DivideAndRoundUp(InHeight, ChunkSize);
+
+    TArray<FTransform> Transforms;
+    Transforms.Init(FTransform(FQuat::Identity, FVector::ZeroVector, FVector::ZeroVector), NumChunks);
+    ChunkInstances->AddInstances(Transforms, false);
+
+    if (!ProxyMaterial)
+    {
+        return;
+    }
+    if (!BoardAtlas)
+    {
+        ChunkInstances->SetMaterial(0, ProxyMaterial);
+        return;
+    }
+
+    ProxyMaterialInstance = UMaterialInstanceDynamic::Create(ProxyMaterial, this);
+    ProxyMaterialInstance->SetTextureParameterValue(TextureParameterName, BoardAtlas);
+    ChunkInstances->SetMaterial(0, ProxyMaterialInstance);
+
+    // Atlas board düzeninde - chunk'ın hücre aralığı doğrudan UV dikdörtgeni, kenar chunk'ları daha dar
+    for (int32 ChunkIndex = 0; ChunkIndex < NumChunks; ChunkIndex++)
+    {
+        const int32 MinCol = (ChunkIndex % ChunksX) * ChunkSize;
+        const int32 MinRow = (ChunkIndex / ChunksX) * ChunkSize;
+        const int32 Cols = FMath::Min(ChunkSize, InWidth - MinCol);
+        const int32 Rows = FMath::Min(ChunkSize, InHeight - MinRow);
+
+        ChunkInstances->SetCustomDataValue(ChunkIndex, 2, (float)MinCol / InWidth, false);
+        ChunkInstances->SetCustomDataValue(ChunkIndex, 3, (float)MinRow / InHeight, false);
+        ChunkInstances->SetCustomDataValue(ChunkIndex, 4, (float)Cols / InWidth, false);
+        ChunkInstances->SetCustomDataValue(ChunkIndex, 5, (float)Rows / InHeight, false);
+    }
+    bHasPendingUpdates = true;
+}
+
+void APuzzleBoardProxy::ClearChunks()
+{
+    ChunkInstances->ClearInstances();
+    ProxyMaterialInstance = nullptr;
+    bHasPendingUpdates = false;
+}
+
+void APuzzleBoardProxy::UpdateChunk(int32 ChunkIndex, bool bVisible, const FVector& Center, const FVector2D& Size,
+    float OccupiedFraction, float CorrectFraction)
+{
+    if (ChunkIndex < 0 || ChunkIndex >= ChunkInstances->GetInstanceCount())
+    {
+        return;
+    }
+
+    // Engine plane 100x100 birim
+    const FVector Scale = bVisible ? FVector(Size.X / 100.0f, Size.Y / 100.0f, 1.0f) : FVector::ZeroVector;
+    ChunkInstances->UpdateInstanceTransform(ChunkIndex, FTransform(FQuat::Identity, Center, Scale), true, false, true);
+    ChunkInstances->SetCustomDataValue(ChunkIndex, 0, OccupiedFraction, false);
+    ChunkInstances->SetCustomDataValue(ChunkIndex, 1, CorrectFraction, false);
+
+    bHasPendingUpdates = true;
+}
+
+void APuzzleBoardProxy::FlushChunkUpdates()
+{
+    if (bHasPendingUpdates)
+    {
+        ChunkInstances->MarkRenderStateDirty();
+        bHasPendingUpdates = false;
+    }
+}
@@ -0,0 +1,51 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "PuzzleBoardProxy.generated.h"
+
+/**
+ * Low-cost stand-in for board chunks that are not materialized as piece actors.
+ * One instanced quad per chunk. The quads sample the board tile atlas baked by
+ * APuzzleBoardTiles; per-instance custom data carries the chunk's occupied and
+ * correct fractions (0, 1) and its atlas UV offset (2, 3) and scale (4, 5).
+ */
+UCLASS()
+class PUZZLEGAME_API APuzzleBoardProxy : public AActor
+{
+    GENERATED_BODY()
+
+public:
+    APuzzleBoardProxy();
+
+    // Chunk başına bir instance oluştur - BoardAtlas board düzeninde tile texture'ı,
+    // yoksa proxy'ler sadece custom data ile boyanır (UV ölçeği 0)
+    void InitializeChunks(int32 InWidth, int32 InHeight, int32 ChunkSize, UMaterialInterface* ProxyMaterial, UTexture* BoardAtlas);
+
+    void ClearChunks();
+
+    // Chunk görünür değilse instance sıfır ölçeklenir
+    void UpdateChunk(int32 ChunkIndex, bool bVisible, const FVector& Center, const FVector2D& Size,
+        float OccupiedFraction, float CorrectFraction);
+
+    // Tüm UpdateChunk çağrılarından sonra bir kez çağrılır
+    void FlushChunkUpdates();
+
+protected:
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+    UInstancedStaticMeshComponent* ChunkInstances;
+
+    // Proxy materyalindeki atlas texture parametresi
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Proxy")
+    FName TextureParameterName;
+
+    UPROPERTY()
+    UMaterialInstanceDynamic* ProxyMaterialInstance;
+
+private:
+    bool bHasPendingUpdates;
+};
@@ -0,0 +1,137 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "PuzzleBoardSnapshot.h"
+
+void FPuzzleBoardSnapshot::CopyOccupancy(TArray<int32>& OutOccupancy) const
+{
+    OutOccupancy.SetNumUninitialized(NumCells);
+    for (int32 ChunkIndex = 0; ChunkIndex < Chunks.Num(); ChunkIndex++)
+    {
+        const TArray<int32>& Chunk = *Chunks[ChunkIndex];
+        FMemory::Memcpy(OutOccupancy.GetData() + ChunkIndex * ChunkCells, Chunk.GetData(), Chunk.Num() * sizeof(int32));
+    }
+}
+
+FPuzzleSnapshotPublisher::~FPuzzleSnapshotPublisher()
+{
+    // Sahibi yok edilirken okuyucu kalmamalı
+    Retired.Add(Current.exchange(nullptr));
+    for (FPuzzleBoardSnapshot* Snapshot : Retired)
+    {
+        if (Snapshot)
+        {
+            ensureMsgf(Snapshot->PinCount.load() == 0, TEXT("Board snapshot %llu still pinned at shutdown"), Snapshot->Version);
+            delete Snapshot;
+        }
+    }
+    Retired.Reset();
+}
+
+FPuzzleBoardSnapshot::FChunk FPuzzleSnapshotPublisher::CopyChunk(int32 ChunkIndex, const TArray<int32>& Occupancy, int32 NumCells) const
+{
+    const int32 Start = ChunkIndex * FPuzzleBoardSnapshot::ChunkCells;
+    const int32 Count = FMath::Min(FPuzzleBoardSnapshot::ChunkCells, NumCells - Start);
+    return MakeShared<TArray<int32>, ESPMode::ThreadSafe>(Occupancy.GetData() + Start, Count);
+}
+
+void FPuzzleSnapshotPublisher::Init(int32 InWidth, int32 InHeight, const TArray<int32>& Occupancy, int32 CorrectCellCount, uint64 BoardHash)
+{
+    FPuzzleBoardSnapshot* Snapshot = new FPuzzleBoardSnapshot();
+    Snapshot->Version = ++PublishedVersion;
+    Snapshot->Width = InWidth;
+    Snapshot->Height = InHeight;
+    Snapshot->NumCells = Occupancy.Num();
+    Snapshot->CorrectCellCount = CorrectCellCount;
+    Snapshot->BoardHash = BoardHash;
+
+    const int32 NumChunks = FMath::DivideAndRoundUp(Occupancy.Num(), FPuzzleBoardSnapshot::ChunkCells);
+    Snapshot->Chunks.Reserve(NumChunks);
+    for (int32 ChunkIndex = 0; ChunkIndex < NumChunks; ChunkIndex++)
+    {
+        Snapshot->Chunks.Add(CopyChunk(ChunkIndex, Occupancy, Occupancy.Num()));
+    }
+
+    DirtyChunks.Init(false, NumChunks);
+    DirtyChunkList.Reset();
+
+    Swap(Snapshot);
+}
+
+void FPuzzleSnapshotPublisher::Publish(TArrayView<const int32> ChangedGridIDs, const TArray<int32>& Occupancy, int32 CorrectCellCount, uint64 BoardHash)
+{
+    const FPuzzleBoardSnapshot* Previous = Current.load(std::memory_order_relaxed);
+    if (!Previous || Previous->NumCells != Occupancy.Num())
+    {
+        return;
+    }
+
+    for (const int32 GridID : ChangedGridIDs)
+    {
+        const int32 ChunkIndex = GridID >> FPuzzleBoardSnapshot::ChunkShift;
+        if (!DirtyChunks[ChunkIndex])
+        {
+            DirtyChunks[ChunkIndex] = true;
+            DirtyChunkList.Add(ChunkIndex);
+        }
+    }
+
+    // Değişmeyen chunk'lar önceki snapshot ile paylaşılır
+    FPuzzleBoardSnapshot* Snapshot = new FPuzzleBoardSnapshot();
+    Snapshot->Version = ++PublishedVersion;
+    Snapshot->Width = Previous->Width;
+    Snapshot->Height = Previous->Height;
+    Snapshot->NumCells = Previous->NumCells;
+    Snapshot->CorrectCellCount = CorrectCellCount;
+    Snapshot->BoardHash = BoardHash;
+    Snapshot->Chunks = Previous->Chunks;
+
+    for (const int32 ChunkIndex : DirtyChunkList)
+    {
+        Snapshot->Chunks[ChunkIndex] = CopyChunk(ChunkIndex, Occupancy, Occupancy.Num());
+        DirtyChunks[ChunkIndex] = false;
+    }
+    DirtyChunkList.Reset();
+
+    Swap(Snapshot);
+}
+
+void FPuzzleSnapshotPublisher::Swap(FPuzzleBoardSnapshot* NewSnapshot)
+{
+    FPuzzleBoardSnapshot* Old = Current.exchange(NewSnapshot, std::memory_order_seq_cst);
+    if (Old)
+    {
+        Retired.Add(Old);
+    }
+    Reclaim();
+}
+
+void FPuzzleSnapshotPublisher::Reclaim()
+{
+    // Swap'tan sonra hâlâ Acquire içinde olan okuyucu eski pointer'ı pinlemek üzere olabilir
+    if (ActiveAcquires.load(std::memory_order_seq_cst) != 0)
+    {
+        return;
+    }
+
+    for (int32 Index = Retired.Num() - 1; Index >= 0; Index--)
+    {
+        if (Retired[Index]->PinCount.load(std::memory_order_acquire) == 0)
+        {
+            delete Retired[Index];
+            Retired.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+        }
+    }
+}
+
+FPuzzleBoardSnapshotRef FPuzzleSnapshotPublisher::Acquire() const
+{
+    ActiveAcquires.fetch_add(1, std::memory_order_seq_cst);
+    const FPuzzleBoardSnapshot* Snapshot = Current.load(std::memory_order_seq_cst);
+    if (Snapshot)
+    {
+        Snapshot->PinCount.fetch_add(1, std::memory_order_acquire);
+    }
+    ActiveAcquires.fetch_sub(1, std::memory_order_seq_cst);
+
+    return FPuzzleBoardSnapshotRef(Snapshot);
+}
@@ -0,0 +1,152 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+/**
+ * Immutable copy of the board occupancy at one version. Cells are stored in fixed-size
+ * chunks shared between consecutive snapshots, so a publish only copies the chunks that
+ * contain changed cells. Safe to read from any thread while a FPuzzleBoardSnapshotRef
+ * keeps it pinned.
+ */
+class PUZZLEGAME_API FPuzzleBoardSnapshot
+{
+public:
+    // 4096 hücre = 16KB - değişen her chunk publish'te bir kez kopyalanır
+    static constexpr int32 ChunkShift = 12;
+    static constexpr int32 ChunkCells = 1 << ChunkShift;
+
+    uint64 GetVersion() const { return Version; }
+    int32 GetWidth() const { return Width; }
+    int32 GetHeight() const { return Height; }
+    int32 GetNumCells() const { return NumCells; }
+    int32 GetCorrectCellCount() const { return CorrectCellCount; }
+    bool IsComplete() const { return NumCells > 0 && CorrectCellCount == NumCells; }
+
+    // Dizilimin Zobrist hash'i - iki snapshot'ı hücre hücre karşılaştırmadan ayırt eder
+    uint64 GetBoardHash() const { return BoardHash; }
+
+    // GridID -> PieceID (-1 boş)
+    int32 GetOccupant(int32 GridID) const
+    {
+        return (*Chunks[GridID >> ChunkShift])[GridID & (ChunkCells - 1)];
+    }
+
+    // Tüm board'u düz diziye kopyala (worker thread'de kullanım için)
+    void CopyOccupancy(TArray<int32>& OutOccupancy) const;
+
+private:
+    friend class FPuzzleSnapshotPublisher;
+    friend class FPuzzleBoardSnapshotRef;
+
+    using FChunk = TSharedPtr<const TArray<int32>, ESPMode::ThreadSafe>;
+
+    uint64 Version = 0;
+    int32 Width = 0;
+    int32 Height = 0;
+    int32 NumCells = 0;
+    int32 CorrectCellCount = 0;
+    uint64 BoardHash = 0;
+    TArray<FChunk> Chunks;
+
+    // Okuyucu pin sayısı - sıfır olmadan game thread silmez
+    mutable std::atomic<int32> PinCount{ 0 };
+};
+
+// Bir snapshot'ı okunduğu sürece canlı tutar, herhangi bir thread'de bırakılabilir
+class PUZZLEGAME_API FPuzzleBoardSnapshotRef
+{
+public:
+    FPuzzleBoardSnapshotRef() = default;
+    ~FPuzzleBoardSnapshotRef() { Release(); }
+
+    FPuzzleBoardSnapshotRef(FPuzzleBoardSnapshotRef&& Other)
+        : Snapshot(Other.Snapshot)
+    {
+        Other.Snapshot = nullptr;
+    }
+
+    FPuzzleBoardSnapshotRef& operator=(FPuzzleBoardSnapshotRef&& Other)
+    {
+        if (this != &Other)
+        {
+            Release();
+            Snapshot = Other.Snapshot;
+            Other.Snapshot = nullptr;
+        }
+        return *this;
+    }
+
+    FPuzzleBoardSnapshotRef(const FPuzzleBoardSnapshotRef&) = delete;
+    FPuzzleBoardSnapshotRef& operator=(const FPuzzleBoardSnapshotRef&) = delete;
+
+    bool IsValid() const { return Snapshot != nullptr; }
+    const FPuzzleBoardSnapshot* operator->() const { return Snapshot; }
+    const FPuzzleBoardSnapshot& operator*() const { return *Snapshot; }
+
+    void Release()
+    {
+        if (Snapshot)
+        {
+            Snapshot->PinCount.fetch_sub(1, std::memory_order_release);
+            Snapshot = nullptr;
+        }
+    }
+
+private:
+    friend class FPuzzleSnapshotPublisher;
+
+    explicit FPuzzleBoardSnapshotRef(const FPuzzleBoardSnapshot* InSnapshot)
+        : Snapshot(InSnapshot)
+    {
+    }
+
+    const FPuzzleBoardSnapshot* Snapshot = nullptr;
+};
+
+/**
+ * Publishes board snapshots from the game thread through an atomic pointer (RCU style).
+ * Readers never take a lock: Acquire pins the current snapshot and returns. Superseded
+ * snapshots are retired and freed on a later publish once no reader pins them and no
+ * Acquire is in flight.
+ */
+class PUZZLEGAME_API FPuzzleSnapshotPublisher
+{
+public:
+    ~FPuzzleSnapshotPublisher();
+
+    // Board boyutu değiştiğinde tam snapshot yayınla - O(N)
+    void Init(int32 InWidth, int32 InHeight, const TArray<int32>& Occupancy, int32 CorrectCellCount, uint64 BoardHash);
+
+    // Sadece değişen hücrelerin chunk'larını kopyalar - game thread
+    void Publish(TArrayView<const int32> ChangedGridIDs, const TArray<int32>& Occupancy, int32 CorrectCellCount, uint64 BoardHash);
+
+    // Herhangi bir thread'den çağrılabilir, kilitsiz
+    FPuzzleBoardSnapshotRef Acquire() const;
+
+    uint64 GetPublishedVersion() const { return PublishedVersion; }
+    int32 GetRetiredCount() const { return Retired.Num(); }
+
+private:
+    FPuzzleBoardSnapshot::FChunk CopyChunk(int32 ChunkIndex, const TArray<int32>& Occupancy, int32 NumCells) const;
+
+    void Swap(FPuzzleBoardSnapshot* NewSnapshot);
+
+    // Pinlenmemiş eski snapshot'ları sil
+    void Reclaim();
+
+    std::atomic<FPuzzleBoardSnapshot*> Current{ nullptr };
+
+    // Acquire'ın pointer okuma ile pin arasındaki penceresi
+    mutable std::atomic<int32> ActiveAcquires{ 0 };
+
+    TArray<FPuzzleBoardSnapshot*> Retired;
+
+    // Publish başına tekrar kullanılan dirty chunk bayrakları
+    TBitArray<> DirtyChunks;
+    TArray<int32> DirtyChunkList;
+
+    uint64 PublishedVersion = 0;
+};
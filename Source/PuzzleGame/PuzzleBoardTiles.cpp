@@ -0,0 +1,163 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "PuzzleBoardTiles.h"
+#include "Engine/Canvas.h"
+#include "Engine/StaticMesh.h"
+#include "UObject/ConstructorHelpers.h"
+
+APuzzleBoardTiles::APuzzleBoardTiles()
+{
+    PrimaryActorTick.bCanEverTick = false;
+
+    TileQuad = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("TileQuad"));
+    RootComponent = TileQuad;
+
+    // Tile'lar sadece görsel - collision ve gölge yok
+    TileQuad->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    TileQuad->SetCastShadow(false);
+    TileQuad->SetReceivesDecals(false);
+
+    static ConstructorHelpers::FObjectFinder<UStaticMesh> PlaneMeshFinder(TEXT("/Engine/BasicShapes/Plane"));
+    if (PlaneMeshFinder.Succeeded())
+    {
+        TileQuad->SetStaticMesh(PlaneMeshFinder.Object);
+    }
+
+    EmptyCellColor = FLinearColor(0.05f, 0.05f, 0.05f, 1.0f);
+    TextureParameterName = TEXT("BoardTexture");
+
+    TileTarget = nullptr;
+    TileMaterialInstance = nullptr;
+    Width = 0;
+    Height = 0;
+    TexelsPerCell = 0;
+    BakeCanvas = nullptr;
+}
+
+bool APuzzleBoardTiles::InitializeTiles(int32 InWidth, int32 InHeight, const FVector2D& CellAreaMin, const FVector2D& CellAreaMax,
+    UMaterialInterface* TileMaterial, int32 MaxTextureSize)
+{
+    ClearTiles();
+
+    if (InWidth <= 0 || InHeight <= 0)
+    {
+        return false;
+    }
+
+    // Texture boyutu sınırlı - büyük board'larda hücre başına texel azalır, bir texel'in altına inilmez
+    const int32 MaxTexelsPerCell = MaxTextureSize / FMath::Max(InWidth, InHeight);
+    if (MaxTexelsPerCell < 1)
+    {
+        return false;
+    }
+
+    Width = InWidth;
+    Height = InHeight;
+    TexelsPerCell = FMath::Min(MaxTexelsPerCell, 32);
+
+    TileTarget = UKismetRenderingLibrary::CreateRenderTarget2D(this, Width * TexelsPerCell, Height * TexelsPerCell, RTF_RGBA8);
+    if (!TileTarget)
+    {
+        Width = 0;
+        Height = 0;
+        TexelsPerCell = 0;
+        return false;
+    }
+    UKismetRenderingLibrary::ClearRenderTarget2D(this, TileTarget, EmptyCellColor);
+
+    if (!TileMaterial)
+    {
+        return true;
+    }
+
+    TileMaterialInstance = UMaterialInstanceDynamic::Create(TileMaterial, this);
+    TileMaterialInstance->SetTextureParameterValue(TextureParameterName, TileTarget);
+    TileQuad->SetMaterial(0, TileMaterialInstance);
+
+    // Engine plane 100x100 birim, parçaların hemen altında dur
+    const FVector2D Center = (CellAreaMin + CellAreaMax) * 0.5f;
+    const FVector2D Size = CellAreaMax - CellAreaMin;
+    SetActorLocation(FVector(Center.X, Center.Y, -5.0f));
+    SetActorScale3D(FVector(Size.X / 100.0f, Size.Y / 100.0f, 1.0f));
+    return true;
+}
+
+void APuzzleBoardTiles::ClearTiles()
+{
+    EndBake();
+
+    if (TileTarget)
+    {
+        TileTarget->ReleaseResource();
+    }
+    TileTarget = nullptr;
+    TileMaterialInstance = nullptr;
+    Width = 0;
+    Height = 0;
+    TexelsPerCell = 0;
+
+    SetTilesVisible(false);
+}
+
+bool APuzzleBoardTiles::BeginBake()
+{
+    if (!TileTarget)
+    {
+        return false;
+    }
+    if (BakeCanvas)
+    {
+        return true;
+    }
+
+    FVector2D CanvasSize;
+    UKismetRenderingLibrary::BeginDrawCanvasToRenderTarget(this, TileTarget, BakeCanvas, CanvasSize, BakeContext);
+    return BakeCanvas != nullptr;
+}
+
+void APuzzleBoardTiles::BakeRegion(int32 MinCol, int32 MinRow, int32 MaxCol, int32 MaxRow,
+    const TArray<int32>& GridOccupancy, const TArray<UMaterialInterface*>& PieceMaterials, float MaterialMargin)
+{
+    if (!BakeCanvas)
+    {
+        return;
+    }
+
+    const FVector2D CellSize(TexelsPerCell, TexelsPerCell);
+    const float CoordinateSize = 1.0f / (1.0f + 2.0f * MaterialMargin);
+
+    for (int32 Row = MinRow; Row <= MaxRow; Row++)
+    {
+        for (int32 Col = MinCol; Col <= MaxCol; Col++)
+        {
+            const FVector2D CellPosition(Col * TexelsPerCell, Row * TexelsPerCell);
+            const int32 PieceID = GridOccupancy[Row * Width + Col];
+
+            // Parçanın kendi materyali hücreye çizilir, boş hücre düz renk
+            if (PieceMaterials.IsValidIndex(PieceID) && PieceMaterials[PieceID])
+            {
+                BakeCanvas->K2_DrawMaterial(PieceMaterials[PieceID], CellPosition, CellSize,
+                    FVector2D(MaterialMargin * CoordinateSize), FVector2D(CoordinateSize));
+            }
+            else
+            {
+                BakeCanvas->K2_DrawTexture(nullptr, CellPosition, CellSize, FVector2D::ZeroVector, FVector2D::UnitVector,
+                    EmptyCellColor, BLEND_Opaque);
+            }
+        }
+    }
+}
+
+void APuzzleBoardTiles::EndBake()
+{
+    if (BakeCanvas)
+    {
+        UKismetRenderingLibrary::EndDrawCanvasToRenderTarget(this, BakeContext);
+        BakeCanvas = nullptr;
+    }
+}
+
+void APuzzleBoardTiles::SetTilesVisible(bool bVisible)
+{
+    TileQuad->SetVisibility(bVisible && TileMaterialInstance != nullptr);
+}
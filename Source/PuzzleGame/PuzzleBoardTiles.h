@@ -0,0 +1,79 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "Components/StaticMeshComponent.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "Engine/TextureRenderTarget2D.h"
+#include "Kismet/KismetRenderingLibrary.h"
+#include "PuzzleBoardTiles.generated.h"
+
+class UCanvas;
+
+/**
+ * Zoomed-out LOD for large boards. The whole board is one quad whose texture is a
+ * render target split into region tiles; each tile is re-baked from the piece
+ * materials only when a cell inside it changes. The same render target is the atlas
+ * the chunk proxies sample, so it can be set up without a quad material.
+ */
+UCLASS()
+class PUZZLEGAME_API APuzzleBoardTiles : public AActor
+{
+    GENERATED_BODY()
+
+public:
+    APuzzleBoardTiles();
+
+    // Board hücre alanını kaplayan quad'ı ve tile texture'ını hazırla - TileMaterial yoksa sadece texture
+    // Hücre başına bir texel bile MaxTextureSize'a sığmıyorsa false - tile'lar kurulmaz
+    bool InitializeTiles(int32 InWidth, int32 InHeight, const FVector2D& CellAreaMin, const FVector2D& CellAreaMax,
+        UMaterialInterface* TileMaterial, int32 MaxTextureSize);
+
+    void ClearTiles();
+
+    // Bake'ler tek bir canvas oturumunda toplanır
+    bool BeginBake();
+    // MaterialMargin: parça materyalinin hücre dışında kalan payı - sadece hücre kısmı çizilir
+    void BakeRegion(int32 MinCol, int32 MinRow, int32 MaxCol, int32 MaxRow,
+        const TArray<int32>& GridOccupancy, const TArray<UMaterialInterface*>& PieceMaterials, float MaterialMargin = 0.0f);
+    void EndBake();
+
+    void SetTilesVisible(bool bVisible);
+
+    bool IsInitialized() const { return TileTarget != nullptr; }
+
+    // Quad çizilebilir mi - yoksa texture sadece chunk proxy atlas'ı
+    bool HasTileQuad() const { return TileMaterialInstance != nullptr; }
+
+    UTextureRenderTarget2D* GetTileTexture() const { return TileTarget; }
+
+    int32 GetTexelsPerCell() const { return TexelsPerCell; }
+
+protected:
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+    UStaticMeshComponent* TileQuad;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tiles")
+    FLinearColor EmptyCellColor;
+
+    // Tile materyalindeki texture parametresi
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tiles")
+    FName TextureParameterName;
+
+    UPROPERTY()
+    UTextureRenderTarget2D* TileTarget;
+
+    UPROPERTY()
+    UMaterialInstanceDynamic* TileMaterialInstance;
+
+private:
+    int32 Width;
+    int32 Height;
+    int32 TexelsPerCell;
+
+    // Açık bake oturumu
+    UCanvas* BakeCanvas;
+    FDrawToRenderTargetContext BakeContext;
+};
@@ -0,0 +1,70 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "PuzzleBoardTransaction.h"
+
+bool FPuzzleBoardTransaction::BuildGroupTranslation(int32 Width, int32 Height, const TArray<int32>& Occupancy,
+    TArrayView<const int32> SourceGridIDs, int32 DeltaCol, int32 DeltaRow, FPuzzleBoardTransaction& OutTransaction)
+{
+    OutTransaction.CellWrites.Reset();
+
+    if (Width <= 0 || Height <= 0 || Occupancy.Num() != Width * Height || SourceGridIDs.Num() == 0)
+    {
+        return false;
+    }
+
+    if (DeltaCol == 0 && DeltaRow == 0)
+    {
+        return false;
+    }
+
+    const int32 Delta = DeltaRow * Width + DeltaCol;
+
+    TSet<int32> Sources;
+    TSet<int32> Targets;
+    Sources.Reserve(SourceGridIDs.Num());
+    Targets.Reserve(SourceGridIDs.Num());
+
+    for (int32 GridID : SourceGridIDs)
+    {
+        if (!Occupancy.IsValidIndex(GridID) || Occupancy[GridID] < 0)
+        {
+            return false;
+        }
+
+        const int32 TargetCol = GridID % Width + DeltaCol;
+        const int32 TargetRow = GridID / Width + DeltaRow;
+        if (TargetCol < 0 || TargetCol >= Width || TargetRow < 0 || TargetRow >= Height)
+        {
+            return false;
+        }
+
+        Sources.Add(GridID);
+        Targets.Add(GridID + Delta);
+    }
+
+    OutTransaction.CellWrites.Reserve(Targets.Num() * 2);
+
+    for (int32 Target : Targets)
+    {
+        // Grup parçaları hedeflerine
+        OutTransaction.CellWrites.Add({ Target, Occupancy[Target - Delta] });
+
+        if (!Sources.Contains(Target))
+        {
+            // Yerinden edilen içerik, zincir boyunca geriye kayarak boşalan hücreye gider
+            int32 Vacated = Target - Delta;
+            while (Targets.Contains(Vacated))
+            {
+                Vacated -= Delta;
+            }
+            OutTransaction.CellWrites.Add({ Vacated, Occupancy[Target] });
+        }
+    }
+
+    OutTransaction.CellWrites.Sort([](const FPuzzleCellWrite& A, const FPuzzleCellWrite& B)
+    {
+        return A.GridID < B.GridID;
+    });
+
+    return true;
+}
@@ -0,0 +1,33 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Tek bir hücreye yazılacak yeni içerik
+struct FPuzzleCellWrite
+{
+    int32 GridID;
+    int32 PieceID; // -1 boş
+};
+
+/**
+ * A batch of occupancy writes that is committed in one pass. Shared by the game mode
+ * and the headless replay simulator so that both resolve group moves identically.
+ */
+struct PUZZLEGAME_API FPuzzleBoardTransaction
+{
+    // GridID'ye göre sıralı
+    TArray<FPuzzleCellWrite> CellWrites;
+
+    bool IsEmpty() const { return CellWrites.Num() == 0; }
+
+    /**
+     * Translates the pieces in SourceGridIDs by (DeltaCol, DeltaRow). Pieces that are
+     * displaced by the group slide back along the move direction into the cells the
+     * group vacated, so conflicts always resolve the same way.
+     * Fails if a source cell is empty or a target falls outside the board.
+     */
+    static bool BuildGroupTranslation(int32 Width, int32 Height, const TArray<int32>& Occupancy,
+        TArrayView<const int32> SourceGridIDs, int32 DeltaCol, int32 DeltaRow, FPuzzleBoardTransaction& OutTransaction);
+};
@@ -0,0 +1,171 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/Texture2D.h"
+#include "UObject/StrongObjectPtr.h"
+
+/**
+ * One texel per board cell, kept in a CPU mirror and uploaded with batched
+ * UpdateTextureRegions calls. Only texels written since the last Flush are sent;
+ * consecutive dirty texels on a row are merged into a single region.
+ */
+template<typename TexelType>
+class TPuzzleCellTexture
+{
+public:
+    // Bu oranın üzerinde kirli texel varsa tüm texture tek bölge olarak gönderilir
+    static constexpr float FullUploadFraction = 0.25f;
+
+    bool Initialize(int32 InWidth, int32 InHeight, EPixelFormat Format, const TexelType& ClearValue)
+    {
+        Reset();
+
+        if (InWidth <= 0 || InHeight <= 0 || GPixelFormats[Format].BlockBytes != sizeof(TexelType))
+        {
+            return false;
+        }
+
+        UTexture2D* NewTexture = UTexture2D::CreateTransient(InWidth, InHeight, Format);
+        if (!NewTexture)
+        {
+            return false;
+        }
+
+        // Hücre verisi - filtreleme ve sRGB dönüşümü olmamalı
+        NewTexture->Filter = TF_Nearest;
+        NewTexture->SRGB = false;
+        NewTexture->NeverStream = true;
+        NewTexture->UpdateResource();
+
+        Texture.Reset(NewTexture);
+        Width = InWidth;
+        Height = InHeight;
+        Texels.Init(ClearValue, Width * Height);
+        DirtyFlags.Init(false, Width * Height);
+        bFullUploadPending = true;
+        return true;
+    }
+
+    void Reset()
+    {
+        Texture.Reset();
+        Texels.Empty();
+        DirtyFlags.Empty();
+        DirtyTexels.Empty();
+        Width = 0;
+        Height = 0;
+        bFullUploadPending = false;
+    }
+
+    bool IsValid() const { return Texture.IsValid(); }
+
+    UTexture2D* GetTexture() const { return Texture.Get(); }
+
+    int32 GetWidth() const { return Width; }
+    int32 GetHeight() const { return Height; }
+
+    const TexelType& GetTexel(int32 Index) const { return Texels[Index]; }
+
+    void SetTexel(int32 Index, const TexelType& Value)
+    {
+        if (!Texels.IsValidIndex(Index) || FMemory::Memcmp(&Texels[Index], &Value, sizeof(TexelType)) == 0)
+        {
+            return;
+        }
+
+        Texels[Index] = Value;
+        if (!DirtyFlags[Index])
+        {
+            DirtyFlags[Index] = true;
+            DirtyTexels.Add(Index);
+        }
+    }
+
+    // Kirli texel'leri tek bir render komutunda gönderir, gönderilen bölge sayısını döner
+    int32 Flush()
+    {
+        if (!Texture.IsValid() || (!bFullUploadPending && DirtyTexels.Num() == 0))
+        {
+            return 0;
+        }
+
+        if (bFullUploadPending || DirtyTexels.Num() > Texels.Num() * FullUploadFraction)
+        {
+            return FlushFull();
+        }
+
+        DirtyTexels.Sort();
+
+        // Satır içi ardışık texel'leri tek bölgede birleştir
+        TArray<FUpdateTextureRegion2D> Runs;
+        int32 RunStart = 0;
+        for (int32 i = 1; i <= DirtyTexels.Num(); i++)
+        {
+            const bool bBreak = i == DirtyTexels.Num() ||
+                DirtyTexels[i] != DirtyTexels[i - 1] + 1 ||
+                DirtyTexels[i] % Width == 0;
+            if (bBreak)
+            {
+                const int32 First = DirtyTexels[RunStart];
+                Runs.Add(FUpdateTextureRegion2D(First % Width, First / Width, RunStart, 0, i - RunStart, 1));
+                RunStart = i;
+            }
+        }
+
+        // Kaynak tek satırlık paket buffer, render thread'de serbest bırakılır
+        const int32 NumTexels = DirtyTexels.Num();
+        TexelType* PackedData = (TexelType*)FMemory::Malloc(NumTexels * sizeof(TexelType));
+        for (int32 i = 0; i < NumTexels; i++)
+        {
+            PackedData[i] = Texels[DirtyTexels[i]];
+            DirtyFlags[DirtyTexels[i]] = false;
+        }
+        DirtyTexels.Reset();
+
+        return SubmitRegions(Runs, (uint8*)PackedData, NumTexels * sizeof(TexelType));
+    }
+
+private:
+    int32 FlushFull()
+    {
+        TexelType* FullData = (TexelType*)FMemory::Malloc(Texels.Num() * sizeof(TexelType));
+        FMemory::Memcpy(FullData, Texels.GetData(), Texels.Num() * sizeof(TexelType));
+
+        for (const int32 Index : DirtyTexels)
+        {
+            DirtyFlags[Index] = false;
+        }
+        DirtyTexels.Reset();
+        bFullUploadPending = false;
+
+        TArray<FUpdateTextureRegion2D> FullRegion;
+        FullRegion.Add(FUpdateTextureRegion2D(0, 0, 0, 0, Width, Height));
+        return SubmitRegions(FullRegion, (uint8*)FullData, Width * sizeof(TexelType));
+    }
+
+    int32 SubmitRegions(const TArray<FUpdateTextureRegion2D>& InRegions, uint8* SrcData, uint32 SrcPitch)
+    {
+        const int32 NumRegions = InRegions.Num();
+        FUpdateTextureRegion2D* Regions = new FUpdateTextureRegion2D[NumRegions];
+        FMemory::Memcpy(Regions, InRegions.GetData(), NumRegions * sizeof(FUpdateTextureRegion2D));
+
+        Texture->UpdateTextureRegions(0, NumRegions, Regions, SrcPitch, sizeof(TexelType), SrcData,
+            [](uint8* Data, const FUpdateTextureRegion2D* UsedRegions)
+            {
+                FMemory::Free(Data);
+                delete[] UsedRegions;
+            });
+
+        return NumRegions;
+    }
+
+    TStrongObjectPtr<UTexture2D> Texture;
+    TArray<TexelType> Texels;
+    TBitArray<> DirtyFlags;
+    TArray<int32> DirtyTexels;
+    int32 Width = 0;
+    int32 Height = 0;
+    bool bFullUploadPending = false;
+};
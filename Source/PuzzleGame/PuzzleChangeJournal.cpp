@@ -0,0 +1,45 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "PuzzleChangeJournal.h"
+
+void FPuzzleChangeJournal::Init(int32 NumCells)
+{
+    Touched.Init(false, NumCells);
+    WasCorrect.Init(false, NumCells);
+    TouchedCells.Reset();
+}
+
+void FPuzzleChangeJournal::Reset()
+{
+    for (const int32 GridID : TouchedCells)
+    {
+        Touched[GridID] = false;
+    }
+    TouchedCells.Reset();
+}
+
+void FPuzzleChangeJournal::Flush(const TArray<int32>& Occupancy, FPuzzleBoardDelta& OutDelta)
+{
+    OutDelta.ChangedGridIDs.Reset(TouchedCells.Num());
+    OutDelta.NewlyCorrectGridIDs.Reset();
+    OutDelta.NewlyIncorrectGridIDs.Reset();
+
+    for (const int32 GridID : TouchedCells)
+    {
+        Touched[GridID] = false;
+
+        // Frame içinde geri alınan yazım değişmiş sayılır ama doğruluk geçişi üretmez
+        const bool bIsCorrect = Occupancy[GridID] == GridID;
+        if (bIsCorrect && !WasCorrect[GridID])
+        {
+            OutDelta.NewlyCorrectGridIDs.Add(GridID);
+        }
+        else if (!bIsCorrect && WasCorrect[GridID])
+        {
+            OutDelta.NewlyIncorrectGridIDs.Add(GridID);
+        }
+        OutDelta.ChangedGridIDs.Add(GridID);
+    }
+
+    TouchedCells.Reset();
+}
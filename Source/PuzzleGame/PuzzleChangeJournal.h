@@ -0,0 +1,78 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PuzzleChangeJournal.generated.h"
+
+// Bir frame içinde board'da değişen her şeyin tek özeti
+USTRUCT(BlueprintType)
+struct PUZZLEGAME_API FPuzzleBoardDelta
+{
+    GENERATED_BODY()
+
+    // Occupant'ı değişen hücreler (tekrarsız)
+    UPROPERTY(BlueprintReadOnly, Category = "Puzzle")
+    TArray<int32> ChangedGridIDs;
+
+    // Frame başında yanlış/boş olup şimdi doğru parçayı taşıyan hücreler
+    UPROPERTY(BlueprintReadOnly, Category = "Puzzle")
+    TArray<int32> NewlyCorrectGridIDs;
+
+    // Frame başında doğru olup artık olmayan hücreler
+    UPROPERTY(BlueprintReadOnly, Category = "Puzzle")
+    TArray<int32> NewlyIncorrectGridIDs;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Puzzle")
+    int32 CorrectCellCount = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Puzzle")
+    int32 TotalCellCount = 0;
+
+    void Reset()
+    {
+        ChangedGridIDs.Reset();
+        NewlyCorrectGridIDs.Reset();
+        NewlyIncorrectGridIDs.Reset();
+        CorrectCellCount = 0;
+        TotalCellCount = 0;
+    }
+};
+
+// C++ dinleyicileri için - Blueprint VM'e girmeden delta'yı alır
+DECLARE_MULTICAST_DELEGATE_OneParam(FPuzzleOnBoardDeltaNative, const FPuzzleBoardDelta&);
+
+/**
+ * Collects occupancy writes between flushes. Each cell is recorded once with its
+ * correctness at the time of its first write, so a cell that is moved away and back
+ * within one frame shows up as changed but neither newly correct nor newly incorrect.
+ * Recording is O(1); a flush costs O(changed cells).
+ */
+class PUZZLEGAME_API FPuzzleChangeJournal
+{
+public:
+    void Init(int32 NumCells);
+
+    void Reset();
+
+    // SetCellOccupant'tan yazımdan önce çağrılır
+    void RecordCell(int32 GridID, bool bWasCorrect)
+    {
+        if (!Touched[GridID])
+        {
+            Touched[GridID] = true;
+            WasCorrect[GridID] = bWasCorrect;
+            TouchedCells.Add(GridID);
+        }
+    }
+
+    bool HasChanges() const { return TouchedCells.Num() > 0; }
+
+    // Biriken değişiklikleri delta'ya yazar ve journal'ı boşaltır
+    void Flush(const TArray<int32>& Occupancy, FPuzzleBoardDelta& OutDelta);
+
+private:
+    TBitArray<> Touched;
+    TBitArray<> WasCorrect;
+    TArray<int32> TouchedCells;
+};
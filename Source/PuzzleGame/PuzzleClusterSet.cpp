@@ -0,0 +1,409 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "PuzzleClusterSet.h"
+
+void FPuzzleClusterSet::Init(int32 InWidth, int32 InHeight, EPuzzleGridTopology InTopology)
+{
+    Width = InWidth;
+    Height = InHeight;
+    Topology = InTopology;
+
+    const int32 TotalCells = Width * Height;
+    ClusterIDs.SetNumUninitialized(TotalCells);
+    MemberIndices.SetNumUninitialized(TotalCells);
+    Members.Reset();
+    Members.SetNum(TotalCells);
+    FreeClusterIDs.Reset();
+
+    for (int32 GridID = 0; GridID < TotalCells; GridID++)
+    {
+        ClusterIDs[GridID] = GridID;
+        MemberIndices[GridID] = 0;
+        Members[GridID].Add(GridID);
+    }
+
+    VisitEpochs.Init(0, TotalCells);
+    VisitOwners.SetNumUninitialized(TotalCells);
+    VisitEpoch = 0;
+}
+
+void FPuzzleClusterSet::Rebuild(const TArray<int32>& Occupancy)
+{
+    Init(Width, Height, Topology);
+
+    for (int32 GridID = 0; GridID < ClusterIDs.Num(); GridID++)
+    {
+        UnionWithCorrectNeighbours(GridID, Occupancy);
+    }
+}
+
+void FPuzzleClusterSet::OnCellsChanged(TArrayView<const int32> ChangedGridIDs, const TArray<int32>& Occupancy)
+{
+    // Kümesinden ayrılan hücreler - aynı kümede komşu olanlar tek delik grubu sayılır
+    struct FDetachedCell
+    {
+        int32 GridID;
+        int32 OldClusterID;
+        int32 Group;
+    };
+    TArray<FDetachedCell, TInlineAllocator<8>> Detached;
+
+    for (const int32 GridID : ChangedGridIDs)
+    {
+        if (!ClusterIDs.IsValidIndex(GridID))
+        {
+            continue;
+        }
+
+        const int32 OldClusterID = ClusterIDs[GridID];
+        if (Members[OldClusterID].Num() == 1)
+        {
+            continue;
+        }
+
+        // Tek üyeli değilse en az bir ID boşta
+        Detached.Add({ GridID, OldClusterID, Detached.Num() });
+        MoveToCluster(GridID, FreeClusterIDs.Pop(EAllowShrinking::No));
+    }
+
+    auto FindGroup = [&Detached](int32 Index)
+    {
+        while (Detached[Index].Group != Index)
+        {
+            Index = Detached[Index].Group;
+        }
+        return Index;
+    };
+
+    // (delik grubu, kalan komşu) çiftleri - her grubun komşuları birbirine bağlıysa küme bölünmemiştir;
+    // uzak delikler ayrı aranır, yoksa tohumları buluşana kadar bütün küme taranırdı
+    TArray<TPair<int32, int32>, TInlineAllocator<32>> Seeds;
+    DispatchGridTopology(Topology, [&](auto Policy)
+    {
+        using FTopology = decltype(Policy);
+        for (int32 Index = 0; Index < Detached.Num(); Index++)
+        {
+            const FDetachedCell& Cell = Detached[Index];
+            ForEachGridNeighbour<FTopology>(Cell.GridID, Width, Height, [&](int32 Direction, int32 Neighbour)
+            {
+                if (ClusterIDs[Neighbour] == Cell.OldClusterID)
+                {
+                    Seeds.Emplace(Index, Neighbour);
+                    return;
+                }
+
+                for (int32 Other = 0; Other < Index; Other++)
+                {
+                    if (Detached[Other].GridID == Neighbour && Detached[Other].OldClusterID == Cell.OldClusterID)
+                    {
+                        Detached[FindGroup(Index)].Group = FindGroup(Other);
+                    }
+                }
+            });
+        }
+    });
+
+    for (TPair<int32, int32>& Seed : Seeds)
+    {
+        Seed.Key = FindGroup(Seed.Key);
+    }
+    Seeds.Sort([](const TPair<int32, int32>& A, const TPair<int32, int32>& B) { return A.Key < B.Key; });
+
+    // Bir grubun tüm komşuları tek bileşendeyse o grup bölünme saklayamaz. Bir komşusu ayrılmış ya da
+    // araması bölünme bulmuş grupların kalan komşuları ikinci aşamada birlikte aranır - kalan parçalar
+    // ayrılan bileşen üzerinden gruplar arasında birbirine bağlanıyor olabilir
+    TArray<TPair<int32, int32>, TInlineAllocator<32>> UnresolvedSeeds;
+    TArray<int32, TInlineAllocator<32>> GroupSeeds;
+    for (int32 Index = 0; Index < Seeds.Num();)
+    {
+        const int32 Group = Seeds[Index].Key;
+        const int32 ClusterID = Detached[Group].OldClusterID;
+        GroupSeeds.Reset();
+        bool bLostSeed = false;
+        for (; Index < Seeds.Num() && Seeds[Index].Key == Group; Index++)
+        {
+            // Önceki bir grubun araması bu komşuyu ayrı kümeye taşımış olabilir
+            if (ClusterIDs[Seeds[Index].Value] == ClusterID)
+            {
+                GroupSeeds.AddUnique(Seeds[Index].Value);
+            }
+            else
+            {
+                bLostSeed = true;
+            }
+        }
+
+        const bool bSplit = GroupSeeds.Num() > 1 && SplitCluster(ClusterID, GroupSeeds, Occupancy);
+        if (bLostSeed || bSplit)
+        {
+            for (const int32 Seed : GroupSeeds)
+            {
+                UnresolvedSeeds.Emplace(ClusterID, Seed);
+            }
+        }
+    }
+
+    UnresolvedSeeds.Sort([](const TPair<int32, int32>& A, const TPair<int32, int32>& B) { return A.Key < B.Key; });
+    for (int32 Index = 0; Index < UnresolvedSeeds.Num();)
+    {
+        const int32 ClusterID = UnresolvedSeeds[Index].Key;
+        GroupSeeds.Reset();
+        for (; Index < UnresolvedSeeds.Num() && UnresolvedSeeds[Index].Key == ClusterID; Index++)
+        {
+            if (ClusterIDs[UnresolvedSeeds[Index].Value] == ClusterID)
+            {
+                GroupSeeds.AddUnique(UnresolvedSeeds[Index].Value);
+            }
+        }
+
+        if (GroupSeeds.Num() > 1)
+        {
+            SplitCluster(ClusterID, GroupSeeds, Occupancy);
+        }
+    }
+
+    for (const int32 GridID : ChangedGridIDs)
+    {
+        if (ClusterIDs.IsValidIndex(GridID))
+        {
+            UnionWithCorrectNeighbours(GridID, Occupancy);
+        }
+    }
+}
+
+bool FPuzzleClusterSet::SplitCluster(int32 ClusterID, TArrayView<const int32> Seeds, const TArray<int32>& Occupancy)
+{
+    // Her tohumdan bir BFS, sırayla birer adım - buluşan aramalar birleşir, tek başına tükenen ayrı bir parçadır
+    struct FSearch
+    {
+        TArray<int32> Cells;
+        TArray<int32> Frontier;
+        int32 Head = 0;
+        int32 MergedInto = INDEX_NONE;
+        bool bDone = false;
+    };
+
+    VisitEpoch++;
+    if (VisitEpoch == 0)
+    {
+        VisitEpochs.Init(0, VisitEpochs.Num());
+        VisitEpoch = 1;
+    }
+
+    TArray<FSearch, TInlineAllocator<8>> Searches;
+    Searches.SetNum(Seeds.Num());
+    for (int32 SearchIndex = 0; SearchIndex < Seeds.Num(); SearchIndex++)
+    {
+        Searches[SearchIndex].Cells.Add(Seeds[SearchIndex]);
+        Searches[SearchIndex].Frontier.Add(Seeds[SearchIndex]);
+        VisitEpochs[Seeds[SearchIndex]] = VisitEpoch;
+        VisitOwners[Seeds[SearchIndex]] = SearchIndex;
+    }
+
+    auto ResolveSearch = [&Searches](int32 SearchIndex)
+    {
+        while (Searches[SearchIndex].MergedInto != INDEX_NONE)
+        {
+            SearchIndex = Searches[SearchIndex].MergedInto;
+        }
+        return SearchIndex;
+    };
+
+    bool bSplit = false;
+    int32 NumActive = Searches.Num();
+    while (NumActive > 1)
+    {
+        for (int32 SearchIndex = 0; SearchIndex < Searches.Num() && NumActive > 1; SearchIndex++)
+        {
+            FSearch& Search = Searches[SearchIndex];
+            if (Search.MergedInto != INDEX_NONE || Search.bDone)
+            {
+                continue;
+            }
+
+            if (Search.Head == Search.Frontier.Num())
+            {
+                // Diğer aramalarla bağlantısı yok - yeni kümeye taşınır, eski küme diğer aramalarda kalır
+                const int32 NewClusterID = FreeClusterIDs.Pop(EAllowShrinking::No);
+                for (const int32 Cell : Search.Cells)
+                {
+                    MoveToCluster(Cell, NewClusterID);
+                }
+                Search.bDone = true;
+                bSplit = true;
+                NumActive--;
+                continue;
+            }
+
+            const int32 Cell = Search.Frontier[Search.Head++];
+            ForEachLinkedNeighbour(Cell, Occupancy, [&](int32 Neighbour)
+            {
+                // Ayrılan hücreler ve ayrılmış parçalar artık başka kümede
+                if (ClusterIDs[Neighbour] != ClusterID)
+                {
+                    return;
+                }
+
+                if (VisitEpochs[Neighbour] != VisitEpoch)
+                {
+                    VisitEpochs[Neighbour] = VisitEpoch;
+                    VisitOwners[Neighbour] = SearchIndex;
+                    Search.Cells.Add(Neighbour);
+                    Search.Frontier.Add(Neighbour);
+                    return;
+                }
+
+                const int32 OtherIndex = ResolveSearch(VisitOwners[Neighbour]);
+                if (OtherIndex != SearchIndex)
+                {
+                    // Aynı bileşen - küçük aramanın hücreleri ve bekleyen sırası büyüğüne eklenir
+                    FSearch& Other = Searches[OtherIndex];
+                    if (Other.Cells.Num() > Search.Cells.Num())
+                    {
+                        Swap(Search.Cells, Other.Cells);
+                        Swap(Search.Frontier, Other.Frontier);
+                        Swap(Search.Head, Other.Head);
+                    }
+                    Search.Cells.Append(Other.Cells);
+                    Search.Frontier.Append(Other.Frontier.GetData() + Other.Head, Other.Frontier.Num() - Other.Head);
+
+                    Other.Cells.Empty();
+                    Other.Frontier.Empty();
+                    Other.MergedInto = SearchIndex;
+                    NumActive--;
+                }
+            });
+        }
+    }
+
+    return bSplit;
+}
+
+int32 FPuzzleClusterSet::GetClusterSize(int32 GridID) const
+{
+    if (!ClusterIDs.IsValidIndex(GridID))
+    {
+        return 0;
+    }
+    return Members[ClusterIDs[GridID]].Num();
+}
+
+const TArray<int32>& FPuzzleClusterSet::GetClusterMembers(int32 GridID) const
+{
+    static const TArray<int32> EmptyMembers;
+    if (!ClusterIDs.IsValidIndex(GridID))
+    {
+        return EmptyMembers;
+    }
+    return Members[ClusterIDs[GridID]];
+}
+
+bool FPuzzleClusterSet::AreInSameCluster(int32 GridID1, int32 GridID2) const
+{
+    return ClusterIDs.IsValidIndex(GridID1) && ClusterIDs.IsValidIndex(GridID2) && ClusterIDs[GridID1] == ClusterIDs[GridID2];
+}
+
+bool FPuzzleClusterSet::AreCorrectlyAdjacent(int32 GridID1, int32 GridID2, const TArray<int32>& Occupancy) const
+{
+    if (!Occupancy.IsValidIndex(GridID1) || !Occupancy.IsValidIndex(GridID2))
+    {
+        return false;
+    }
+
+    return DispatchGridTopology(Topology, [&](auto Policy)
+    {
+        using FTopology = decltype(Policy);
+        for (int32 Direction = 0; Direction < FTopology::NumDirections; Direction++)
+        {
+            if (GetGridNeighbour<FTopology>(GridID1, Direction, Width, Height) == GridID2)
+            {
+                return IsCorrectNeighbour<FTopology>(GridID1, Direction, GridID2, Occupancy);
+            }
+        }
+        return false;
+    });
+}
+
+template<typename TopologyType>
+bool FPuzzleClusterSet::IsCorrectNeighbour(int32 GridID, int32 Direction, int32 Neighbour, const TArray<int32>& Occupancy) const
+{
+    const int32 Piece1 = Occupancy[GridID];
+    const int32 Piece2 = Occupancy[Neighbour];
+    if (Piece1 < 0 || Piece2 < 0)
+    {
+        return false;
+    }
+
+    // Parçalar çözümde de aynı yönde komşu olmalı; üçgenlerde parça hücreyle aynı yöne bakmalı
+    return GetGridNeighbour<TopologyType>(Piece1, Direction, Width, Height) == Piece2 &&
+        TopologyType::HaveSameShape(GridID, Piece1, Width);
+}
+
+template<typename FuncType>
+void FPuzzleClusterSet::ForEachLinkedNeighbour(int32 GridID, const TArray<int32>& Occupancy, FuncType&& Func) const
+{
+    DispatchGridTopology(Topology, [&](auto Policy)
+    {
+        using FTopology = decltype(Policy);
+        ForEachGridNeighbour<FTopology>(GridID, Width, Height, [&](int32 Direction, int32 Neighbour)
+        {
+            if (IsCorrectNeighbour<FTopology>(GridID, Direction, Neighbour, Occupancy))
+            {
+                Func(Neighbour);
+            }
+        });
+    });
+}
+
+void FPuzzleClusterSet::MoveToCluster(int32 GridID, int32 ClusterID)
+{
+    // Swap-remove - yer değiştiren üyenin indeksi güncellenir
+    const int32 OldClusterID = ClusterIDs[GridID];
+    TArray<int32>& OldMembers = Members[OldClusterID];
+    const int32 Index = MemberIndices[GridID];
+    OldMembers.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    if (Index < OldMembers.Num())
+    {
+        MemberIndices[OldMembers[Index]] = Index;
+    }
+    if (OldMembers.Num() == 0)
+    {
+        FreeClusterIDs.Add(OldClusterID);
+    }
+
+    ClusterIDs[GridID] = ClusterID;
+    MemberIndices[GridID] = Members[ClusterID].Add(GridID);
+}
+
+void FPuzzleClusterSet::Merge(int32 GridID1, int32 GridID2)
+{
+    int32 Cluster1 = ClusterIDs[GridID1];
+    int32 Cluster2 = ClusterIDs[GridID2];
+    if (Cluster1 == Cluster2)
+    {
+        return;
+    }
+
+    // Küçük küme büyüğe taşınır - hücre başına en fazla log N taşıma
+    if (Members[Cluster1].Num() < Members[Cluster2].Num())
+    {
+        Swap(Cluster1, Cluster2);
+    }
+
+    TArray<int32>& Target = Members[Cluster1];
+    for (const int32 Cell : Members[Cluster2])
+    {
+        ClusterIDs[Cell] = Cluster1;
+        MemberIndices[Cell] = Target.Add(Cell);
+    }
+    Members[Cluster2].Empty();
+    FreeClusterIDs.Add(Cluster2);
+}
+
+void FPuzzleClusterSet::UnionWithCorrectNeighbours(int32 GridID, const TArray<int32>& Occupancy)
+{
+    ForEachLinkedNeighbour(GridID, Occupancy, [&](int32 Neighbour)
+    {
+        Merge(GridID, Neighbour);
+    });
+}
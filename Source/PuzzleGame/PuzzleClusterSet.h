@@ -0,0 +1,75 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PuzzleGridTopology.h"
+
+/**
+ * Incrementally maintained clusters of grid cells. Two neighbouring cells are linked when
+ * they hold pieces that are also neighbours in the solved image (same direction); a cluster
+ * is a connected set of linked cells. Every cell stores its cluster ID, so queries are O(1).
+ *
+ * A change only touches the changed cells' links: each changed cell is detached into its own
+ * cluster, then its old cluster is checked for a split with interleaved searches from the
+ * cell's former neighbours - the searches stop as soon as they meet, and a search that runs
+ * out on its own has found a split-off part, which is moved to a new cluster. Finally the
+ * changed cells are joined to their new correct neighbours. Merges move the smaller cluster.
+ */
+class PUZZLEGAME_API FPuzzleClusterSet
+{
+public:
+    void Init(int32 InWidth, int32 InHeight, EPuzzleGridTopology InTopology = EPuzzleGridTopology::Square);
+
+    // Tüm kümeleri occupancy'den yeniden kur - O(N log N)
+    void Rebuild(const TArray<int32>& Occupancy);
+
+    // Sadece değişen hücrelerin komşu bağlantılarını günceller
+    void OnCellsChanged(TArrayView<const int32> ChangedGridIDs, const TArray<int32>& Occupancy);
+
+    int32 GetClusterID(int32 GridID) const { return ClusterIDs[GridID]; }
+
+    int32 GetClusterSize(int32 GridID) const;
+
+    // Kümenin tüm hücreleri, sırasız
+    const TArray<int32>& GetClusterMembers(int32 GridID) const;
+
+    bool AreInSameCluster(int32 GridID1, int32 GridID2) const;
+
+    // İki komşu hücre doğru komşu parçaları mı taşıyor
+    bool AreCorrectlyAdjacent(int32 GridID1, int32 GridID2, const TArray<int32>& Occupancy) const;
+
+private:
+    // Hücreyi başka kümeye taşır - boşalan küme ID'si serbest listeye döner
+    void MoveToCluster(int32 GridID, int32 ClusterID);
+    void Merge(int32 GridID1, int32 GridID2);
+    void UnionWithCorrectNeighbours(int32 GridID, const TArray<int32>& Occupancy);
+
+    // Seeds: ClusterID'de kalan, ayrılan hücrelerin eski komşuları - bir parça ayrıldıysa true
+    bool SplitCluster(int32 ClusterID, TArrayView<const int32> Seeds, const TArray<int32>& Occupancy);
+
+    // Neighbour, GridID'nin Direction yönündeki komşusu olmalı
+    template<typename TopologyType>
+    bool IsCorrectNeighbour(int32 GridID, int32 Direction, int32 Neighbour, const TArray<int32>& Occupancy) const;
+
+    template<typename FuncType>
+    void ForEachLinkedNeighbour(int32 GridID, const TArray<int32>& Occupancy, FuncType&& Func) const;
+
+    int32 Width = 0;
+    int32 Height = 0;
+    EPuzzleGridTopology Topology = EPuzzleGridTopology::Square;
+
+    TArray<int32> ClusterIDs;
+
+    // Hücrenin kendi kümesinin Members dizisindeki yeri - O(1) çıkarma için
+    TArray<int32> MemberIndices;
+
+    // Küme ID'si -> hücreler, kullanılmayan ID'ler için boş
+    TArray<TArray<int32>> Members;
+    TArray<int32> FreeClusterIDs;
+
+    // Bölünme aramalarının ziyaret işaretleri - epoch değişince hepsi geçersiz
+    TArray<uint32> VisitEpochs;
+    TArray<int32> VisitOwners;
+    uint32 VisitEpoch = 0;
+};
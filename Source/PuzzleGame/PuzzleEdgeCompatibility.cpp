@@ -0,0 +1,311 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "PuzzleEdgeCompatibility.h"
+#include "Math/VectorRegister.h"
+#include "Async/ParallelFor.h"
+
+namespace PuzzleCompatibility
+{
+    constexpr int32 Samples = FPuzzleEdgeCompatibility::SamplesPerEdge;
+
+    // Kenar başına float4 örnekler - A kanalı 0, toplamlar RGB üzerinden
+    constexpr int32 FloatsPerSide = Samples * 4;
+
+    FORCEINLINE float SumLanes(const VectorRegister4Float& Value)
+    {
+        float Lanes[4];
+        VectorStore(Value, Lanes);
+        return Lanes[0] + Lanes[1] + Lanes[2] + Lanes[3];
+    }
+
+    // Dikdörtgen parçanın bir kenar şeridi: sınır pikselleri ve bir içerideki pikseller
+    struct FSideStrip
+    {
+        int32 StartX;
+        int32 StartY;
+        int32 StepX;
+        int32 StepY;
+        int32 Length;
+        int32 InwardX;
+        int32 InwardY;
+    };
+}
+
+FPuzzleEdgeCompatibility::FPuzzleEdgeCompatibility(int32 InGridWidth, int32 InGridHeight, int32 InNumNeighbours)
+    : GridWidth(InGridWidth)
+    , GridHeight(InGridHeight)
+    , NumNeighbours(InNumNeighbours)
+{
+}
+
+TSharedPtr<const FPuzzleEdgeCompatibility, ESPMode::ThreadSafe> FPuzzleEdgeCompatibility::Build(TArrayView<const FColor> Pixels,
+    int32 ImageWidth, int32 ImageHeight, int32 GridWidth, int32 GridHeight, int32 NumNeighbours,
+    const std::atomic<bool>* bCancelled)
+{
+    using namespace PuzzleCompatibility;
+
+    const int32 NumPieces = GridWidth * GridHeight;
+    if (NumPieces < 2 || ImageWidth < GridWidth || ImageHeight < GridHeight || Pixels.Num() != ImageWidth * ImageHeight)
+    {
+        return nullptr;
+    }
+    NumNeighbours = FMath::Clamp(NumNeighbours, 1, FMath::Min(MaxNeighbours, NumPieces - 1));
+
+    // Örnekler dışa doğru: sınır ve tahmin (bir sonraki piksel = 2 * sınır - iç)
+    // Sıra: kuzey/güney soldan sağa, doğu/batı yukarıdan aşağıya - karşılıklı kenarlar aynı sırada
+    TArray<float> Boundary;
+    TArray<float> Predicted;
+    TArray<float> BoundarySums;
+    TArray<float> PredictedSums;
+    Boundary.SetNumUninitialized(NumPieces * 4 * FloatsPerSide);
+    Predicted.SetNumUninitialized(NumPieces * 4 * FloatsPerSide);
+    BoundarySums.SetNumUninitialized(NumPieces * 4 * 4);
+    PredictedSums.SetNumUninitialized(NumPieces * 4 * 4);
+
+    ParallelFor(NumPieces, [&](int32 PieceID)
+    {
+        const int32 Col = PieceID % GridWidth;
+        const int32 Row = PieceID / GridWidth;
+        const int32 X0 = (int32)((int64)Col * ImageWidth / GridWidth);
+        const int32 X1 = (int32)((int64)(Col + 1) * ImageWidth / GridWidth) - 1;
+        const int32 Y0 = (int32)((int64)Row * ImageHeight / GridHeight);
+        const int32 Y1 = (int32)((int64)(Row + 1) * ImageHeight / GridHeight) - 1;
+
+        // Tek piksellik parçada iç piksel sınırın kendisi olur
+        const int32 InX = X1 > X0 ? 1 : 0;
+        const int32 InY = Y1 > Y0 ? 1 : 0;
+        const FSideStrip Strips[4] =
+        {
+            { X0, Y0, 1, 0, X1 - X0 + 1, 0, InY },
+            { X1, Y0, 0, 1, Y1 - Y0 + 1, -InX, 0 },
+            { X0, Y1, 1, 0, X1 - X0 + 1, 0, -InY },
+            { X0, Y0, 0, 1, Y1 - Y0 + 1, InX, 0 },
+        };
+
+        for (int32 Side = 0; Side < 4; Side++)
+        {
+            const FSideStrip& Strip = Strips[Side];
+            const int32 SideIndex = PieceID * 4 + Side;
+            float* OutBoundary = Boundary.GetData() + SideIndex * FloatsPerSide;
+            float* OutPredicted = Predicted.GetData() + SideIndex * FloatsPerSide;
+            float* OutBoundarySum = BoundarySums.GetData() + SideIndex * 4;
+            float* OutPredictedSum = PredictedSums.GetData() + SideIndex * 4;
+            FMemory::Memzero(OutBoundarySum, 4 * sizeof(float));
+            FMemory::Memzero(OutPredictedSum, 4 * sizeof(float));
+
+            for (int32 Sample = 0; Sample < Samples; Sample++)
+            {
+                // Şeridin Sample'ıncı parçası kutu filtreyle ortalanır - en az bir piksel
+                const int32 First = Sample * Strip.Length / Samples;
+                const int32 Last = FMath::Max(First + 1, (Sample + 1) * Strip.Length / Samples);
+
+                float Edge[3] = { 0.0f, 0.0f, 0.0f };
+                float Inner[3] = { 0.0f, 0.0f, 0.0f };
+                for (int32 Step = First; Step < Last; Step++)
+                {
+                    const int32 X = Strip.StartX + Strip.StepX * Step;
+                    const int32 Y = Strip.StartY + Strip.StepY * Step;
+                    const FColor EdgePixel = Pixels[Y * ImageWidth + X];
+                    const FColor InnerPixel = Pixels[(Y + Strip.InwardY) * ImageWidth + X + Strip.InwardX];
+                    Edge[0] += EdgePixel.R;
+                    Edge[1] += EdgePixel.G;
+                    Edge[2] += EdgePixel.B;
+                    Inner[0] += InnerPixel.R;
+                    Inner[1] += InnerPixel.G;
+                    Inner[2] += InnerPixel.B;
+                }
+
+                const float Scale = 1.0f / (Last - First);
+                for (int32 Channel = 0; Channel < 3; Channel++)
+                {
+                    const float EdgeValue = Edge[Channel] * Scale;
+                    const float PredictedValue = 2.0f * EdgeValue - Inner[Channel] * Scale;
+                    OutBoundary[Sample * 4 + Channel] = EdgeValue;
+                    OutPredicted[Sample * 4 + Channel] = PredictedValue;
+                    OutBoundarySum[Channel] += EdgeValue;
+                    OutPredictedSum[Channel] += PredictedValue;
+                }
+                OutBoundary[Sample * 4 + 3] = 0.0f;
+                OutPredicted[Sample * 4 + 3] = 0.0f;
+            }
+        }
+    });
+
+    TSharedPtr<FPuzzleEdgeCompatibility, ESPMode::ThreadSafe> Result =
+        MakeShareable(new FPuzzleEdgeCompatibility(GridWidth, GridHeight, NumNeighbours));
+    Result->Candidates.SetNumUninitialized(NumPieces * 4 * NumNeighbours);
+
+    // Satır = (parça, kenar); her satır tüm parçaları tarar, satırlar bağımsız
+    ParallelFor(NumPieces * 4, [&](int32 SideIndex)
+    {
+        if (bCancelled && bCancelled->load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        const int32 PieceID = SideIndex / 4;
+        const int32 Opposite = GetOppositeSide(SideIndex % 4);
+        const float* OwnBoundary = Boundary.GetData() + SideIndex * FloatsPerSide;
+        const float* OwnPredicted = Predicted.GetData() + SideIndex * FloatsPerSide;
+        const VectorRegister4Float OwnBoundarySum = VectorLoad(BoundarySums.GetData() + SideIndex * 4);
+        const VectorRegister4Float OwnPredictedSum = VectorLoad(PredictedSums.GetData() + SideIndex * 4);
+
+        // En iyiler artan sırada; dolana kadar eşik sonsuz
+        FPuzzleEdgeCandidate* Best = Result->Candidates.GetData() + SideIndex * NumNeighbours;
+        int32 NumBest = 0;
+        float Threshold = MAX_flt;
+
+        for (int32 OtherID = 0; OtherID < NumPieces; OtherID++)
+        {
+            if (OtherID == PieceID)
+            {
+                continue;
+            }
+
+            const int32 OtherIndex = OtherID * 4 + Opposite;
+
+            // |Σa - Σb| <= Σ|a - b| - toplamlardan alt sınır tam karşılaştırmayı çoğu aday için atlar
+            const VectorRegister4Float LowerBound = VectorAdd(
+                VectorAbs(VectorSubtract(OwnPredictedSum, VectorLoad(BoundarySums.GetData() + OtherIndex * 4))),
+                VectorAbs(VectorSubtract(VectorLoad(PredictedSums.GetData() + OtherIndex * 4), OwnBoundarySum)));
+            if (SumLanes(LowerBound) >= Threshold)
+            {
+                continue;
+            }
+
+            const float* OtherBoundary = Boundary.GetData() + OtherIndex * FloatsPerSide;
+            const float* OtherPredicted = Predicted.GetData() + OtherIndex * FloatsPerSide;
+
+            // Dört örnekte bir eşik kontrolü
+            float Dissimilarity = 0.0f;
+            for (int32 Sample = 0; Sample < Samples && Dissimilarity < Threshold; Sample += 4)
+            {
+                VectorRegister4Float Sum = VectorZeroFloat();
+                for (int32 Lane = Sample; Lane < Sample + 4; Lane++)
+                {
+                    Sum = VectorAdd(Sum, VectorAbs(VectorSubtract(VectorLoad(OwnPredicted + Lane * 4), VectorLoad(OtherBoundary + Lane * 4))));
+                    Sum = VectorAdd(Sum, VectorAbs(VectorSubtract(VectorLoad(OtherPredicted + Lane * 4), VectorLoad(OwnBoundary + Lane * 4))));
+                }
+                Dissimilarity += SumLanes(Sum);
+            }
+            if (Dissimilarity >= Threshold)
+            {
+                continue;
+            }
+
+            // Sıralı ekleme - liste doluysa en kötü düşer
+            int32 Insert = FMath::Min(NumBest, NumNeighbours - 1);
+            while (Insert > 0 && Best[Insert - 1].Dissimilarity > Dissimilarity)
+            {
+                Best[Insert] = Best[Insert - 1];
+                Insert--;
+            }
+            Best[Insert] = { OtherID, Dissimilarity };
+            NumBest = FMath::Min(NumBest + 1, NumNeighbours);
+            if (NumBest == NumNeighbours)
+            {
+                Threshold = Best[NumNeighbours - 1].Dissimilarity;
+            }
+        }
+    }, EParallelForFlags::Unbalanced);
+
+    if (bCancelled && bCancelled->load(std::memory_order_relaxed))
+    {
+        return nullptr;
+    }
+    return Result;
+}
+
+template<typename FuncType>
+void FPuzzleEdgeCompatibility::ForEachOccupiedNeighbour(TArrayView<const int32> Occupancy, int32 GridID, FuncType&& Func) const
+{
+    const int32 Col = GridID % GridWidth;
+    const int32 Row = GridID / GridWidth;
+    const int32 Neighbours[4] =
+    {
+        Row > 0 ? GridID - GridWidth : INDEX_NONE,
+        Col < GridWidth - 1 ? GridID + 1 : INDEX_NONE,
+        Row < GridHeight - 1 ? GridID + GridWidth : INDEX_NONE,
+        Col > 0 ? GridID - 1 : INDEX_NONE,
+    };
+
+    for (int32 Side = 0; Side < 4; Side++)
+    {
+        const int32 NeighbourPiece = Neighbours[Side] >= 0 ? Occupancy[Neighbours[Side]] : INDEX_NONE;
+        if (NeighbourPiece >= 0 && NeighbourPiece < GetNumPieces())
+        {
+            // Komşunun bu hücreye bakan tarafının aday listesi
+            Func(GetCandidates(NeighbourPiece, GetOppositeSide(Side)));
+        }
+    }
+}
+
+bool FPuzzleEdgeCompatibility::ScorePieceForCell(TArrayView<const int32> Occupancy, int32 GridID, int32 PieceID, float& OutScore) const
+{
+    float Total = 0.0f;
+    int32 NumLists = 0;
+    ForEachOccupiedNeighbour(Occupancy, GridID, [PieceID, &Total, &NumLists](TArrayView<const FPuzzleEdgeCandidate> List)
+    {
+        float Score = List.Last().Dissimilarity;
+        for (const FPuzzleEdgeCandidate& Candidate : List)
+        {
+            if (Candidate.PieceID == PieceID)
+            {
+                Score = Candidate.Dissimilarity;
+                break;
+            }
+        }
+        Total += Score;
+        NumLists++;
+    });
+
+    OutScore = NumLists > 0 ? Total / NumLists : 0.0f;
+    return NumLists > 0;
+}
+
+bool FPuzzleEdgeCompatibility::FindBestPieceForCell(TArrayView<const int32> Occupancy, int32 GridID,
+    int32& OutPieceID, float& OutScore, float& OutConfidence) const
+{
+    // Adaylar komşu listelerinin birleşimi - en fazla 4 * NumNeighbours parça
+    TArray<int32, TInlineAllocator<4 * MaxNeighbours>> CandidateIDs;
+    ForEachOccupiedNeighbour(Occupancy, GridID, [&CandidateIDs](TArrayView<const FPuzzleEdgeCandidate> List)
+    {
+        for (const FPuzzleEdgeCandidate& Candidate : List)
+        {
+            CandidateIDs.AddUnique(Candidate.PieceID);
+        }
+    });
+
+    const int32 CurrentPiece = Occupancy[GridID];
+    float BestScore = MAX_flt;
+    float SecondScore = MAX_flt;
+    OutPieceID = INDEX_NONE;
+    for (const int32 CandidateID : CandidateIDs)
+    {
+        float Score = 0.0f;
+        if (CandidateID == CurrentPiece || !ScorePieceForCell(Occupancy, GridID, CandidateID, Score))
+        {
+            continue;
+        }
+
+        if (Score < BestScore)
+        {
+            SecondScore = BestScore;
+            BestScore = Score;
+            OutPieceID = CandidateID;
+        }
+        else if (Score < SecondScore)
+        {
+            SecondScore = Score;
+        }
+    }
+
+    if (OutPieceID == INDEX_NONE)
+    {
+        return false;
+    }
+
+    OutScore = BestScore;
+    OutConfidence = SecondScore < MAX_flt && SecondScore > 0.0f ? 1.0f - BestScore / SecondScore : 1.0f;
+    return true;
+}
@@ -0,0 +1,83 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+// Bir kenar komşusu adayı - düşük dissimilarity daha iyi uyum
+struct FPuzzleEdgeCandidate
+{
+    int32 PieceID = INDEX_NONE;
+    float Dissimilarity = 0.0f;
+};
+
+/**
+ * Pairwise border compatibility of the pieces of a photographic puzzle, computed from the
+ * solved image without using the solution itself. Each piece side is reduced to
+ * SamplesPerEdge box-filtered border pixels plus the pixel predicted one step across the
+ * border (2 * border - inner). Two sides fit when each side's prediction matches the other
+ * side's border (prediction-based dissimilarity, summed over RGB).
+ *
+ * Only the NumNeighbours best candidates per piece side are kept, best first. Rows are
+ * computed with ParallelFor over piece sides. Candidates are first rejected by a lower
+ * bound from the per-side colour sums, then compared four samples at a time with an early
+ * exit once the partial sum passes the current worst kept candidate.
+ */
+class PUZZLEGAME_API FPuzzleEdgeCompatibility
+{
+public:
+    static constexpr int32 SamplesPerEdge = 16;
+    static constexpr int32 MaxNeighbours = 32;
+
+    enum ESide : int32
+    {
+        North = 0,
+        East = 1,
+        South = 2,
+        West = 3
+    };
+
+    static int32 GetOppositeSide(int32 Side) { return (Side + 2) & 3; }
+
+    // Pixels: çözülmüş resim (satır satır), GridWidth x GridHeight dikdörtgen parçaya bölünür
+    // İptal edilirse veya boyutlar geçersizse null döner
+    static TSharedPtr<const FPuzzleEdgeCompatibility, ESPMode::ThreadSafe> Build(TArrayView<const FColor> Pixels,
+        int32 ImageWidth, int32 ImageHeight, int32 GridWidth, int32 GridHeight, int32 NumNeighbours,
+        const std::atomic<bool>* bCancelled = nullptr);
+
+    int32 GetGridWidth() const { return GridWidth; }
+    int32 GetGridHeight() const { return GridHeight; }
+    int32 GetNumPieces() const { return GridWidth * GridHeight; }
+    int32 GetNumNeighbours() const { return NumNeighbours; }
+
+    // PieceID'nin Side tarafına en iyi uyan parçalar, en iyisi önce
+    TArrayView<const FPuzzleEdgeCandidate> GetCandidates(int32 PieceID, int32 Side) const
+    {
+        return MakeArrayView(Candidates.GetData() + (PieceID * 4 + Side) * NumNeighbours, NumNeighbours);
+    }
+
+    // Parçanın hücrenin dolu komşularına ortalama uyumu - listede olmayan komşu için listenin en kötüsü
+    // Dolu komşu yoksa false
+    bool ScorePieceForCell(TArrayView<const int32> Occupancy, int32 GridID, int32 PieceID, float& OutScore) const;
+
+    // Komşuların aday listelerinden hücreye en iyi uyan parça (CurrentPiece hariç)
+    // Confidence: 1 - en iyi / ikinci en iyi, tek aday için 1
+    bool FindBestPieceForCell(TArrayView<const int32> Occupancy, int32 GridID,
+        int32& OutPieceID, float& OutScore, float& OutConfidence) const;
+
+    SIZE_T GetAllocatedSize() const { return Candidates.GetAllocatedSize(); }
+
+private:
+    FPuzzleEdgeCompatibility(int32 InGridWidth, int32 InGridHeight, int32 InNumNeighbours);
+
+    template<typename FuncType>
+    void ForEachOccupiedNeighbour(TArrayView<const int32> Occupancy, int32 GridID, FuncType&& Func) const;
+
+    int32 GridWidth;
+    int32 GridHeight;
+    int32 NumNeighbours;
+
+    // (PieceID * 4 + Side) * NumNeighbours - eksik aday PieceID INDEX_NONE
+    TArray<FPuzzleEdgeCandidate> Candidates;
+};
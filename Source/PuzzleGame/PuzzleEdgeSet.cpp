@@ -0,0 +1,173 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "PuzzleEdgeSet.h"
+#include "Math/VectorRegister.h"
+
+namespace PuzzleEdges
+{
+    // A ve B karşılıklı kenar renkleri (alt byte) - çerçeve/boş renkler iç kenarda eşleşmez
+    FORCEINLINE int32 CountMatchingLanes(const VectorRegister4Int& A, const VectorRegister4Int& B)
+    {
+        const VectorRegister4Int ByteMask = VectorIntSet1(0xFF);
+        const VectorRegister4Int Equal = VectorIntCompareEQ(A, B);
+        const VectorRegister4Int Invalid = VectorIntOr(VectorIntCompareEQ(A, GlobalVectorConstants::IntZero), VectorIntCompareEQ(A, ByteMask));
+        return FMath::CountBits(VectorMaskBits(VectorCastIntToFloat(VectorIntAndNot(Invalid, Equal))));
+    }
+
+    FORCEINLINE bool IsInnerMatch(uint8 ColourA, uint8 ColourB)
+    {
+        return ColourA == ColourB && ColourA != FPuzzleEdgeSet::FrameColour && ColourA != FPuzzleEdgeSet::EmptyColour;
+    }
+}
+
+TSharedRef<const FPuzzleEdgeSet, ESPMode::ThreadSafe> FPuzzleEdgeSet::Generate(int32 Width, int32 Height, int32 NumColours, int32 Seed)
+{
+    NumColours = FMath::Clamp(NumColours, 1, MaxColours);
+    FRandomStream Stream(Seed);
+
+    // Yatay kenar (Col, Row) hücrenin doğusu, dikey kenar hücrenin güneyi
+    TArray<uint8> EastColours;
+    TArray<uint8> SouthColours;
+    EastColours.SetNumUninitialized(Width * Height);
+    SouthColours.SetNumUninitialized(Width * Height);
+    for (int32 GridID = 0; GridID < Width * Height; GridID++)
+    {
+        EastColours[GridID] = (GridID % Width) < Width - 1 ? (uint8)Stream.RandRange(1, NumColours) : FrameColour;
+        SouthColours[GridID] = (GridID / Width) < Height - 1 ? (uint8)Stream.RandRange(1, NumColours) : FrameColour;
+    }
+
+    TArray<uint32> PieceEdges;
+    PieceEdges.SetNumUninitialized(Width * Height);
+    for (int32 GridID = 0; GridID < Width * Height; GridID++)
+    {
+        const int32 Col = GridID % Width;
+        const int32 Row = GridID / Width;
+        PieceEdges[GridID] = Pack(
+            Row > 0 ? SouthColours[GridID - Width] : FrameColour,
+            EastColours[GridID],
+            SouthColours[GridID],
+            Col > 0 ? EastColours[GridID - 1] : FrameColour);
+    }
+
+    return MakeShared<const FPuzzleEdgeSet, ESPMode::ThreadSafe>(Width, Height, MoveTemp(PieceEdges));
+}
+
+FPuzzleEdgeSet::FPuzzleEdgeSet(int32 InWidth, int32 InHeight, TArray<uint32> InPieceEdges)
+    : Width(InWidth)
+    , Height(InHeight)
+    , PieceEdges(MoveTemp(InPieceEdges))
+{
+    check(PieceEdges.Num() == Width * Height);
+}
+
+int32 FPuzzleEdgeSet::ScoreCell(TArrayView<const int32> Occupancy, int32 GridID) const
+{
+    const uint32 Edges = GetCellEdges(Occupancy, GridID);
+    if (Edges == EmptyCell)
+    {
+        return 0;
+    }
+
+    const int32 Col = GridID % Width;
+    const int32 Row = GridID / Width;
+    int32 Score = 0;
+
+    auto ScoreSide = [&](int32 Side, bool bOnBorder, int32 NeighbourGridID, int32 OppositeSide)
+    {
+        const uint8 Colour = GetColour(Edges, Side);
+        if (bOnBorder)
+        {
+            Score += Colour == FrameColour ? 1 : 0;
+        }
+        else
+        {
+            Score += PuzzleEdges::IsInnerMatch(Colour, GetColour(GetCellEdges(Occupancy, NeighbourGridID), OppositeSide)) ? 1 : 0;
+        }
+    };
+
+    ScoreSide(North, Row == 0, GridID - Width, South);
+    ScoreSide(East, Col == Width - 1, GridID + 1, West);
+    ScoreSide(South, Row == Height - 1, GridID + Width, North);
+    ScoreSide(West, Col == 0, GridID - 1, East);
+    return Score;
+}
+
+int32 FPuzzleEdgeSet::ScoreNeighbourhood(TArrayView<const int32> Occupancy, int32 GridID) const
+{
+    const int32 Col = GridID % Width;
+    const int32 Row = GridID / Width;
+    return ScoreCell(Occupancy, GridID) +
+        (Row > 0 ? ScoreCell(Occupancy, GridID - Width) : 0) +
+        (Col < Width - 1 ? ScoreCell(Occupancy, GridID + 1) : 0) +
+        (Row < Height - 1 ? ScoreCell(Occupancy, GridID + Width) : 0) +
+        (Col > 0 ? ScoreCell(Occupancy, GridID - 1) : 0);
+}
+
+int32 FPuzzleEdgeSet::CountMismatchedEdges(TArrayView<const int32> Occupancy) const
+{
+    TArray<uint32> CellEdges;
+    CellEdges.SetNumUninitialized(Occupancy.Num());
+    for (int32 GridID = 0; GridID < Occupancy.Num(); GridID++)
+    {
+        CellEdges[GridID] = GetCellEdges(Occupancy, GridID);
+    }
+    return CountMismatchedEdges(Width, Height, CellEdges.GetData());
+}
+
+int32 FPuzzleEdgeSet::CountMismatchedEdges(int32 Width, int32 Height, const uint32* CellEdges)
+{
+    const int32 TotalEdges = (Width - 1) * Height + Width * (Height - 1) + 2 * (Width + Height);
+    const VectorRegister4Int ByteMask = VectorIntSet1(0xFF);
+    int32 Matched = 0;
+
+    for (int32 Row = 0; Row < Height; Row++)
+    {
+        const uint32* RowEdges = CellEdges + Row * Width;
+
+        // Yatay komşular: 4 hücrenin doğusu ile sağdakilerin batısı tek karşılaştırmada
+        int32 Col = 0;
+        for (; Col + 4 < Width; Col += 4)
+        {
+            const VectorRegister4Int Left = VectorIntLoad(RowEdges + Col);
+            const VectorRegister4Int Right = VectorIntLoad(RowEdges + Col + 1);
+            Matched += PuzzleEdges::CountMatchingLanes(VectorIntAnd(VectorShiftRightImmLogical(Left, 8), ByteMask), VectorShiftRightImmLogical(Right, 24));
+        }
+        for (; Col < Width - 1; Col++)
+        {
+            Matched += PuzzleEdges::IsInnerMatch(GetColour(RowEdges[Col], East), GetColour(RowEdges[Col + 1], West)) ? 1 : 0;
+        }
+
+        if (Row == Height - 1)
+        {
+            continue;
+        }
+
+        // Dikey komşular: satırın güneyi ile alt satırın kuzeyi
+        const uint32* NextRowEdges = RowEdges + Width;
+        Col = 0;
+        for (; Col + 4 <= Width; Col += 4)
+        {
+            const VectorRegister4Int Upper = VectorIntLoad(RowEdges + Col);
+            const VectorRegister4Int Lower = VectorIntLoad(NextRowEdges + Col);
+            Matched += PuzzleEdges::CountMatchingLanes(VectorIntAnd(VectorShiftRightImmLogical(Upper, 16), ByteMask), VectorIntAnd(Lower, ByteMask));
+        }
+        for (; Col < Width; Col++)
+        {
+            Matched += PuzzleEdges::IsInnerMatch(GetColour(RowEdges[Col], South), GetColour(NextRowEdges[Col], North)) ? 1 : 0;
+        }
+    }
+
+    // Çerçeve: dış kenarlar 0 olmalı (boş hücre 0xFF, eşleşmez)
+    for (int32 Col = 0; Col < Width; Col++)
+    {
+        Matched += GetColour(CellEdges[Col], North) == FrameColour ? 1 : 0;
+        Matched += GetColour(CellEdges[(Height - 1) * Width + Col], South) == FrameColour ? 1 : 0;
+    }
+    for (int32 Row = 0; Row < Height; Row++)
+    {
+        Matched += GetColour(CellEdges[Row * Width], West) == FrameColour ? 1 : 0;
+        Matched += GetColour(CellEdges[Row * Width + Width - 1], East) == FrameColour ? 1 : 0;
+    }
+
+    return TotalEdges - Matched;
+}
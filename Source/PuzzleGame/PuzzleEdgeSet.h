@@ -0,0 +1,86 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Edge colours of an edge-matching (Eternity II style) piece set. Each piece packs its four
+ * edges into one uint32, one byte per side: bits 0-7 north, 8-15 east, 16-23 south, 24-31
+ * west. Colour 0 is the frame and must face the board border; 0xFF marks an empty cell and
+ * never matches anything.
+ *
+ * Generated sets plant a solution with PieceID == GridID, so they are always solvable, but
+ * any arrangement with every edge matched counts as solved.
+ */
+class PUZZLEGAME_API FPuzzleEdgeSet
+{
+public:
+    static constexpr uint8 FrameColour = 0;
+    static constexpr uint8 EmptyColour = 0xFF;
+    static constexpr uint32 EmptyCell = 0xFFFFFFFFu;
+
+    // İç kenar renkleri 1..MaxColours
+    static constexpr int32 MaxColours = 254;
+
+    enum ESide : int32
+    {
+        North = 0,
+        East = 1,
+        South = 2,
+        West = 3
+    };
+
+    static uint32 Pack(uint8 NorthColour, uint8 EastColour, uint8 SouthColour, uint8 WestColour)
+    {
+        return (uint32)NorthColour | ((uint32)EastColour << 8) | ((uint32)SouthColour << 16) | ((uint32)WestColour << 24);
+    }
+
+    static uint8 GetColour(uint32 Edges, int32 Side)
+    {
+        return (uint8)(Edges >> (Side * 8));
+    }
+
+    // Saat yönünde çeyrek tur: yeni kuzey eski batı olur
+    static uint32 Rotate(uint32 Edges, int32 Rotation)
+    {
+        const int32 Shift = (Rotation & 3) * 8;
+        return Shift == 0 ? Edges : (Edges << Shift) | (Edges >> (32 - Shift));
+    }
+
+    // Her iç kenara rastgele renk, çerçeveye 0 - çözüm PieceID == GridID
+    static TSharedRef<const FPuzzleEdgeSet, ESPMode::ThreadSafe> Generate(int32 Width, int32 Height, int32 NumColours, int32 Seed);
+
+    FPuzzleEdgeSet(int32 InWidth, int32 InHeight, TArray<uint32> InPieceEdges);
+
+    int32 GetWidth() const { return Width; }
+    int32 GetHeight() const { return Height; }
+    int32 GetNumPieces() const { return PieceEdges.Num(); }
+    uint32 GetPieceEdges(int32 PieceID) const { return PieceEdges[PieceID]; }
+    const TArray<uint32>& GetAllPieceEdges() const { return PieceEdges; }
+
+    // Hücredeki parçanın kenarları, boşsa EmptyCell
+    uint32 GetCellEdges(TArrayView<const int32> Occupancy, int32 GridID) const
+    {
+        const int32 PieceID = Occupancy[GridID];
+        return PieceEdges.IsValidIndex(PieceID) ? PieceEdges[PieceID] : EmptyCell;
+    }
+
+    // Hücrenin eşleşen kenar sayısı (0..4) - iç kenar iki hücreden ayrı sayılır, tam board 4 * N
+    int32 ScoreCell(TArrayView<const int32> Occupancy, int32 GridID) const;
+    int32 GetSolvedScore() const { return 4 * Width * Height; }
+
+    // Hücre ve dört komşusunun skorları toplamı - tek hücre yazımının etkilediği tüm skorlar
+    int32 ScoreNeighbourhood(TArrayView<const int32> Occupancy, int32 GridID) const;
+
+    // Tüm board: eşleşmeyen kenar sayısı (boş hücrelerin kenarları dahil) - SIMD
+    int32 CountMismatchedEdges(TArrayView<const int32> Occupancy) const;
+
+    // Hücre başına yönlendirilmiş kenar kelimeleri üzerinde doğrulayıcı - solver çıktısı da bununla doğrulanır
+    static int32 CountMismatchedEdges(int32 Width, int32 Height, const uint32* CellEdges);
+
+private:
+    int32 Width;
+    int32 Height;
+    TArray<uint32> PieceEdges;
+};
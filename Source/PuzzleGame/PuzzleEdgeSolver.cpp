@@ -0,0 +1,417 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "PuzzleEdgeSolver.h"
+#include "Math/VectorRegister.h"
+#include "Async/ParallelFor.h"
+#include "Misc/ScopeLock.h"
+
+namespace PuzzleEdgeSearch
+{
+    // Kök alt ağaç sayısı - boşta kalan worker'lar kalan alt ağaçları alır
+    constexpr int32 TargetFrontierSize = 1024;
+
+    constexpr uint64 NodeCheckInterval = 4096;
+
+    // Dolgu yönlendirmesinin kenarları - kuzey rengi hiçbir hücrenin istediğiyle eşleşmez
+    constexpr uint32 PaddingEdges = FPuzzleEdgeSet::EmptyCell;
+}
+
+// Tüm thread'lerce paylaşılan arama durumu
+struct FPuzzleEdgeSolver::FSharedSearch
+{
+    TArrayView<const int32> LockedPieces;
+
+    std::atomic<bool> bStop{ false };
+    std::atomic<bool> bFound{ false };
+    std::atomic<uint64> Nodes{ 0 };
+
+    const std::atomic<bool>* bCancelled = nullptr;
+    uint64 MaxNodes = 0;
+
+    FCriticalSection SolutionLock;
+    TArray<int32> Solution;
+
+    int32 GetLockedPiece(int32 GridID) const
+    {
+        return LockedPieces.Num() > 0 ? LockedPieces[GridID] : INDEX_NONE;
+    }
+};
+
+// Bir kök alt ağacını arayan worker'ın yerel board'u
+struct FPuzzleEdgeSolver::FThreadContext
+{
+    FSharedSearch* Shared = nullptr;
+
+    // Yerleştirilen hücrelerin döndürülmüş kenarları ve yönlendirme indeksleri
+    TArray<uint32> CellEdges;
+    TArray<int32> CellOrientations;
+
+    // Son eleman dolgu parçası - hep kullanılmış
+    TArray<bool> UsedPieces;
+
+    // Hücreye geri izlemeyle dönüldüyse sıradaki aday CellOrientations'tan sonra aranır
+    TArray<bool> RetryCells;
+
+    uint64 Nodes = 0;
+    bool bStopped = false;
+
+    bool CheckStop()
+    {
+        const uint64 Total = Shared->Nodes.fetch_add(PuzzleEdgeSearch::NodeCheckInterval, std::memory_order_relaxed) + PuzzleEdgeSearch::NodeCheckInterval;
+        if (Shared->bStop.load(std::memory_order_relaxed) ||
+            (Shared->bCancelled && Shared->bCancelled->load(std::memory_order_relaxed)) ||
+            (Shared->MaxNodes > 0 && Total > Shared->MaxNodes))
+        {
+            Shared->bStop.store(true, std::memory_order_relaxed);
+            bStopped = true;
+        }
+        return bStopped;
+    }
+};
+
+FPuzzleEdgeSolver::FPuzzleEdgeSolver(TSharedRef<const FPuzzleEdgeSet, ESPMode::ThreadSafe> InEdgeSet, bool bInAllowRotation)
+    : EdgeSet(MoveTemp(InEdgeSet))
+    , bAllowRotation(bInAllowRotation)
+    , Width(EdgeSet->GetWidth())
+    , Height(EdgeSet->GetHeight())
+    , NumCells(EdgeSet->GetWidth() * EdgeSet->GetHeight())
+{
+    constexpr int32 NumBuckets = 16 << 8;
+    TArray<TArray<FOrientation>> Buckets;
+    Buckets.SetNum(NumBuckets);
+
+    for (int32 PieceID = 0; PieceID < NumCells; PieceID++)
+    {
+        const uint32 Edges = EdgeSet->GetPieceEdges(PieceID);
+        for (int32 Rotation = 0; Rotation < (bAllowRotation ? 4 : 1); Rotation++)
+        {
+            // Simetrik parçanın aynı kenarlı dönüşleri tekrar aranmaz
+            const uint32 Rotated = FPuzzleEdgeSet::Rotate(Edges, Rotation);
+            bool bDuplicate = false;
+            for (int32 Previous = 0; Previous < Rotation; Previous++)
+            {
+                bDuplicate |= FPuzzleEdgeSet::Rotate(Edges, Previous) == Rotated;
+            }
+            if (bDuplicate)
+            {
+                continue;
+            }
+
+            uint32 BorderSides = 0;
+            for (int32 Side = 0; Side < 4; Side++)
+            {
+                BorderSides |= FPuzzleEdgeSet::GetColour(Rotated, Side) == FPuzzleEdgeSet::FrameColour ? (1u << Side) : 0u;
+            }
+            Buckets[GetBucketKey(BorderSides, FPuzzleEdgeSet::GetColour(Rotated, FPuzzleEdgeSet::West))].Add({ PieceID, (uint8)Rotation });
+        }
+    }
+
+    BucketStarts.SetNumZeroed(NumBuckets);
+    BucketEnds.SetNumZeroed(NumBuckets);
+    for (int32 Key = 0; Key < NumBuckets; Key++)
+    {
+        BucketStarts[Key] = Orientations.Num();
+        for (const FOrientation& Orientation : Buckets[Key])
+        {
+            Orientations.Add(Orientation);
+            OrientationEdges.Add(FPuzzleEdgeSet::Rotate(EdgeSet->GetPieceEdges(Orientation.PieceID), Orientation.Rotation));
+        }
+
+        // 4'lü vektör yükleri bucket dışına taşmasın
+        while ((Orientations.Num() - BucketStarts[Key]) % 4 != 0)
+        {
+            Orientations.Add({ NumCells, 0 });
+            OrientationEdges.Add(PuzzleEdgeSearch::PaddingEdges);
+        }
+        BucketEnds[Key] = Orientations.Num();
+    }
+}
+
+uint32 FPuzzleEdgeSolver::GetCellBorderSides(int32 GridID) const
+{
+    const int32 Col = GridID % Width;
+    const int32 Row = GridID / Width;
+    return (Row == 0 ? 1u << FPuzzleEdgeSet::North : 0u) |
+        (Col == Width - 1 ? 1u << FPuzzleEdgeSet::East : 0u) |
+        (Row == Height - 1 ? 1u << FPuzzleEdgeSet::South : 0u) |
+        (Col == 0 ? 1u << FPuzzleEdgeSet::West : 0u);
+}
+
+bool FPuzzleEdgeSolver::LockedPieceFits(const FThreadContext& Context, int32 GridID, int32 PieceID) const
+{
+    const uint32 Edges = EdgeSet->GetPieceEdges(PieceID);
+    uint32 PieceBorder = 0;
+    for (int32 Side = 0; Side < 4; Side++)
+    {
+        PieceBorder |= FPuzzleEdgeSet::GetColour(Edges, Side) == FPuzzleEdgeSet::FrameColour ? (1u << Side) : 0u;
+    }
+    if (PieceBorder != GetCellBorderSides(GridID))
+    {
+        return false;
+    }
+
+    if (GridID % Width > 0 &&
+        FPuzzleEdgeSet::GetColour(Edges, FPuzzleEdgeSet::West) != FPuzzleEdgeSet::GetColour(Context.CellEdges[GridID - 1], FPuzzleEdgeSet::East))
+    {
+        return false;
+    }
+    return GridID < Width ||
+        FPuzzleEdgeSet::GetColour(Edges, FPuzzleEdgeSet::North) == FPuzzleEdgeSet::GetColour(Context.CellEdges[GridID - Width], FPuzzleEdgeSet::South);
+}
+
+int32 FPuzzleEdgeSolver::FindNextFit(const FThreadContext& Context, int32 GridID, int32 FromIndex) const
+{
+    const uint8 WestColour = GridID % Width > 0
+        ? FPuzzleEdgeSet::GetColour(Context.CellEdges[GridID - 1], FPuzzleEdgeSet::East)
+        : FPuzzleEdgeSet::FrameColour;
+    const int32 Key = GetBucketKey(GetCellBorderSides(GridID), WestColour);
+
+    // Kuzey komşusunun güney rengi - ilk satırda bucket çerçeveyi zaten garanti eder
+    const bool bCheckNorth = GridID >= Width;
+    const VectorRegister4Int WantNorth = VectorIntSet1(bCheckNorth ? FPuzzleEdgeSet::GetColour(Context.CellEdges[GridID - Width], FPuzzleEdgeSet::South) : 0);
+    const VectorRegister4Int NorthMask = VectorIntSet1(bCheckNorth ? 0xFF : 0);
+
+    // Bucket başları 4'ün katı - ilk gruptaki FromIndex öncesi adaylar maskelenir
+    const int32 Start = FMath::Max(FromIndex, BucketStarts[Key]);
+    const uint32* Candidates = OrientationEdges.GetData();
+    for (int32 Base = Start & ~3; Base < BucketEnds[Key]; Base += 4)
+    {
+        const VectorRegister4Int Mismatch = VectorIntAnd(VectorIntXor(VectorIntLoad(Candidates + Base), WantNorth), NorthMask);
+        uint32 Fits = (uint32)VectorMaskBits(VectorCastIntToFloat(VectorIntCompareEQ(Mismatch, GlobalVectorConstants::IntZero)));
+        if (Base < Start)
+        {
+            Fits &= ~0u << (Start - Base);
+        }
+
+        while (Fits != 0)
+        {
+            const int32 Index = Base + (int32)FMath::CountTrailingZeros(Fits);
+            Fits &= Fits - 1;
+
+            // Dolgu yönlendirmesinin parçası hep kullanılmış sayılır
+            if (!Context.UsedPieces[Orientations[Index].PieceID])
+            {
+                return Index;
+            }
+        }
+    }
+    return INDEX_NONE;
+}
+
+void FPuzzleEdgeSolver::PlaceCell(FThreadContext& Context, int32 GridID, int32 OrientationIndex) const
+{
+    Context.CellEdges[GridID] = OrientationEdges[OrientationIndex];
+    Context.CellOrientations[GridID] = OrientationIndex;
+    Context.UsedPieces[Orientations[OrientationIndex].PieceID] = true;
+}
+
+bool FPuzzleEdgeSolver::SearchCells(FThreadContext& Context, int32 StartGridID) const
+{
+    int32 GridID = StartGridID;
+    if (GridID < NumCells)
+    {
+        Context.RetryCells[GridID] = false;
+    }
+
+    while (GridID < NumCells)
+    {
+        const bool bRetry = Context.RetryCells[GridID];
+        Context.RetryCells[GridID] = true;
+
+        if (!bRetry && ++Context.Nodes % PuzzleEdgeSearch::NodeCheckInterval == 0 && Context.CheckStop())
+        {
+            return false;
+        }
+
+        bool bPlaced = false;
+        const int32 LockedPiece = Context.Shared->GetLockedPiece(GridID);
+        if (LockedPiece >= 0)
+        {
+            // Kilitli hücrenin tek adayı var - geri dönüldüyse alternatif yok
+            if (!bRetry && LockedPieceFits(Context, GridID, LockedPiece))
+            {
+                Context.CellEdges[GridID] = EdgeSet->GetPieceEdges(LockedPiece);
+                Context.CellOrientations[GridID] = INDEX_NONE;
+                bPlaced = true;
+            }
+        }
+        else
+        {
+            int32 FromIndex = INDEX_NONE;
+            if (bRetry)
+            {
+                // Batı/kuzey komşuları değişmedi, aynı bucket'ta kalınır
+                FromIndex = Context.CellOrientations[GridID] + 1;
+                Context.UsedPieces[Orientations[FromIndex - 1].PieceID] = false;
+            }
+
+            const int32 Index = FindNextFit(Context, GridID, FromIndex);
+            if (Index != INDEX_NONE)
+            {
+                PlaceCell(Context, GridID, Index);
+                bPlaced = true;
+            }
+        }
+
+        if (bPlaced)
+        {
+            GridID++;
+            if (GridID < NumCells)
+            {
+                Context.RetryCells[GridID] = false;
+            }
+        }
+        else if (GridID == StartGridID)
+        {
+            return false;
+        }
+        else
+        {
+            GridID--;
+        }
+    }
+    return true;
+}
+
+bool FPuzzleEdgeSolver::Solve(TArrayView<const int32> LockedPieces, FPuzzleEdgeSolution& OutSolution,
+    const std::atomic<bool>* bCancelled, uint64 MaxNodes) const
+{
+    const double StartTime = FPlatformTime::Seconds();
+    OutSolution = FPuzzleEdgeSolution();
+
+    if (NumCells == 0 || (LockedPieces.Num() != 0 && LockedPieces.Num() != NumCells))
+    {
+        return false;
+    }
+
+    FSharedSearch Shared;
+    Shared.LockedPieces = LockedPieces;
+    Shared.bCancelled = bCancelled;
+    Shared.MaxNodes = MaxNodes;
+
+    // Kilitli parçalar serbest hücrelerde aranmaz - aynı parça iki kez kilitlenemez
+    TArray<bool> InitialUsed;
+    InitialUsed.Init(false, NumCells + 1);
+    InitialUsed[NumCells] = true;
+    for (const int32 PieceID : LockedPieces)
+    {
+        if (PieceID >= NumCells || (PieceID >= 0 && InitialUsed[PieceID]))
+        {
+            return false;
+        }
+        if (PieceID >= 0)
+        {
+            InitialUsed[PieceID] = true;
+        }
+    }
+
+    // Önek: hücre başına yönlendirme indeksi, kilitli hücrede INDEX_NONE
+    auto InitContext = [this, &Shared, &InitialUsed](FThreadContext& Context, const TArray<int32>& Prefix)
+    {
+        Context.Shared = &Shared;
+        Context.CellEdges.Init(FPuzzleEdgeSet::EmptyCell, NumCells);
+        Context.CellOrientations.Init(INDEX_NONE, NumCells);
+        Context.UsedPieces = InitialUsed;
+        Context.RetryCells.Init(false, NumCells);
+        for (int32 GridID = 0; GridID < Prefix.Num(); GridID++)
+        {
+            if (Prefix[GridID] >= 0)
+            {
+                PlaceCell(Context, GridID, Prefix[GridID]);
+            }
+            else
+            {
+                Context.CellEdges[GridID] = EdgeSet->GetPieceEdges(Shared.GetLockedPiece(GridID));
+            }
+        }
+    };
+
+    // İlk hücreler genişlikte açılır - her düğüm dolu bir önek
+    TArray<TArray<int32>> Frontier;
+    Frontier.AddDefaulted();
+    int32 FrontierDepth = 0;
+    for (; FrontierDepth < NumCells && Frontier.Num() > 0 && Frontier.Num() < PuzzleEdgeSearch::TargetFrontierSize; FrontierDepth++)
+    {
+        TArray<TArray<int32>> NextLevel;
+        for (const TArray<int32>& Prefix : Frontier)
+        {
+            FThreadContext Context;
+            InitContext(Context, Prefix);
+
+            const int32 LockedPiece = Shared.GetLockedPiece(FrontierDepth);
+            if (LockedPiece >= 0)
+            {
+                if (LockedPieceFits(Context, FrontierDepth, LockedPiece))
+                {
+                    NextLevel.Add_GetRef(Prefix).Add(INDEX_NONE);
+                }
+                continue;
+            }
+
+            for (int32 Index = FindNextFit(Context, FrontierDepth, INDEX_NONE); Index != INDEX_NONE;
+                Index = FindNextFit(Context, FrontierDepth, Index + 1))
+            {
+                NextLevel.Add_GetRef(Prefix).Add(Index);
+            }
+        }
+        Frontier = MoveTemp(NextLevel);
+    }
+
+    ParallelFor(Frontier.Num(), [this, &Shared, &Frontier, &InitContext, FrontierDepth](int32 FrontierIndex)
+    {
+        if (Shared.bStop.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        FThreadContext Context;
+        InitContext(Context, Frontier[FrontierIndex]);
+
+        const bool bFound = SearchCells(Context, FrontierDepth);
+        Shared.Nodes.fetch_add(Context.Nodes % PuzzleEdgeSearch::NodeCheckInterval, std::memory_order_relaxed);
+
+        if (bFound)
+        {
+            FScopeLock Lock(&Shared.SolutionLock);
+            if (!Shared.bFound.load())
+            {
+                Shared.Solution = MoveTemp(Context.CellOrientations);
+                Shared.bFound.store(true);
+                Shared.bStop.store(true);
+            }
+        }
+    }, EParallelForFlags::Unbalanced);
+
+    OutSolution.NodesExpanded = Shared.Nodes.load();
+    OutSolution.Seconds = FPlatformTime::Seconds() - StartTime;
+
+    if (!Shared.bFound.load())
+    {
+        return false;
+    }
+
+    OutSolution.Pieces.SetNumUninitialized(NumCells);
+    OutSolution.Rotations.SetNumZeroed(NumCells);
+    TArray<uint32> SolvedEdges;
+    SolvedEdges.SetNumUninitialized(NumCells);
+    for (int32 GridID = 0; GridID < NumCells; GridID++)
+    {
+        const int32 OrientationIndex = Shared.Solution[GridID];
+        if (OrientationIndex >= 0)
+        {
+            OutSolution.Pieces[GridID] = Orientations[OrientationIndex].PieceID;
+            OutSolution.Rotations[GridID] = Orientations[OrientationIndex].Rotation;
+            SolvedEdges[GridID] = OrientationEdges[OrientationIndex];
+        }
+        else
+        {
+            OutSolution.Pieces[GridID] = Shared.GetLockedPiece(GridID);
+            SolvedEdges[GridID] = EdgeSet->GetPieceEdges(OutSolution.Pieces[GridID]);
+        }
+    }
+
+    // Çözüm bağımsız SIMD doğrulayıcıdan geçmeli
+    OutSolution.bSolved = FPuzzleEdgeSet::CountMismatchedEdges(Width, Height, SolvedEdges.GetData()) == 0;
+    ensureMsgf(OutSolution.bSolved, TEXT("Edge solver produced a board with mismatched edges"));
+    return OutSolution.bSolved;
+}
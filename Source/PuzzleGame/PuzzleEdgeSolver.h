@@ -0,0 +1,84 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PuzzleEdgeSet.h"
+#include <atomic>
+
+// Tek bir edge-matching çözümü
+struct PUZZLEGAME_API FPuzzleEdgeSolution
+{
+    bool bSolved = false;
+
+    // GridID -> PieceID ve saat yönünde çeyrek tur sayısı
+    TArray<int32> Pieces;
+    TArray<uint8> Rotations;
+
+    uint64 NodesExpanded = 0;
+    double Seconds = 0.0;
+};
+
+/**
+ * Backtracking solver for FPuzzleEdgeSet boards. Cells are filled in scan-line order;
+ * every oriented piece is bucketed by which of its sides are frame and by its west colour,
+ * so a cell only scans the bucket that already satisfies its border and west neighbour.
+ * The bucket is padded to groups of four and the north colour is checked four candidates
+ * at a time with VectorRegister4Int compares.
+ *
+ * The first cells are expanded breadth-first into a frontier of partial boards that
+ * ParallelFor(Unbalanced) searches on all cores; the first worker to complete a board
+ * stops the others. The depth-first search keeps its position in the per-cell orientation
+ * indices instead of recursing, so board size is not bounded by worker stack depth.
+ */
+class PUZZLEGAME_API FPuzzleEdgeSolver
+{
+public:
+    FPuzzleEdgeSolver(TSharedRef<const FPuzzleEdgeSet, ESPMode::ThreadSafe> InEdgeSet, bool bInAllowRotation);
+
+    // LockedPieces[GridID] >= 0: hücre bu parçayla (döndürülmeden) sabit; boş dizi hepsi serbest
+    // bCancelled/MaxNodes ile sınırlı arama (ipucu); sınır aşılırsa false
+    bool Solve(TArrayView<const int32> LockedPieces, FPuzzleEdgeSolution& OutSolution,
+        const std::atomic<bool>* bCancelled = nullptr, uint64 MaxNodes = 0) const;
+
+    const FPuzzleEdgeSet& GetEdgeSet() const { return *EdgeSet; }
+    bool AllowsRotation() const { return bAllowRotation; }
+
+private:
+    // Tek yönlendirilmiş parça - kenarları OrientationEdges'de aynı indekste
+    struct FOrientation
+    {
+        int32 PieceID;
+        uint8 Rotation;
+    };
+
+    struct FSharedSearch;
+    struct FThreadContext;
+
+    // Kenar bayrakları (bit = çerçeve tarafı) ve batı rengi -> bucket
+    static int32 GetBucketKey(uint32 BorderSides, uint8 WestColour) { return (int32)(BorderSides << 8) | WestColour; }
+    uint32 GetCellBorderSides(int32 GridID) const;
+
+    // Kilitli parça döndürülmeden hücrenin çerçevesine ve batı/kuzey komşusuna uyuyor mu
+    bool LockedPieceFits(const FThreadContext& Context, int32 GridID, int32 PieceID) const;
+
+    // Hücrenin bucket'ında FromIndex'ten (INDEX_NONE: bucket başı) itibaren kuzeye uyan ve kullanılmamış ilk yönlendirme
+    int32 FindNextFit(const FThreadContext& Context, int32 GridID, int32 FromIndex) const;
+
+    void PlaceCell(FThreadContext& Context, int32 GridID, int32 OrientationIndex) const;
+
+    // StartGridID'den itibaren tüm hücreleri doldurur - özyinelemesiz geri izleme
+    bool SearchCells(FThreadContext& Context, int32 StartGridID) const;
+
+    TSharedRef<const FPuzzleEdgeSet, ESPMode::ThreadSafe> EdgeSet;
+    bool bAllowRotation;
+    int32 Width;
+    int32 Height;
+    int32 NumCells;
+
+    // Bucket'lar ardışık, her biri 4'ün katına dolgulu; dolgu PieceID == NumCells (hep kullanılmış)
+    TArray<uint32> OrientationEdges;
+    TArray<FOrientation> Orientations;
+    TArray<int32> BucketStarts;
+    TArray<int32> BucketEnds;
+};
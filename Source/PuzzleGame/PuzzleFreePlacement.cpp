@@ -0,0 +1,176 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "PuzzleFreePlacement.h"
+
+void FPuzzleFreePlacement::Init(int32 InWidth, int32 InHeight, EPuzzleGridTopology Topology, TArray<FVector2D> InCorrectPositions, float PieceSpacing)
+{
+    Reset();
+
+    Width = InWidth;
+    Height = InHeight;
+    CorrectPositions = MoveTemp(InCorrectPositions);
+    const int32 NumPieces = CorrectPositions.Num();
+    check(NumPieces == Width * Height);
+
+    NeighbourStarts.SetNumUninitialized(NumPieces + 1);
+    float MaxNeighbourDistance = 0.0f;
+    DispatchGridTopology(Topology, [&](auto Policy)
+    {
+        using FTopology = decltype(Policy);
+        for (int32 PieceID = 0; PieceID < NumPieces; PieceID++)
+        {
+            NeighbourStarts[PieceID] = Neighbours.Num();
+            ForEachGridNeighbour<FTopology>(PieceID, Width, Height, [&](int32 Direction, int32 Neighbour)
+            {
+                Neighbours.Add(Neighbour);
+                MaxNeighbourDistance = FMath::Max(MaxNeighbourDistance, (float)FVector2D::Distance(CorrectPositions[PieceID], CorrectPositions[Neighbour]));
+            });
+        }
+    });
+    NeighbourStarts[NumPieces] = Neighbours.Num();
+    NeighbourRadius = MaxNeighbourDistance;
+
+    GroupIDs.SetNumUninitialized(NumPieces);
+    Groups.SetNum(NumPieces);
+    for (int32 PieceID = 0; PieceID < NumPieces; PieceID++)
+    {
+        GroupIDs[PieceID] = PieceID;
+        Groups[PieceID].Add(PieceID);
+    }
+
+    Index.Init(PieceSpacing, NumPieces);
+}
+
+void FPuzzleFreePlacement::Reset()
+{
+    Width = 0;
+    Height = 0;
+    NeighbourRadius = 0.0f;
+    CorrectPositions.Empty();
+    NeighbourStarts.Empty();
+    Neighbours.Empty();
+    GroupIDs.Empty();
+    Groups.Empty();
+    Index.Reset();
+}
+
+void FPuzzleFreePlacement::SetPiecePosition(int32 PieceID, const FVector2D& Position)
+{
+    Index.Update(PieceID, Position);
+}
+
+bool FPuzzleFreePlacement::AreNeighbours(int32 PieceA, int32 PieceB) const
+{
+    for (int32 Slot = NeighbourStarts[PieceA]; Slot < NeighbourStarts[PieceA + 1]; Slot++)
+    {
+        if (Neighbours[Slot] == PieceB)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool FPuzzleFreePlacement::FindBestSnap(const TArray<int32>& Members, int32 GroupID, float SnapDistance, int32& OutPiece, FVector2D& OutOffset) const
+{
+    double BestErrorSquared = (double)SnapDistance * SnapDistance;
+    OutPiece = INDEX_NONE;
+
+    for (const int32 Member : Members)
+    {
+        if (!Index.Contains(Member))
+        {
+            continue;
+        }
+
+        // Komşu merkezleri en fazla NeighbourRadius + SnapDistance uzakta olabilir
+        const FVector2D MemberPosition = Index.GetPosition(Member);
+        Index.ForEachInRadius(MemberPosition, NeighbourRadius + SnapDistance, [&](int32 Candidate, const FVector2D& CandidatePosition)
+        {
+            if (GroupIDs[Candidate] == GroupID || !AreNeighbours(Member, Candidate))
+            {
+                return;
+            }
+
+            // Adayın bu üyeye göre olması gereken yeri
+            const FVector2D Expected = MemberPosition + (CorrectPositions[Candidate] - CorrectPositions[Member]);
+            const double ErrorSquared = FVector2D::DistSquared(CandidatePosition, Expected);
+            if (ErrorSquared <= BestErrorSquared)
+            {
+                BestErrorSquared = ErrorSquared;
+                OutPiece = Candidate;
+                OutOffset = CandidatePosition - Expected;
+            }
+        });
+    }
+    return OutPiece != INDEX_NONE;
+}
+
+void FPuzzleFreePlacement::MoveGroup(int32 GroupID, const FVector2D& Delta, TArray<int32>& OutMovedPieces)
+{
+    for (const int32 Member : Groups[GroupID])
+    {
+        if (Index.Contains(Member))
+        {
+            Index.Update(Member, Index.GetPosition(Member) + Delta);
+            OutMovedPieces.Add(Member);
+        }
+    }
+}
+
+int32 FPuzzleFreePlacement::MergeGroups(int32 GroupA, int32 GroupB)
+{
+    // Küçük grup büyüğe taşınır - parça başına en fazla log N taşıma
+    if (Groups[GroupA].Num() < Groups[GroupB].Num())
+    {
+        Swap(GroupA, GroupB);
+    }
+
+    for (const int32 Member : Groups[GroupB])
+    {
+        GroupIDs[Member] = GroupA;
+    }
+    Groups[GroupA].Append(Groups[GroupB]);
+    Groups[GroupB].Empty();
+    return GroupA;
+}
+
+bool FPuzzleFreePlacement::SnapGroup(int32 PieceID, float SnapDistance, TArray<int32>& OutMovedPieces)
+{
+    if (!Index.Contains(PieceID))
+    {
+        return false;
+    }
+
+    int32 GroupID = GroupIDs[PieceID];
+    bool bMerged = false;
+    int32 Target = INDEX_NONE;
+    FVector2D Offset = FVector2D::ZeroVector;
+
+    // Sadece yeri değişen parçaların komşuluğu değişir - duran büyük grup her bırakmada taranmaz
+    TArray<int32> MovedMembers = Groups[GroupID];
+
+    while (FindBestSnap(MovedMembers, GroupID, SnapDistance, Target, Offset))
+    {
+        // İlk oturtmada bırakılan grup hareket eder, sonrakilerde iki gruptan küçüğü hizalanır
+        const int32 TargetGroupID = GroupIDs[Target];
+        if (!bMerged)
+        {
+            MoveGroup(GroupID, Offset, OutMovedPieces);
+        }
+        else if (Groups[TargetGroupID].Num() <= Groups[GroupID].Num())
+        {
+            MoveGroup(TargetGroupID, -Offset, OutMovedPieces);
+            MovedMembers.Append(Groups[TargetGroupID]);
+        }
+        else
+        {
+            MoveGroup(GroupID, Offset, OutMovedPieces);
+            MovedMembers.Append(Groups[GroupID]);
+        }
+
+        GroupID = MergeGroups(GroupID, TargetGroupID);
+        bMerged = true;
+    }
+    return bMerged;
+}
@@ -0,0 +1,75 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PuzzleGridTopology.h"
+#include "PuzzleSpatialGrid.h"
+
+/**
+ * Board state of the free-placement mode. Pieces lie anywhere on the table and are not
+ * tied to grid cells; a piece joins a group only when it is released next to one of its
+ * true neighbours (as defined by the grid topology) at the right relative offset.
+ *
+ * Piece positions live in an FPuzzleSpatialGrid with one piece spacing per cell, so the
+ * release-time query for nearby pieces touches a constant number of cells regardless of
+ * how many loose pieces are on the table. Groups merge smaller-into-larger.
+ */
+class PUZZLEGAME_API FPuzzleFreePlacement
+{
+public:
+    // CorrectPositions: çözülmüş düzendeki parça merkezleri - komşu ofsetleri bunlardan alınır
+    void Init(int32 InWidth, int32 InHeight, EPuzzleGridTopology Topology, TArray<FVector2D> InCorrectPositions, float PieceSpacing);
+    void Reset();
+
+    bool IsActive() const { return CorrectPositions.Num() > 0; }
+    int32 GetNumPieces() const { return CorrectPositions.Num(); }
+    int32 GetNumPlaced() const { return Index.Num(); }
+
+    bool IsPlaced(int32 PieceID) const { return Index.Contains(PieceID); }
+    FVector2D GetPiecePosition(int32 PieceID) const { return Index.GetPosition(PieceID); }
+
+    // Tek parçayı masaya koyar veya taşır - grubunu bozmaz, çağıran grubun tamamını taşımalı
+    void SetPiecePosition(int32 PieceID, const FVector2D& Position);
+
+    // Grubun tüm üyeleri (parçanın kendisi dahil)
+    const TArray<int32>& GetGroupMembers(int32 PieceID) const { return Groups[GroupIDs[PieceID]]; }
+
+    // Tüm parçalar masada ve tek grupta
+    bool IsComplete() const { return GetNumPlaced() == GetNumPieces() && GetGroupMembers(0).Num() == GetNumPieces(); }
+
+    // Bırakılan grubu en yakın gerçek komşusuna oturtur; ardından hizalı diğer komşu grupları bu gruba çeker
+    // Konumu değişen parçalar OutMovedPieces'e eklenir (tekrar edebilir), en az bir birleşme olduysa true
+    bool SnapGroup(int32 PieceID, float SnapDistance, TArray<int32>& OutMovedPieces);
+
+    template<typename FuncType>
+    void ForEachPieceInRadius(const FVector2D& Center, float Radius, FuncType&& Func) const
+    {
+        Index.ForEachInRadius(Center, Radius, Forward<FuncType>(Func));
+    }
+
+private:
+    bool AreNeighbours(int32 PieceA, int32 PieceB) const;
+
+    // Members'tan birine komşu, GroupID dışındaki en iyi hizalanmış parça - hata SnapDistance içinde
+    bool FindBestSnap(const TArray<int32>& Members, int32 GroupID, float SnapDistance, int32& OutPiece, FVector2D& OutOffset) const;
+
+    void MoveGroup(int32 GroupID, const FVector2D& Delta, TArray<int32>& OutMovedPieces);
+    int32 MergeGroups(int32 GroupA, int32 GroupB);
+
+    int32 Width = 0;
+    int32 Height = 0;
+    float NeighbourRadius = 0.0f;
+
+    TArray<FVector2D> CorrectPositions;
+
+    // Çözümdeki komşuluk - CSR
+    TArray<int32> NeighbourStarts;
+    TArray<int32> Neighbours;
+
+    // PieceID -> grup, grup -> üyeler (sadece yaşayan gruplar dolu)
+    TArray<int32> GroupIDs;
+    TArray<TArray<int32>> Groups;
+
+    FPuzzleSpatialGrid Index;
+};
@@ -0,0 +1,115 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "PuzzleFrozenBatch.h"
+#include "PuzzlePiece.h"
+#include "Engine/StaticMesh.h"
+
+APuzzleFrozenBatch::APuzzleFrozenBatch()
+{
+    PrimaryActorTick.bCanEverTick = false;
+
+    RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("BatchRoot"));
+
+    AtlasMaterial = nullptr;
+}
+
+void APuzzleFrozenBatch::SetAtlasMaterial(UMaterialInterface* InAtlasMaterial)
+{
+    AtlasMaterial = InAtlasMaterial;
+
+    for (UInstancedStaticMeshComponent* Component : BatchComponents)
+    {
+        if (Component)
+        {
+            Component->SetMaterial(0, AtlasMaterial);
+        }
+    }
+}
+
+UInstancedStaticMeshComponent* APuzzleFrozenBatch::FindOrCreateComponent(UStaticMesh* Mesh, int32& OutComponentIndex)
+{
+    if (const int32* ExistingIndex = ComponentLookup.Find(Mesh))
+    {
+        OutComponentIndex = *ExistingIndex;
+        return BatchComponents[OutComponentIndex];
+    }
+
+    UInstancedStaticMeshComponent* Component = NewObject<UInstancedStaticMeshComponent>(this);
+    Component->SetupAttachment(RootComponent);
+    Component->SetStaticMesh(Mesh);
+    Component->SetMaterial(0, AtlasMaterial);
+
+    // Donmuş parçalar seçilemez ve hareket etmez
+    Component->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    Component->NumCustomDataFloats = 2;
+    Component->RegisterComponent();
+
+    OutComponentIndex = BatchComponents.Add(Component);
+    FreeInstances.AddDefaulted();
+    ComponentLookup.Add(Mesh, OutComponentIndex);
+    return Component;
+}
+
+bool APuzzleFrozenBatch::AddPiece(int32 PieceID, const APuzzlePiece* Piece, int32 SourceCol, int32 SourceRow)
+{
+    const UStaticMeshComponent* PieceMesh = Piece ? Piece->GetPieceMesh() : nullptr;
+    if (!AtlasMaterial || !PieceMesh || !PieceMesh->GetStaticMesh() || PieceInstances.Contains(PieceID))
+    {
+        return false;
+    }
+
+    // Parça materyalleri parça başına farklı - ortak atlas materyali resim hücresini custom data'dan seçer
+    int32 ComponentIndex = INDEX_NONE;
+    UInstancedStaticMeshComponent* Component = FindOrCreateComponent(PieceMesh->GetStaticMesh(), ComponentIndex);
+
+    const FTransform InstanceTransform = PieceMesh->GetComponentTransform();
+
+    int32 InstanceIndex = INDEX_NONE;
+    if (FreeInstances[ComponentIndex].Num() > 0)
+    {
+        InstanceIndex = FreeInstances[ComponentIndex].Pop(EAllowShrinking::No);
+        Component->UpdateInstanceTransform(InstanceIndex, InstanceTransform, true, false, true);
+    }
+    else
+    {
+        InstanceIndex = Component->AddInstance(InstanceTransform, true);
+    }
+
+    Component->SetCustomDataValue(InstanceIndex, 0, SourceCol, false);
+    Component->SetCustomDataValue(InstanceIndex, 1, SourceRow, true);
+
+    PieceInstances.Add(PieceID, { ComponentIndex, InstanceIndex });
+    return true;
+}
+
+bool APuzzleFrozenBatch::RemovePiece(int32 PieceID)
+{
+    FFrozenInstance Instance;
+    if (!PieceInstances.RemoveAndCopyValue(PieceID, Instance))
+    {
+        return false;
+    }
+
+    // Sıfır ölçekle gizle, sonraki AddPiece yeniden kullanır
+    UInstancedStaticMeshComponent* Component = BatchComponents[Instance.ComponentIndex];
+    Component->UpdateInstanceTransform(Instance.InstanceIndex, FTransform(FQuat::Identity, FVector::ZeroVector, FVector::ZeroVector), true, true, true);
+    FreeInstances[Instance.ComponentIndex].Add(Instance.InstanceIndex);
+    return true;
+}
+
+void APuzzleFrozenBatch::ClearBatch()
+{
+    for (UInstancedStaticMeshComponent* Component : BatchComponents)
+    {
+        if (Component)
+        {
+            Component->ClearInstances();
+        }
+    }
+
+    for (TArray<int32>& Free : FreeInstances)
+    {
+        Free.Reset();
+    }
+    PieceInstances.Reset();
+}
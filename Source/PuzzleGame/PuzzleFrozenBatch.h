@@ -0,0 +1,62 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "PuzzleFrozenBatch.generated.h"
+
+class APuzzlePiece;
+
+/**
+ * Static instanced stand-ins for pieces that are settled for good. One instanced
+ * component per piece mesh, all sharing a single atlas material that picks the
+ * piece's image cell from per-instance custom data (source column, row); no tick,
+ * no collision.
+ */
+UCLASS()
+class PUZZLEGAME_API APuzzleFrozenBatch : public AActor
+{
+    GENERATED_BODY()
+
+public:
+    APuzzleFrozenBatch();
+
+    // Tüm component'lerin ortak materyali - yoksa AddPiece başarısız olur
+    void SetAtlasMaterial(UMaterialInterface* InAtlasMaterial);
+
+    bool HasAtlasMaterial() const { return AtlasMaterial != nullptr; }
+
+    // Parçanın mevcut görünümünü batch'e kopyalar, actor'ü serbest bırakmak çağıranın işi
+    bool AddPiece(int32 PieceID, const APuzzlePiece* Piece, int32 SourceCol, int32 SourceRow);
+
+    bool RemovePiece(int32 PieceID);
+
+    void ClearBatch();
+
+    int32 GetFrozenCount() const { return PieceInstances.Num(); }
+
+protected:
+    UPROPERTY()
+    TArray<UInstancedStaticMeshComponent*> BatchComponents;
+
+    UPROPERTY()
+    UMaterialInterface* AtlasMaterial;
+
+private:
+    struct FFrozenInstance
+    {
+        int32 ComponentIndex;
+        int32 InstanceIndex;
+    };
+
+    UInstancedStaticMeshComponent* FindOrCreateComponent(UStaticMesh* Mesh, int32& OutComponentIndex);
+
+    TMap<int32, FFrozenInstance> PieceInstances;
+
+    // Component başına boşaltılmış instance'lar - indeksler kaymasın diye silinmez, gizlenir
+    TArray<TArray<int32>> FreeInstances;
+
+    TMap<UStaticMesh*, int32> ComponentLookup;
+};
@@ -22,7 +22,12 @@ public class PuzzleGame : ModuleRules
 
         PrivateDependencyModuleNames.AddRange(new string[] {
     "RenderCore",
-    "RHI"
+    "RHI",
+    "Json",
+    "JsonUtilities",
+    "MeshDescription",
+    "StaticMeshDescription",
+    "ImageWrapper"
 });
 
         PrivateDependencyModuleNames.AddRange(new string[] {  });
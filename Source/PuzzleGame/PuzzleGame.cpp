@@ -3,4 +3,6 @@
 #include "PuzzleGame.h"
 #include "Modules/ModuleManager.h"
 
+DEFINE_LOG_CATEGORY(LogPuzzleGame);
+
 IMPLEMENT_PRIMARY_GAME_MODULE( FDefaultGameModuleImpl, PuzzleGame, "PuzzleGame" );
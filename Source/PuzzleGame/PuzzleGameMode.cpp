@@ -10,14 +10,26 @@
 #include "UObject/ConstructorHelpers.h"
 #include "Kismet/GameplayStatics.h"
 #include "Engine/StaticMesh.h"
+#include "Engine/Texture2D.h"
 #include "Engine/StaticMeshActor.h"
 #include "Components/StaticMeshComponent.h"
 #include "Materials/MaterialInstanceDynamic.h"
 #include "DrawDebugHelpers.h"
+#include "Misc/Paths.h"
+#include "Misc/DateTime.h"
+#include "PuzzleGame.h"
+#include "GameFramework/PlayerController.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "MeshDescription.h"
+#include "PuzzleImageImport.h"
+#include "IImageWrapperModule.h"
+#include "Modules/ModuleManager.h"
 
 APuzzleGameMode::APuzzleGameMode()
 {
-    PrimaryActorTick.bCanEverTick = false;
+    // Tick: work scheduler, toplu board delta ve istatistik yayını
+    PrimaryActorTick.bCanEverTick = true;
 
     // Varsayılan değerler
     GameTime = 0.0f;
@@ -28,6 +40,7 @@ APuzzleGameMode::APuzzleGameMode()
     PuzzleWidth = 3;
     PuzzleHeight = 3;
     PieceSpacing = 260.0f; 
+    GridTopology = EPuzzleGridTopology::Square;
     PuzzleStartLocation = FVector(-260.0f, -260.0f, 0.0f); 
 
     // Default puzzle piece class blueprint'te set edilecek
@@ -41,6 +54,115 @@ APuzzleGameMode::APuzzleGameMode()
     bShowGridMarkers = false;
     GridMarkerScale = 0.8f;
     GridMarkerColor = FLinearColor(0.0f, 1.0f, 0.0f, 0.3f);
+
+    // Replay kaydı
+    bRecordReplay = true;
+    ReplayMaxPreplacedCells = 4096;
+
+    // Chunk streaming
+    bEnableChunkStreaming = true;
+    StreamingMinCells = 4096;
+    ChunkSize = 16;
+    StreamingMarginChunks = 1;
+    StreamingUpdateInterval = 0.2f;
+    MaxStreamingViewDistance = 50000.0f;
+    ChunkProxyMaterial = nullptr;
+    BoardProxy = nullptr;
+    bEnableTileLOD = true;
+    TileLODMaterial = nullptr;
+    TileLODMaxVisibleCells = 4096;
+    TileLODMaxTextureSize = 4096;
+    MaxTileBakesPerUpdate = 8;
+    BoardTiles = nullptr;
+    bTileLODZoomedOut = false;
+
+    // Indirection renderer
+    bUseIndirectionRenderer = false;
+    IndirectionBoardMaterial = nullptr;
+    BoardSourceImage = nullptr;
+    IndirectionBoard = nullptr;
+
+    // Work scheduler
+    WorkBudgetMs = 2.0f;
+    GridMarkersPerStep = 64;
+    ActorDestroysPerStep = 64;
+    bFirePerPieceEvents = true;
+    bHintRequested = false;
+    bUseImageCompatibilityHints = false;
+    CompatibilityNeighbours = 8;
+    bPrePlaceShuffledBoard = false;
+    CurrentShuffleSeed = 0;
+
+    // Sliding-tile modu
+    bSlidingTileMode = false;
+    SlidingAutoSolveInterval = 0.15f;
+    SlidingHintMaxNodes = 50000000;
+    SlidingBlankGridID = -1;
+    SlidingAutoSolveIndex = 0;
+
+    // Edge-matching modu
+    bEdgeMatchingMode = false;
+    EdgeMatchingColours = 6;
+    EdgeMatchingHintMaxNodes = 20000000;
+    EdgeFrameColour = FLinearColor(0.05f, 0.05f, 0.05f);
+    EdgeMatchScore = 0;
+
+    // Serbest yerleştirme modu
+    bFreePlacementMode = false;
+    FreeSnapDistance = 25.0f;
+
+    // Prosedürel parça şekilleri
+    bProceduralPieceShapes = false;
+    PieceShapeVariants = 2;
+    PieceShapeThickness = 10.0f;
+    PieceShapeCurveSegments = 8;
+    PieceShapeMeshKey = FVector::ZeroVector;
+    CellShapeMesh = nullptr;
+    CellShapeMeshKey = FVector::ZeroVector;
+    PieceMaterialMargin = 0.0f;
+
+    // Resim içe aktarma
+    ImportedPieceMaterial = nullptr;
+    ImportMaxTileSize = 512;
+    ImportThumbnailSize = 64;
+    ImportMemoryBudgetMB = 256;
+
+    bReplayActive = true;
+    LastOperationSwapGain = 0;
+    ProductiveMoveGain = 0;
+
+    // Idle throttling
+    bEnableIdleThrottling = true;
+    IdleDelaySeconds = 30.0f;
+    IdleMaxFPS = 10.0f;
+    bIsIdle = false;
+    bStatsDirty = false;
+    SavedMaxFPS = 0.0f;
+    LastActivityTime = 0.0;
+    IdleStateChangeTime = 0.0;
+    AccumulatedIdleSeconds = 0.0;
+    AccumulatedActiveSeconds = 0.0;
+    IdleEnterCount = 0;
+
+    // Settled parçaları dondur
+    bFreezeSettledPieces = true;
+    FrozenBatchMaterial = nullptr;
+    FrozenBatch = nullptr;
+    FrozenPieceCount = 0;
+
+    // Heatmap overlay
+    bShowHeatmapOverlay = false;
+    HeatmapEmptyColor = FLinearColor(0.0f, 0.0f, 0.0f, 0.0f);
+    HeatmapWrongColor = FLinearColor(1.0f, 0.1f, 0.1f, 0.45f);
+    HeatmapCorrectColor = FLinearColor(0.1f, 1.0f, 0.2f, 0.35f);
+    HeatmapRecentColor = FLinearColor(1.0f, 0.85f, 0.1f, 0.6f);
+    HeatmapRecentSeconds = 2.0f;
+    HeatmapOverlay = nullptr;
+    RecentHeatmapHead = 0;
+
+    CorrectCellCount = 0;
+    ChunksX = 0;
+    ChunksY = 0;
     
     // Gridler için debug küpleri
     static ConstructorHelpers::FObjectFinder<UStaticMesh> CubeMeshFinder(TEXT("/Engine/BasicShapes/Cube"));
@@ -77,839 +199,3523 @@ void APuzzleGameMode::BeginPlay()
 
     // Puzzle'ı başlat
     InitializePuzzle();
+
+    // Idle kontrolü - saniyede bir, etkileşim anında ExitIdle çağrılır
+    LastActivityTime = FPlatformTime::Seconds();
+    IdleStateChangeTime = LastActivityTime;
+    if (bEnableIdleThrottling)
+    {
+        GetWorldTimerManager().SetTimer(IdleCheckTimerHandle, this, &APuzzleGameMode::CheckIdle, 1.0f, true);
+    }
+
+    // Chunk streaming - küçük board'larda timer hiçbir şey yapmadan döner
+    if (StreamingUpdateInterval > 0.0f)
+    {
+        GetWorldTimerManager().SetTimer(StreamingTimerHandle, this, &APuzzleGameMode::UpdateChunkStreaming, StreamingUpdateInterval, true);
+    }
 }
 
 void APuzzleGameMode::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
     // Timer sıfırla
     GetWorldTimerManager().ClearTimer(GameTimerHandle);
-    
-    Super::EndPlay(EndPlayReason);
-}
-
-void APuzzleGameMode::StartGame()
-{
-    if (CurrentGameState == EPuzzleGameState::NotStarted ||
-        CurrentGameState == EPuzzleGameState::Completed)
+    GetWorldTimerManager().ClearTimer(StreamingTimerHandle);
+    GetWorldTimerManager().ClearTimer(HeatmapTimerHandle);
+    GetWorldTimerManager().ClearTimer(FreezeTimerHandle);
+    GetWorldTimerManager().ClearTimer(IdleCheckTimerHandle);
+
+    // Worker'daki arama snapshot pin'ini bırakana kadar bekle
+    bHintRequested = false;
+    HintEngine.Cancel(true);
+
+    // Otomatik çözüm task'ı game mode'a dönmeden bitsin
+    StopSlidingAutoSolve();
+    if (SlidingSolveTask.IsValid())
     {
-        // Oyunu sıfırla
-        GameTime = 0.0f;
-        TotalMoves = 0;
-        CurrentGameState = EPuzzleGameState::InProgress;
+        SlidingSolveTask.Wait();
+    }
 
-        // Timer'ı başlat
-        GetWorldTimerManager().SetTimer(GameTimerHandle, this, &APuzzleGameMode::OnTimerTick, 1.0f, true);
+    StopImageCompatibilityBuild();
+    if (ImageCompatibilityTask.IsValid())
+    {
+        ImageCompatibilityTask.Wait();
+    }
 
-        // İstatistikleri güncelle
-        OnStatsUpdated.Broadcast(GameTime, TotalMoves);
+    StopPieceShapeBuild();
+    if (PieceShapeTask.IsValid())
+    {
+        PieceShapeTask.Wait();
+    }
 
+    CancelImageImport();
+    if (ImageImportTask.IsValid())
+    {
+        ImageImportTask.Wait();
     }
-    else if (CurrentGameState == EPuzzleGameState::Paused)
+
+    // Engine geneli frame rate sınırını geri bırak
+    if (bIsIdle)
     {
-        ResumeGame();
+        ExitIdle();
     }
+
+    UE_LOG(LogPuzzleGame, Log, TEXT("Session idle %.0fs / active %.0fs over %d idle periods"),
+        GetIdleTimeSeconds(), GetActiveTimeSeconds(), IdleEnterCount);
+
+    // Görsel işler dünya ile birlikte gider, kayıt gibi kalıcı işler tamamlanır
+    WorkScheduler.CancelByName(TEXT("GridVisualization"));
+    WorkScheduler.CancelByName(TEXT("RetireActors"));
+    WorkScheduler.CancelByName(TEXT("PieceTray"));
+    WorkScheduler.RunAll();
+
+    const FPuzzleWorkStats& WorkStats = WorkScheduler.GetStats();
+    UE_LOG(LogPuzzleGame, Log, TEXT("Work scheduler: %d jobs, peak depth %d, max frame %.2fms, %d frames over budget, deferred avg %.1fms max %.1fms"),
+        WorkStats.CompletedJobs, WorkStats.PeakQueueDepth, WorkStats.MaxFrameMs, WorkStats.FramesOverBudget,
+        WorkStats.AverageDeferredMs, WorkStats.MaxDeferredMs);
+    
+    Super::EndPlay(EndPlayReason);
 }
 
-void APuzzleGameMode::PauseGame()
+void APuzzleGameMode::Tick(float DeltaSeconds)
 {
-    if (CurrentGameState == EPuzzleGameState::InProgress)
-    {
-        CurrentGameState = EPuzzleGameState::Paused;
-        GetWorldTimerManager().ClearTimer(GameTimerHandle);
+    Super::Tick(DeltaSeconds);
+
+    FlushBoardChanges();
 
+    if (bStatsDirty && !bIsIdle)
+    {
+        FlushStatsUpdate();
     }
-}
 
-void APuzzleGameMode::ResumeGame()
-{
-    if (CurrentGameState == EPuzzleGameState::Paused)
+    if (WorkScheduler.GetQueueDepth() > 0)
     {
-        CurrentGameState = EPuzzleGameState::InProgress;
-        GetWorldTimerManager().SetTimer(GameTimerHandle, this, &APuzzleGameMode::OnTimerTick, 1.0f, true);
+        WorkScheduler.RunFrame(WorkBudgetMs);
 
+        // Bekleyen iş varken idle'a geçme - düşük frame rate işleri uzatır
+        NotifyPlayerActivity();
     }
 }
 
-void APuzzleGameMode::RestartGame()
+void APuzzleGameMode::FlushBoardChanges()
 {
-    // Mevcut puzzle parçalarını temizle
-    for (APuzzlePiece* Piece : PuzzlePieces)
+    if (!BoardJournal.HasChanges())
     {
-        if (IsValid(Piece))
-        {
-            Piece->Destroy();
-        }
+        return;
     }
-    PuzzlePieces.Empty();
 
-    // Timerı durdur
-    GetWorldTimerManager().ClearTimer(GameTimerHandle);
+    BoardJournal.Flush(GridOccupancy, PendingDelta);
+    PendingDelta.CorrectCellCount = CorrectCellCount;
+    PendingDelta.TotalCellCount = GridOccupancy.Num();
 
-    // Puzzleı yeniden başlat
-    InitializePuzzle();
-    StartGame();
+    // Dinleyiciler delta ile tutarlı snapshot'ı hemen alabilsin
+    BoardSnapshots.Publish(PendingDelta.ChangedGridIDs, GridOccupancy, CorrectCellCount, BoardHash.Get());
+
+    // Eski board'un ipucu geçersiz - aramayı yeni snapshot ile baştan başlat
+    if (bHintRequested)
+    {
+        StartHintSearch();
+    }
+
+    OnBoardChangedNative.Broadcast(PendingDelta);
+    OnBoardChanged.Broadcast(PendingDelta);
 }
 
-void APuzzleGameMode::IncrementMoveCount()
+void APuzzleGameMode::FlushStatsUpdate()
 {
-    if (CurrentGameState == EPuzzleGameState::InProgress)
-    {
-        TotalMoves++;
-        OnStatsUpdated.Broadcast(GameTime, TotalMoves);
+    bStatsDirty = false;
+    OnStatsUpdated.Broadcast(GameTime, TotalMoves);
+}
 
-        // Her hamle sonrası oyunun bitip bitmediğini kontrol et
-        if (CheckGameCompletion())
-        {
-            OnGameComplete();
-        }
-    }
+void APuzzleGameMode::RequestHint()
+{
+    bHintRequested = true;
+    StartHintSearch();
 }
 
-APuzzlePiece* APuzzleGameMode::SpawnPuzzlePiece(int32 PieceID, FVector SpawnLocation)
+void APuzzleGameMode::ClearHint()
 {
-    
-    // piece ID null mu
-    if (PieceID < 0 || PieceID >= PuzzlePieces.Num())
+    bHintRequested = false;
+    CurrentHint = FPuzzleHint();
+    HintEngine.Cancel();
+}
+
+void APuzzleGameMode::StartHintSearch()
+{
+    CurrentHint = FPuzzleHint();
+
+    // Sliding modunda takas ipucu anlamsız - optimal çözümün ilk hamlesi önerilir
+    FPuzzleHintEngine::FSearchFunction SearchFunction;
+    if (bSlidingTileMode && SlidingSolver.IsValid())
     {
-        return nullptr;
+        SearchFunction = [Solver = SlidingSolver, MaxNodes = (uint64)FMath::Max<int64>(0, SlidingHintMaxNodes)](
+            const FPuzzleBoardSnapshot& Snapshot, const std::atomic<bool>& bCancelled)
+        {
+            return FPuzzleHintEngine::FindSlidingHint(*Solver, Snapshot, bCancelled, MaxNodes);
+        };
     }
-    
-    int32 ExistingCount = 0;
-    for (int32 i = 0; i < PuzzlePieces.Num(); i++)
+    else if (EdgeSolver.IsValid())
     {
-        if (PuzzlePieces[i] != nullptr)
+        // Edge-matching modunda PieceID == GridID tek çözüm değil - solver'ın bulduğu çözüme yönlendirilir
+        SearchFunction = [Solver = EdgeSolver, MaxNodes = (uint64)FMath::Max<int64>(0, EdgeMatchingHintMaxNodes)](
+            const FPuzzleBoardSnapshot& Snapshot, const std::atomic<bool>& bCancelled)
         {
-            ExistingCount++;
-        }
+            return FPuzzleHintEngine::FindEdgeMatchingHint(*Solver, Snapshot, bCancelled, MaxNodes);
+        };
     }
-    
-    if (!PuzzlePieceClass)
+    else if (bUseImageCompatibilityHints && ImageCompatibility.IsValid())
     {
-        return nullptr;
+        SearchFunction = [Compatibility = ImageCompatibility](const FPuzzleBoardSnapshot& Snapshot, const std::atomic<bool>& bCancelled)
+        {
+            return FPuzzleHintEngine::FindCompatibilityHint(*Compatibility, Snapshot, bCancelled);
+        };
     }
-    
-    //İstenilen parça eşsiz mi
-    if (PieceID >= 0 && PieceID < PuzzlePieces.Num() && PuzzlePieces[PieceID])
+
+    TWeakObjectPtr<APuzzleGameMode> WeakThis(this);
+    HintEngine.Start(BoardSnapshots.Acquire(), [WeakThis](const FPuzzleHint& Hint)
     {
-        
-        // Musait listedeyse spawn et
-        if (AvailablePieceIDs.Contains(PieceID))
+        if (APuzzleGameMode* GameMode = WeakThis.Get())
         {
+            GameMode->OnHintFound(Hint);
         }
-        
-        // Still remove from available list if it somehow exists there
-        RemovePieceFromAvailable(PieceID);
-        
-        // This is a bug - we shouldn't be trying to spawn an already existing piece
-        // Return null instead of the existing piece to prevent moving it
-        return nullptr;
+    }, MoveTemp(SearchFunction));
+}
+
+FPuzzleHint APuzzleGameMode::FindFittingPiece(int32 GridID) const
+{
+    FPuzzleHint Hint;
+    if (!ImageCompatibility.IsValid() || !GridOccupancy.IsValidIndex(GridID) || GridOccupancy.Num() != ImageCompatibility->GetNumPieces())
+    {
+        return Hint;
     }
 
-    FActorSpawnParameters SpawnParams;
-    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+    float Score = 0.0f;
+    float Confidence = 0.0f;
+    if (ImageCompatibility->FindBestPieceForCell(GridOccupancy, GridID, Hint.PieceID, Score, Confidence))
+    {
+        Hint.bValid = true;
+        Hint.FromGridID = PieceGridIDs.IsValidIndex(Hint.PieceID) ? PieceGridIDs[Hint.PieceID] : -1;
+        Hint.ToGridID = GridID;
+        Hint.BoardVersion = (int64)BoardSnapshots.GetPublishedVersion();
+    }
+    return Hint;
+}
 
-    APuzzlePiece* NewPiece = GetWorld()->SpawnActor<APuzzlePiece>(PuzzlePieceClass, SpawnLocation, FRotator::ZeroRotator, SpawnParams);
+void APuzzleGameMode::BuildImageCompatibility()
+{
+    StopImageCompatibilityBuild();
+    ImageCompatibility.Reset();
 
-    if (NewPiece)
+    // Parçalar resmin dikdörtgen dilimleri - kare grid dışında kenar komşuluğu farklı
+    if (GridTopology != EPuzzleGridTopology::Square)
     {
-        NewPiece->SetPieceID(PieceID);
-        
-        // Bu parça için doğru pozisyon hesabı
-        int32 Row = PieceID / PuzzleWidth;
-        int32 Col = PieceID % PuzzleWidth;
-        FVector CorrectPosition = PuzzleStartLocation + FVector(
-            Col * PieceSpacing,
-            Row * PieceSpacing,
-            0.0f
-        );
-        NewPiece->SetCorrectPosition(CorrectPosition);
-        
-        // Set material et
-        if (PieceMaterials.IsValidIndex(PieceID))
-        {
-            NewPiece->SetPieceMaterial(PieceMaterials[PieceID]);
-        }
-        else
-        {
-        }
-        
-        // Daha sonra ulaşmak için Array e ekle
-        if (PieceID >= 0 && PieceID < PuzzlePieces.Num())
-        {
-            PuzzlePieces[PieceID] = NewPiece;
-        }
+        UE_LOG(LogPuzzleGame, Warning, TEXT("Image compatibility hints require a square grid"));
+        return;
+    }
 
-        // Musait listesinden çıkar
-        RemovePieceFromAvailable(PieceID);
-        
-        // Grid yerini güncelle
-        int32 SpawnGridID = GetGridIDFromPosition(SpawnLocation);
-        if (SpawnGridID >= 0)
+    TArray<FColor> Pixels;
+    int32 ImageWidth = 0;
+    int32 ImageHeight = 0;
+    if (!ReadSourceImagePixels(Pixels, ImageWidth, ImageHeight))
+    {
+        return;
+    }
+
+    TSharedPtr<std::atomic<bool>, ESPMode::ThreadSafe> Cancel = MakeShared<std::atomic<bool>, ESPMode::ThreadSafe>(false);
+    ImageCompatibilityCancel = Cancel;
+
+    TWeakObjectPtr<APuzzleGameMode> WeakThis(this);
+    ImageCompatibilityTask = UE::Tasks::Launch(UE_SOURCE_LOCATION,
+        [WeakThis, Pixels = MoveTemp(Pixels), ImageWidth, ImageHeight, Width = PuzzleWidth, Height = PuzzleHeight,
+        Neighbours = CompatibilityNeighbours, Cancel]()
+    {
+        const double StartTime = FPlatformTime::Seconds();
+        TSharedPtr<const FPuzzleEdgeCompatibility, ESPMode::ThreadSafe> Table =
+            FPuzzleEdgeCompatibility::Build(Pixels, ImageWidth, ImageHeight, Width, Height, Neighbours, Cancel.Get());
+        const double Seconds = FPlatformTime::Seconds() - StartTime;
+
+        if (!Table.IsValid() || Cancel->load(std::memory_order_relaxed))
         {
-            UpdateGridOccupancy(SpawnGridID, NewPiece);
+            return;
         }
-        
-        // Hamle sayısını artır
-        //IncrementMoveCount();
-        
-        // İlk parça yerleştirildiğinde timerı başlat
-        if (CurrentGameState == EPuzzleGameState::NotStarted)
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, Table, Cancel, Seconds]()
         {
-            StartGame();
-        }
-        
-    }
+            APuzzleGameMode* GameMode = WeakThis.Get();
+            if (GameMode && !Cancel->load(std::memory_order_relaxed))
+            {
+                GameMode->ImageCompatibility = Table;
+                GameMode->ImageCompatibilityCancel.Reset();
+                UE_LOG(LogPuzzleGame, Log, TEXT("Image compatibility for %d pieces built in %.2fs (%d neighbours per side, %.1f KB)"),
+                    Table->GetNumPieces(), Seconds, Table->GetNumNeighbours(), Table->GetAllocatedSize() / 1024.0);
 
-    return NewPiece;
+                // Bekleyen ipucu artık tabloyu kullanabilir
+                if (GameMode->bHintRequested)
+                {
+                    GameMode->StartHintSearch();
+                }
+            }
+        });
+    });
 }
 
-bool APuzzleGameMode::CheckGameCompletion()
+void APuzzleGameMode::StopImageCompatibilityBuild()
 {
-    if (PuzzlePieces.Num() == 0)
-        return false;
-    
-    // Dogru pozisyon kontrolü
-    int32 SpawnedPieces = 0;
-    int32 CorrectPieces = 0;
-    
-    for (APuzzlePiece* Piece : PuzzlePieces)
+    if (ImageCompatibilityCancel.IsValid())
     {
-        if (IsValid(Piece))
-        {
-            SpawnedPieces++;
-            if (Piece->IsInCorrectPosition())
-            {
-                CorrectPieces++;
-            }
-        }
+        ImageCompatibilityCancel->store(true, std::memory_order_relaxed);
+        ImageCompatibilityCancel.Reset();
     }
-    
-    // Doğru pozisyonlardaysa oyunu bitir
-    if (SpawnedPieces == PuzzlePieces.Num() && CorrectPieces == PuzzlePieces.Num())
+}
+
+void APuzzleGameMode::BuildPieceShapes()
+{
+    StopPieceShapeBuild();
+    PieceShapes.Reset();
+
+    // Çıkıntılar kare hücrenin dört kenarına göre tanımlı
+    if (GridTopology != EPuzzleGridTopology::Square)
     {
-        return true;
+        UE_LOG(LogPuzzleGame, Warning, TEXT("Procedural piece shapes require a square grid"));
+        return;
     }
 
-    return false;
-}
+    // Mesh'ler hücre boyutunda kurulur - ölçüler değiştiyse cache'teki mesh'ler kullanılamaz
+    const FVector MeshKey(PieceSpacing, PieceShapeThickness, PieceShapeCurveSegments);
+    if (!MeshKey.Equals(PieceShapeMeshKey))
+    {
+        PieceShapeMeshes.Empty();
+        PieceShapeMeshKey = MeshKey;
+    }
 
+    const TSharedRef<const FPuzzlePieceShapeSet, ESPMode::ThreadSafe> Shapes =
+        FPuzzlePieceShapeSet::Generate(PuzzleWidth, PuzzleHeight, PieceShapeVariants, CurrentShuffleSeed);
+    PieceShapes = Shapes;
 
-//Dogru konulan parça sayısı
-int32 APuzzleGameMode::GetCompletedPiecesCount() const
-{
-    int32 Count = 0;
-    for (const APuzzlePiece* Piece : PuzzlePieces)
+    TArray<uint32> Signatures;
+    Shapes->GetUniqueSignatures(Signatures);
+    const int32 UniqueCount = Signatures.Num();
+    Signatures.RemoveAll([this](uint32 Signature) { return PieceShapeMeshes.Contains(Signature); });
+
+    UE_LOG(LogPuzzleGame, Log, TEXT("Piece shapes: %d pieces, %d unique shapes, %d cached"),
+        Shapes->GetNumPieces(), UniqueCount, UniqueCount - Signatures.Num());
+    if (Signatures.Num() == 0)
     {
-        if (IsValid(Piece) && Piece->IsInCorrectPosition())
-        {
-            Count++;
-        }
+        return;
     }
-    return Count;
-}
 
+    TSharedPtr<std::atomic<bool>, ESPMode::ThreadSafe> Cancel = MakeShared<std::atomic<bool>, ESPMode::ThreadSafe>(false);
+    PieceShapeCancel = Cancel;
 
-// İlerleme yüzdesi
-float APuzzleGameMode::GetCompletionPercentage() const
-{
-    if (PuzzlePieces.Num() == 0)
-        return 0.0f;
+    TWeakObjectPtr<APuzzleGameMode> WeakThis(this);
+    PieceShapeTask = UE::Tasks::Launch(UE_SOURCE_LOCATION,
+        [WeakThis, Signatures = MoveTemp(Signatures), Size = PieceSpacing, Thickness = PieceShapeThickness,
+        Segments = PieceShapeCurveSegments, Cancel]()
+    {
+        // Çıktı dizisi önceden boyutlanır - her iş kendi elemanına yazar
+        const double StartTime = FPlatformTime::Seconds();
+        TSharedPtr<TArray<FMeshDescription>, ESPMode::ThreadSafe> Descriptions = MakeShared<TArray<FMeshDescription>, ESPMode::ThreadSafe>();
+        Descriptions->SetNum(Signatures.Num());
+        ParallelFor(Signatures.Num(), [&](int32 Index)
+        {
+            if (!Cancel->load(std::memory_order_relaxed))
+            {
+                FPuzzlePieceShapeSet::BuildMeshDescription(Signatures[Index], Size, Thickness, Segments, (*Descriptions)[Index]);
+            }
+        });
+        const double Seconds = FPlatformTime::Seconds() - StartTime;
 
-    return (float)GetCompletedPiecesCount() / (float)PuzzlePieces.Num() * 100.0f;
-}
+        if (Cancel->load(std::memory_order_relaxed))
+        {
+            return;
+        }
 
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, Signatures, Descriptions, Cancel, Seconds]()
+        {
+            APuzzleGameMode* GameMode = WeakThis.Get();
+            if (!GameMode || Cancel->load(std::memory_order_relaxed))
+            {
+                return;
+            }
 
-//Oyun bitiminde sayacı durdur
-void APuzzleGameMode::OnGameComplete()
-{
-    CurrentGameState = EPuzzleGameState::Completed;
-    GetWorldTimerManager().ClearTimer(GameTimerHandle);
+            UE_LOG(LogPuzzleGame, Log, TEXT("Triangulated %d piece shapes in %.1fms"), Signatures.Num(), Seconds * 1000.0);
 
-    // Completion event'ini broadcast et
-    OnGameCompleted.Broadcast(GameTime, TotalMoves);
+            // UStaticMesh sadece game thread'de kurulur - her adımda bir mesh, frame bütçesi aşılmaz
+            int32 NextIndex = 0;
+            GameMode->WorkScheduler.Enqueue(TEXT("PieceShapeMeshes"), EPuzzleWorkPriority::Normal,
+                [GameMode, Signatures, Descriptions, Cancel, NextIndex]() mutable
+            {
+                if (Cancel->load(std::memory_order_relaxed))
+                {
+                    return true;
+                }
 
-}
+                const FMeshDescription& Description = (*Descriptions)[NextIndex];
+                if (Description.Vertices().Num() > 0)
+                {
+                    GameMode->PieceShapeMeshes.Add(Signatures[NextIndex], GameMode->CreatePieceShapeMesh(Description));
+                }
+                else
+                {
+                    UE_LOG(LogPuzzleGame, Warning, TEXT("Piece shape %08x could not be triangulated"), Signatures[NextIndex]);
+                }
 
+                // Açıklama bellekte tutulmaz
+                (*Descriptions)[NextIndex].Empty();
+                if (++NextIndex < Signatures.Num())
+                {
+                    return false;
+                }
 
-//Timer 
-void APuzzleGameMode::OnTimerTick()
+                // Hepsi hazır - sahnedeki actor'ler yeni mesh'lerine geçer, sonradan gelenler ConfigurePieceActor'da
+                GameMode->PieceShapeCancel.Reset();
+                for (int32 PieceID = 0; PieceID < GameMode->PuzzlePieces.Num(); PieceID++)
+                {
+                    if (IsValid(GameMode->PuzzlePieces[PieceID]))
+                    {
+                        GameMode->ApplyPieceShape(GameMode->PuzzlePieces[PieceID], PieceID);
+                    }
+                }
+                return true;
+            });
+        });
+    });
+}
+
+void APuzzleGameMode::StopPieceShapeBuild()
 {
-    if (CurrentGameState == EPuzzleGameState::InProgress)
+    if (PieceShapeCancel.IsValid())
     {
-        GameTime += 1.0f;
-        OnStatsUpdated.Broadcast(GameTime, TotalMoves);
+        PieceShapeCancel->store(true, std::memory_order_relaxed);
+        PieceShapeCancel.Reset();
     }
+    WorkScheduler.CancelByName(TEXT("PieceShapeMeshes"));
 }
 
+UStaticMesh* APuzzleGameMode::CreatePieceShapeMesh(const FMeshDescription& Description)
+{
+    UStaticMesh* Mesh = NewObject<UStaticMesh>(this, NAME_None, RF_Transient);
+    Mesh->GetStaticMaterials().Add(FStaticMaterial(nullptr, FPuzzlePieceShapeSet::MaterialSlotName, FPuzzlePieceShapeSet::MaterialSlotName));
+
+    // Hızlı kurulum: LOD/lightmap UV üretimi yok - tıklama trace'i actor'ün collision box'ına gider
+    UStaticMesh::FBuildMeshDescriptionsParams Params;
+    Params.bFastBuild = true;
+    Params.bBuildSimpleCollision = false;
+    Params.bAllowCpuAccess = false;
+    Mesh->BuildFromMeshDescriptions({ &Description }, Params);
+    return Mesh;
+}
 
-//Puzzle ı başlat
-void APuzzleGameMode::InitializePuzzle()
+UStaticMesh* APuzzleGameMode::GetPieceShapeMesh(int32 PieceID) const
 {
-    CurrentGameState = EPuzzleGameState::NotStarted;
+    if (!PieceShapes.IsValid() || PieceID < 0 || PieceID >= PieceShapes->GetNumPieces())
+    {
+        return nullptr;
+    }
+    return PieceShapeMeshes.FindRef(PieceShapes->GetSignature(PieceID));
+}
 
-    
-    // Önceki parçaları sil
-    for (int32 i = 0; i < PuzzlePieces.Num(); i++)
+void APuzzleGameMode::ApplyPieceShape(APuzzlePiece* Piece, int32 PieceID) const
+{
+    // Mesh yoksa (mod kapalı ya da henüz kurulmadı) Blueprint mesh'i geri gelir - havuzdan gelen actor önceki board'un şeklini taşımasın
+    if (GridTopology != EPuzzleGridTopology::Square)
     {
-        if (PuzzlePieces[i])
-        {
-            PuzzlePieces[i]->Destroy();
-            PuzzlePieces[i] = nullptr;
-        }
+        Piece->SetShapeMesh(CellShapeMesh);
+        return;
     }
+    Piece->SetShapeMesh(GetPieceShapeMesh(PieceID));
+}
 
-    // Boundary oluştur
-    CalculateBoundary();
+void APuzzleGameMode::BuildCellShapeMesh()
+{
+    const FVector MeshKey((float)GridTopology, PieceSpacing, PieceShapeThickness);
+    if (IsValid(CellShapeMesh) && MeshKey.Equals(CellShapeMeshKey))
+    {
+        return;
+    }
 
-    // Debug
-    if (bShowGridMarkers)
+    FMeshDescription Description;
+    if (!FPuzzlePieceShapeSet::BuildCellMeshDescription(GridTopology, PieceSpacing, PieceShapeThickness, Description))
     {
-        CreateGridVisualization();
+        UE_LOG(LogPuzzleGame, Warning, TEXT("Cell shape mesh could not be triangulated"));
+        CellShapeMesh = nullptr;
+        return;
     }
+    CellShapeMesh = CreatePieceShapeMesh(Description);
+    CellShapeMeshKey = MeshKey;
+}
 
-    // Puzzle parçalarıını oluştur
-    // UI tarafından oluşturulacak
-    int32 TotalPieces = PuzzleWidth * PuzzleHeight;
+void APuzzleGameMode::ImportPuzzleImage(const FString& FilePath)
+{
+    CancelImageImport();
+
+    // Dilimler dikdörtgen hücreler - kare grid dışında hücre şekli farklı
+    if (GridTopology != EPuzzleGridTopology::Square)
+    {
+        UE_LOG(LogPuzzleGame, Warning, TEXT("Image import requires a square grid"));
+        OnImageImported.Broadcast(false);
+        return;
+    }
+    if (!ImportedPieceMaterial)
+    {
+        UE_LOG(LogPuzzleGame, Warning, TEXT("Image import needs ImportedPieceMaterial with a PieceTexture parameter"));
+        OnImageImported.Broadcast(false);
+        return;
+    }
+
+    // Modül yüklemesi game thread'de - wrapper'lar worker'da oluşturulabilir
+    IImageWrapperModule* ImageWrapperModule = &FModuleManager::LoadModuleChecked<IImageWrapperModule>(FName("ImageWrapper"));
+
+    FPuzzleImageImportSettings Settings;
+    Settings.GridWidth = PuzzleWidth;
+    Settings.GridHeight = PuzzleHeight;
+    Settings.MaxTileSize = ImportMaxTileSize;
+    Settings.ThumbnailSize = ImportThumbnailSize;
+    // Şekilli parça mesh'leri dilimi çıkıntı payıyla örnekler, Blueprint mesh'i tam hücreyle
+    Settings.TileMargin = bProceduralPieceShapes ? FPuzzlePieceShapeSet::TileMargin : 0.0f;
+    Settings.MemoryBudgetBytes = (int64)ImportMemoryBudgetMB * 1024 * 1024;
+
+    TSharedPtr<std::atomic<bool>, ESPMode::ThreadSafe> Cancel = MakeShared<std::atomic<bool>, ESPMode::ThreadSafe>(false);
+    ImageImportCancel = Cancel;
+
+    const double StartTime = FPlatformTime::Seconds();
+    TWeakObjectPtr<APuzzleGameMode> WeakThis(this);
+    ImageImportTask = UE::Tasks::Launch(UE_SOURCE_LOCATION,
+        [WeakThis, FilePath, Settings, ImageWrapperModule, Cancel, StartTime]()
+    {
+        TSharedPtr<FPuzzleImageImportResult, ESPMode::ThreadSafe> Result = MakeShared<FPuzzleImageImportResult, ESPMode::ThreadSafe>();
+        const bool bImported = FPuzzleImageImport::Import(FilePath, *ImageWrapperModule, Settings, *Result, Cancel.Get());
+        if (Cancel->load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, FilePath, Settings, Result, bImported, Cancel, StartTime]()
+        {
+            APuzzleGameMode* GameMode = WeakThis.Get();
+            if (!GameMode || Cancel->load(std::memory_order_relaxed))
+            {
+                return;
+            }
+
+            // Dilimler içe aktarma başladığındaki grid'e göre
+            if (!bImported || GameMode->PuzzleWidth != Settings.GridWidth || GameMode->PuzzleHeight != Settings.GridHeight)
+            {
+                UE_LOG(LogPuzzleGame, Warning, TEXT("Image import of %s failed: %s"), *FilePath,
+                    bImported ? TEXT("grid size changed during import") : *Result->Error);
+                GameMode->ImageImportCancel.Reset();
+                GameMode->OnImageImported.Broadcast(false);
+                return;
+            }
+
+            const FPuzzleImageImportStats& Stats = Result->Stats;
+            UE_LOG(LogPuzzleGame, Log, TEXT("Imported %s: %dx%d decoded, 1/%d -> %dx%d, %d tiles of %d px, peak %.1f MB"),
+                *FilePath, Stats.DecodedWidth, Stats.DecodedHeight, Stats.Downscale, Result->ImageWidth, Result->ImageHeight,
+                Result->Tiles.Num(), Result->Tiles.Num() > 0 ? Result->Tiles[0].Size : 0, Stats.PeakBytes / (1024.0 * 1024.0));
+            UE_LOG(LogPuzzleGame, Log, TEXT("  read %.1fms, decode %.1fms, downscale %.1fms, slice %.1fms"),
+                Stats.ReadSeconds * 1000.0, Stats.DecodeSeconds * 1000.0, Stats.DownscaleSeconds * 1000.0, Stats.SliceSeconds * 1000.0);
+
+            GameMode->PendingImportMaterials.Reset(Result->Tiles.Num());
+            GameMode->PendingImportThumbnails.Reset(Result->Tiles.Num());
+
+            // Texture'lar sadece game thread'de - her adımda bir parça, yüklenen dilimin CPU kopyası hemen bırakılır
+            int32 NextIndex = 0;
+            double UploadSeconds = 0.0;
+            GameMode->WorkScheduler.Enqueue(TEXT("ImageImport"), EPuzzleWorkPriority::Normal,
+                [GameMode, Result, Cancel, StartTime, NextIndex, UploadSeconds, Margin = Settings.TileMargin]() mutable
+            {
+                if (Cancel->load(std::memory_order_relaxed))
+                {
+                    return true;
+                }
+
+                const double StepStart = FPlatformTime::Seconds();
+                if (NextIndex < Result->Tiles.Num())
+                {
+                    UMaterialInstanceDynamic* Material = UMaterialInstanceDynamic::Create(GameMode->ImportedPieceMaterial, GameMode);
+                    Material->SetTextureParameterValue(TEXT("PieceTexture"), GameMode->CreateImportTexture(Result->Tiles[NextIndex]));
+                    GameMode->PendingImportMaterials.Add(Material);
+                    GameMode->PendingImportThumbnails.Add(GameMode->CreateImportTexture(Result->Thumbnails[NextIndex]));
+
+                    Result->Tiles[NextIndex].Pixels.Empty();
+                    Result->Thumbnails[NextIndex].Pixels.Empty();
+                    NextIndex++;
+                    UploadSeconds += FPlatformTime::Seconds() - StepStart;
+                    return false;
+                }
+
+                // Tam resim board kaynağı olur - indirection board ve kenar uyumu tablosu bunu okur
+                GameMode->BoardSourceImage = GameMode->CreateImportTexture(Result->ImagePixels.GetData(), Result->ImageWidth, Result->ImageHeight, 1);
+                Result->ImagePixels.Empty();
+                UploadSeconds += FPlatformTime::Seconds() - StepStart;
+
+                GameMode->PieceMaterials = MoveTemp(GameMode->PendingImportMaterials);
+                GameMode->PieceMaterialMargin = Margin;
+                GameMode->PieceThumbnails = MoveTemp(GameMode->PendingImportThumbnails);
+                GameMode->ImageImportCancel.Reset();
+
+                UE_LOG(LogPuzzleGame, Log, TEXT("  upload %.1fms over frames, %.2fs end to end"),
+                    UploadSeconds * 1000.0, FPlatformTime::Seconds() - StartTime);
+
+                // Yeni resim yeni puzzle - parçalar, tepsi ve resimden türeyen tablolar baştan kurulur
+                GameMode->RestartGame();
+                GameMode->OnImageImported.Broadcast(true);
+                return true;
+            });
+        });
+    });
+}
+
+void APuzzleGameMode::CancelImageImport()
+{
+    if (ImageImportCancel.IsValid())
+    {
+        ImageImportCancel->store(true, std::memory_order_relaxed);
+        ImageImportCancel.Reset();
+    }
+    WorkScheduler.CancelByName(TEXT("ImageImport"));
+    PendingImportMaterials.Empty();
+    PendingImportThumbnails.Empty();
+}
+
+UTexture2D* APuzzleGameMode::CreateImportTexture(const FColor* Pixels, int32 Width, int32 Height, int32 NumMips) const
+{
+    UTexture2D* Texture = UTexture2D::CreateTransient(Width, Height, PF_B8G8R8A8);
+    if (!Texture)
+    {
+        return nullptr;
+    }
+
+    FTexturePlatformData* PlatformData = Texture->GetPlatformData();
+    for (int32 Mip = 0; Mip < NumMips; Mip++)
+    {
+        const int32 MipWidth = FMath::Max(Width >> Mip, 1);
+        const int32 MipHeight = FMath::Max(Height >> Mip, 1);
+        const int64 MipBytes = (int64)MipWidth * MipHeight * sizeof(FColor);
+
+        // CreateTransient sadece mip 0'ı ayırır
+        if (Mip > 0)
+        {
+            PlatformData->Mips.Add(new FTexture2DMipMap(MipWidth, MipHeight, 1));
+        }
+
+        FByteBulkData& BulkData = PlatformData->Mips[Mip].BulkData;
+        BulkData.Lock(LOCK_READ_WRITE);
+        FMemory::Memcpy(BulkData.Realloc(MipBytes), Pixels, MipBytes);
+        BulkData.Unlock();
+        Pixels += MipWidth * MipHeight;
+    }
+
+    // Şekilli parçaların çıkıntıları hücre dışını örnekler - karşı kenara sarmasın
+    Texture->AddressX = TA_Clamp;
+    Texture->AddressY = TA_Clamp;
+    Texture->SRGB = true;
+    Texture->UpdateResource();
+    return Texture;
+}
+
+UTexture2D* APuzzleGameMode::CreateImportTexture(const FPuzzleImageMipChain& Chain) const
+{
+    return CreateImportTexture(Chain.Pixels.GetData(), Chain.Size, Chain.Size, Chain.GetNumMips());
+}
+
+bool APuzzleGameMode::ReadSourceImagePixels(TArray<FColor>& OutPixels, int32& OutWidth, int32& OutHeight) const
+{
+    UTexture2D* SourceTexture = Cast<UTexture2D>(BoardSourceImage);
+    const FTexturePlatformData* PlatformData = SourceTexture ? SourceTexture->GetPlatformData() : nullptr;
+    if (!PlatformData || PlatformData->Mips.Num() == 0 || PlatformData->PixelFormat != PF_B8G8R8A8)
+    {
+        UE_LOG(LogPuzzleGame, Warning, TEXT("Image compatibility needs an uncompressed BGRA8 source texture, e.g. one created by ImportPuzzleImage"));
+        return false;
+    }
+
+    // Cook edilmiş build'de mip verisi GPU'ya yüklendikten sonra atılmış olabilir
+    const FTexture2DMipMap& Mip = PlatformData->Mips[0];
+    const void* MipData = Mip.BulkData.LockReadOnly();
+    if (!MipData)
+    {
+        Mip.BulkData.Unlock();
+        UE_LOG(LogPuzzleGame, Warning, TEXT("Source texture %s has no CPU mip data"), *SourceTexture->GetName());
+        return false;
+    }
+
+    OutWidth = Mip.SizeX;
+    OutHeight = Mip.SizeY;
+    OutPixels.SetNumUninitialized(OutWidth * OutHeight);
+    FMemory::Memcpy(OutPixels.GetData(), MipData, OutPixels.Num() * sizeof(FColor));
+    Mip.BulkData.Unlock();
+    return true;
+}
+
+void APuzzleGameMode::OnHintFound(const FPuzzleHint& Hint)
+{
+    // Arama sürerken yayınlanan yeni versiyon zaten yeni arama başlattı
+    if (!bHintRequested || Hint.BoardVersion != (int64)BoardSnapshots.GetPublishedVersion())
+    {
+        return;
+    }
+
+    CurrentHint = Hint;
+    OnHintReady.Broadcast(CurrentHint);
+}
+
+void APuzzleGameMode::StartGame()
+{
+    if (CurrentGameState == EPuzzleGameState::NotStarted ||
+        CurrentGameState == EPuzzleGameState::Completed)
+    {
+        // Oyunu sıfırla
+        GameTime = 0.0f;
+        TotalMoves = 0;
+        ProductiveMoveGain = 0;
+        CurrentGameState = EPuzzleGameState::InProgress;
+
+        // Timer'ı başlat
+        GetWorldTimerManager().SetTimer(GameTimerHandle, this, &APuzzleGameMode::OnTimerTick, 1.0f, true);
+
+        // İstatistikleri güncelle
+        bStatsDirty = true;
+
+    }
+    else if (CurrentGameState == EPuzzleGameState::Paused)
+    {
+        ResumeGame();
+    }
+}
+
+void APuzzleGameMode::PauseGame()
+{
+    if (CurrentGameState == EPuzzleGameState::InProgress)
+    {
+        // Duraklatılmışken yapılan hamleler sayılmaz - validator bunu kayıttan bilmeli
+        RecordReplayMove(EPuzzleReplayMoveType::Pause, -1, -1, -1);
+
+        CurrentGameState = EPuzzleGameState::Paused;
+        GetWorldTimerManager().ClearTimer(GameTimerHandle);
+
+    }
+}
+
+void APuzzleGameMode::ResumeGame()
+{
+    if (CurrentGameState == EPuzzleGameState::Paused)
+    {
+        RecordReplayMove(EPuzzleReplayMoveType::Resume, -1, -1, -1);
+
+        CurrentGameState = EPuzzleGameState::InProgress;
+        GetWorldTimerManager().SetTimer(GameTimerHandle, this, &APuzzleGameMode::OnTimerTick, 1.0f, true);
+
+    }
+}
+
+void APuzzleGameMode::RestartGame()
+{
+    // Mevcut puzzle parçalarını temizle - yok etme frame bütçesine yayılır
+    for (APuzzlePiece* Piece : PuzzlePieces)
+    {
+        RetireActor(Piece);
+    }
     PuzzlePieces.Empty();
-    PuzzlePieces.SetNum(TotalPieces);
+
+    // Timerı durdur
+    GetWorldTimerManager().ClearTimer(GameTimerHandle);
+
+    // Puzzleı yeniden başlat
+    InitializePuzzle();
+    StartGame();
+}
+
+void APuzzleGameMode::IncrementMoveCount()
+{
+    if (CurrentGameState == EPuzzleGameState::InProgress)
+    {
+        TotalMoves++;
+
+        // Son kaydedilen board işlemini sayılmış olarak işaretle
+        if (bRecordReplay && CurrentReplay.Moves.Num() > 0 && CurrentReplay.Moves.Last().IsCountable())
+        {
+            CurrentReplay.Moves.Last().bCounted = true;
+        }
+
+        // Spawn gibi sayılmayan işlemlerin mesafe değişimi verime girmez
+        ProductiveMoveGain += LastOperationSwapGain;
+        LastOperationSwapGain = 0;
+
+        // Toplu işlemlerde tek yayın - Tick'te gönderilir
+        bStatsDirty = true;
+
+        // Her hamle sonrası oyunun bitip bitmediğini kontrol et
+        if (CheckGameCompletion())
+        {
+            OnGameComplete();
+        }
+    }
+}
+
+APuzzlePiece* APuzzleGameMode::SpawnPuzzlePiece(int32 PieceID, FVector SpawnLocation)
+{
     
-    GridOccupancy.Empty();
-    GridOccupancy.SetNum(TotalPieces);
-    for (int32 i = 0; i < TotalPieces; i++)
+    // piece ID null mu
+    if (PieceID < 0 || PieceID >= PuzzlePieces.Num())
+    {
+        return nullptr;
+    }
+    
+    int32 ExistingCount = 0;
+    for (int32 i = 0; i < PuzzlePieces.Num(); i++)
+    {
+        if (PuzzlePieces[i] != nullptr)
+        {
+            ExistingCount++;
+        }
+    }
+    
+    if (!PuzzlePieceClass)
+    {
+        return nullptr;
+    }
+    
+    //İstenilen parça eşsiz mi (stream edilmiş parçaların actor'ü olmayabilir)
+    if (PieceID >= 0 && PieceID < PuzzlePieces.Num() && (PuzzlePieces[PieceID] || PieceGridIDs[PieceID] >= 0))
+    {
+        
+        // Musait listedeyse spawn et
+        if (AvailablePieceIDs.Contains(PieceID))
+        {
+        }
+        
+        // Still remove from available list if it somehow exists there
+        RemovePieceFromAvailable(PieceID);
+        
+        // This is a bug - we shouldn't be trying to spawn an already existing piece
+        // Return null instead of the existing piece to prevent moving it
+        return nullptr;
+    }
+
+    // Havuzdan al ya da yeni spawn et, ID/doğru pozisyon/materyal ayarlanır
+    APuzzlePiece* NewPiece = AcquirePieceActor(PieceID, SpawnLocation);
+
+    if (NewPiece)
+    {
+        // Musait listesinden çıkar
+        RemovePieceFromAvailable(PieceID);
+        
+        // Grid yerini güncelle - serbest modda parça sadece masaya konur
+        int32 SpawnGridID = FreePlacement.IsActive() ? -1 : GetGridIDFromPosition(SpawnLocation);
+        if (FreePlacement.IsActive())
+        {
+            FreePlacement.SetPiecePosition(PieceID, FVector2D(SpawnLocation));
+        }
+        else if (SpawnGridID >= 0)
+        {
+            RecordReplayMove(EPuzzleReplayMoveType::Spawn, PieceID, -1, SpawnGridID);
+            ApplyGridOccupancy(SpawnGridID, NewPiece);
+        }
+        
+        // Hamle sayısını artır
+        //IncrementMoveCount();
+        
+        // İlk parça yerleştirildiğinde timerı başlat
+        if (CurrentGameState == EPuzzleGameState::NotStarted)
+        {
+            StartGame();
+        }
+        
+    }
+
+    return NewPiece;
+}
+
+bool APuzzleGameMode::CheckGameCompletion()
+{
+    if (PuzzlePieces.Num() == 0)
+        return false;
+    
+    // Sliding modunda son hücre boşluk olarak kalır
+    if (bSlidingTileMode)
+    {
+        return CorrectCellCount == GridOccupancy.Num() - 1 && GridOccupancy.Last() < 0;
+    }
+
+    // Serbest yerleştirme: tüm parçalar masada ve tek grupta
+    if (FreePlacement.IsActive())
+    {
+        return FreePlacement.IsComplete();
+    }
+
+    // Edge-matching: tüm kenarları eşleşen her düzen çözümdür
+    if (EdgeSet.IsValid())
+    {
+        return EdgeMatchScore == EdgeSet->GetSolvedScore();
+    }
+
+    // Occupancy üzerinden kontrol - stream edilmiş parçaların actor'ü olmayabilir
+    // Her hücrede kendi parçası varsa oyunu bitir
+    return CorrectCellCount == GridOccupancy.Num();
+}
+
+
+//Dogru konulan parça sayısı
+int32 APuzzleGameMode::GetCompletedPiecesCount() const
+{
+    return CorrectCellCount;
+}
+
+
+// İlerleme yüzdesi
+float APuzzleGameMode::GetCompletionPercentage() const
+{
+    if (PuzzlePieces.Num() == 0)
+        return 0.0f;
+
+    return (float)GetCompletedPiecesCount() / (float)PuzzlePieces.Num() * 100.0f;
+}
+
+float APuzzleGameMode::GetMoveEfficiency() const
+{
+    if (TotalMoves == 0)
+    {
+        return 1.0f;
+    }
+
+    // Grup taşıma tek hamlede birden fazla takas kapatabilir - 1.0'ı geçebilir
+    return (float)ProductiveMoveGain / (float)TotalMoves;
+}
+
+
+//Oyun bitiminde sayacı durdur
+void APuzzleGameMode::OnGameComplete()
+{
+    CurrentGameState = EPuzzleGameState::Completed;
+    GetWorldTimerManager().ClearTimer(GameTimerHandle);
+
+    // Son hamlenin delta'sı ve istatistikleri tamamlanma event'inden önce gitsin
+    FlushBoardChanges();
+    FlushStatsUpdate();
+
+    // Replay'i sonuçlarla birlikte kaydet
+    if (bRecordReplay && bReplayActive)
+    {
+        CurrentReplay.ClaimedTotalMoves = TotalMoves;
+        CurrentReplay.ClaimedGameTime = GameTime;
+
+        const FString ReplayPath = FPaths::ProjectSavedDir() / TEXT("Replays") /
+            FString::Printf(TEXT("Replay_%s.json"), *FDateTime::Now().ToString());
+
+        // Dosya yazımı tamamlanma frame'inden sonraya ertelenir
+        WorkScheduler.Enqueue(TEXT("ReplaySave"), EPuzzleWorkPriority::Low, [ReplayPath, Record = CurrentReplay]()
+        {
+            if (!FPuzzleReplayValidator::SaveRecordToFile(Record, ReplayPath))
+            {
+                UE_LOG(LogPuzzleGame, Warning, TEXT("Failed to save replay to %s"), *ReplayPath);
+            }
+            return true;
+        });
+    }
+
+    // Completion event'ini broadcast et
+    OnGameCompleted.Broadcast(GameTime, TotalMoves);
+
+}
+
+
+//Timer 
+void APuzzleGameMode::OnTimerTick()
+{
+    if (CurrentGameState == EPuzzleGameState::InProgress)
+    {
+        GameTime += 1.0f;
+
+        // Idle iken UI güncellemesi uyanışa ertelenir (Tick)
+        bStatsDirty = true;
+    }
+}
+
+
+//Puzzle ı başlat
+void APuzzleGameMode::InitializePuzzle()
+{
+    CurrentGameState = EPuzzleGameState::NotStarted;
+
+    // Sliding çözücü ve pattern DB'ler kare komşuluk varsayar
+    if (bSlidingTileMode && GridTopology != EPuzzleGridTopology::Square)
+    {
+        UE_LOG(LogPuzzleGame, Warning, TEXT("Sliding-tile mode requires a square grid, switching topology to Square"));
+        GridTopology = EPuzzleGridTopology::Square;
+    }
+
+    if (bEdgeMatchingMode && bSlidingTileMode)
+    {
+        UE_LOG(LogPuzzleGame, Warning, TEXT("Edge-matching mode is ignored in sliding-tile mode"));
+    }
+    else if (bEdgeMatchingMode && GridTopology != EPuzzleGridTopology::Square)
+    {
+        // Kenarlar dört yönlü paketlenir
+        UE_LOG(LogPuzzleGame, Warning, TEXT("Edge-matching mode requires a square grid, switching topology to Square"));
+        GridTopology = EPuzzleGridTopology::Square;
+    }
+
+    // Parametresi olmayan materyalde renkler sessizce kaybolur ve mod oynanamaz - parça başına değil burada bir kez bakılır
+    if (bEdgeMatchingMode && !bSlidingTileMode)
+    {
+        UMaterialInterface* EdgeMaterial = PieceMaterials.Num() > 0 ? PieceMaterials[0] : nullptr;
+        if (!EdgeMaterial && PuzzlePieceClass)
+        {
+            const UStaticMeshComponent* DefaultMesh = PuzzlePieceClass->GetDefaultObject<APuzzlePiece>()->GetPieceMesh();
+            EdgeMaterial = DefaultMesh ? DefaultMesh->GetMaterial(0) : nullptr;
+        }
+
+        if (!APuzzlePiece::HasEdgeColourParameters(EdgeMaterial))
+        {
+            UE_LOG(LogPuzzleGame, Error, TEXT("Edge-matching mode disabled: piece material %s has no EdgeColorNorth/East/South/West vector parameters"),
+                *GetNameSafe(EdgeMaterial));
+            ensureMsgf(false, TEXT("Edge-matching mode needs a piece material with EdgeColorNorth/East/South/West vector parameters"));
+            bEdgeMatchingMode = false;
+        }
+    }
+
+    // Serbest modda hücre yok - kayan taş ve kenar eşleşmesi hücre düzenine dayanır
+    if (bFreePlacementMode && (bSlidingTileMode || bEdgeMatchingMode))
+    {
+        UE_LOG(LogPuzzleGame, Warning, TEXT("Free-placement mode is ignored in sliding-tile and edge-matching modes"));
+    }
+
+    
+    // Önceki parçaları sil - yok etme frame bütçesine yayılır
+    for (int32 i = 0; i < PuzzlePieces.Num(); i++)
+    {
+        RetireActor(PuzzlePieces[i]);
+        PuzzlePieces[i] = nullptr;
+    }
+    for (APuzzlePiece* PooledPiece : PiecePool)
+    {
+        RetireActor(PooledPiece);
+    }
+    PiecePool.Empty();
+    PendingReleasePieces.Empty();
+
+    // Donmuş parçaları temizle
+    if (IsValid(FrozenBatch))
+    {
+        FrozenBatch->ClearBatch();
+        FrozenBatch->SetAtlasMaterial(CreateFrozenBatchMaterial());
+    }
+    PendingFreezePieces.Empty();
+    PendingUnfreezePieces.Empty();
+    GetWorldTimerManager().ClearTimer(FreezeTimerHandle);
+
+    // Boundary oluştur
+    CalculateBoundary();
+
+    // Debug
+    if (bShowGridMarkers)
+    {
+        CreateGridVisualization();
+    }
+
+    // Puzzle parçalarıını oluştur
+    // UI tarafından oluşturulacak
+    int32 TotalPieces = PuzzleWidth * PuzzleHeight;
+    PuzzlePieces.Empty();
+    PuzzlePieces.SetNum(TotalPieces);
+    
+    GridOccupancy.Empty();
+    GridOccupancy.SetNum(TotalPieces);
+    for (int32 i = 0; i < TotalPieces; i++)
+    {
+        GridOccupancy[i] = -1;
+    }
+
+    PieceGridIDs.Init(-1, TotalPieces);
+    Clusters.Init(PuzzleWidth, PuzzleHeight, GridTopology);
+    SwapDistance.Init(TotalPieces);
+    LastOperationSwapGain = 0;
+    CorrectCellCount = 0;
+    BoardJournal.Init(TotalPieces);
+    ClearHint();
+    StopSlidingAutoSolve();
+    SlidingSolver.Reset();
+    SlidingBlankGridID = -1;
+    EdgeSet.Reset();
+    EdgeSolver.Reset();
+    EdgeMatchScore = 0;
+    FreePlacement.Reset();
+    StopImageCompatibilityBuild();
+    ImageCompatibility.Reset();
+    StopPieceShapeBuild();
+    PieceShapes.Reset();
+    BoardHash.Reset();
+    BoardSnapshots.Init(PuzzleWidth, PuzzleHeight, GridOccupancy, CorrectCellCount, BoardHash.Get());
+    FrozenPieces.Init(false, TotalPieces);
+    FrozenPieceCount = 0;
+
+    InitializeIndirectionRenderer();
+    InitializeChunks();
+
+    // Açık heatmap yeni board boyutuyla yeniden kurulur
+    if (bShowHeatmapOverlay)
+    {
+        SetHeatmapVisible(true);
+    }
+
+    CurrentReplay.Reset(PuzzleWidth, PuzzleHeight);
+    
+    for (int32 i = 0; i < TotalPieces; i++)
+    {
+        PuzzlePieces[i] = nullptr;
+    }
+    
+    // Seed'li karıştırma - aynı seed ve ayarlar aynı board'u üretir
+    CurrentShuffleSeed = ShuffleSettings.Seed != 0 ? ShuffleSettings.Seed : FMath::Max(1, FMath::Rand());
+
+    const double ShuffleStartTime = FPlatformTime::Seconds();
+    FPuzzleShuffleResult Shuffle;
+    FPuzzleShuffleGenerator::Generate(TotalPieces, ShuffleSettings, CurrentShuffleSeed, Shuffle);
+
+    UE_LOG(LogPuzzleGame, Log, TEXT("Shuffled %d cells with seed %d in %.1fms: %d correct, %d cycles, %d min swaps"),
+        TotalPieces, CurrentShuffleSeed, (FPlatformTime::Seconds() - ShuffleStartTime) * 1000.0,
+        Shuffle.CorrectPieces, Shuffle.Cycles, Shuffle.MinSwaps);
+
+    bReplayActive = true;
+    if (bEdgeMatchingMode && !bSlidingTileMode)
+    {
+        // Kenarlar aynı seed'den üretilir - PieceID == GridID çözümü gömülü, board her zaman çözülebilir
+        const double EdgeStartTime = FPlatformTime::Seconds();
+        const TSharedRef<const FPuzzleEdgeSet, ESPMode::ThreadSafe> NewEdgeSet =
+            FPuzzleEdgeSet::Generate(PuzzleWidth, PuzzleHeight, EdgeMatchingColours, CurrentShuffleSeed);
+        EdgeSet = NewEdgeSet;
+
+        // Oyunda parça döndürme yok - solver da döndürmeden arar
+        EdgeSolver = MakeShared<const FPuzzleEdgeSolver, ESPMode::ThreadSafe>(NewEdgeSet, false);
+
+        UE_LOG(LogPuzzleGame, Log, TEXT("Generated %dx%d edge-matching set with %d colours in %.1fms"),
+            PuzzleWidth, PuzzleHeight, EdgeMatchingColours, (FPlatformTime::Seconds() - EdgeStartTime) * 1000.0);
+
+        // Replay doğrulayıcısı PieceID == GridID'yi çözüm sayar - alternatif çözümler doğrulanamaz
+        bReplayActive = false;
+    }
+
+    if (bFreePlacementMode && !bSlidingTileMode && !EdgeSet.IsValid())
+    {
+        // Komşu ofsetleri çözülmüş düzendeki hücre merkezlerinden - topoloji ne olursa olsun
+        TArray<FVector2D> CorrectPositions;
+        CorrectPositions.SetNumUninitialized(TotalPieces);
+        for (int32 PieceID = 0; PieceID < TotalPieces; PieceID++)
+        {
+            CorrectPositions[PieceID] = FVector2D(GetGridPositionFromID(PieceID));
+        }
+        FreePlacement.Init(PuzzleWidth, PuzzleHeight, GridTopology, MoveTemp(CorrectPositions), PieceSpacing);
+
+        // Replay hücre hamleleri kaydeder - serbest konumlar tekrar oynatılamaz
+        bReplayActive = false;
+    }
+
+    // Uyum tablosu resimden gelir, parça kenar renkleri ve kayan taşlar için anlamsız
+    if (bUseImageCompatibilityHints && !bSlidingTileMode && !EdgeSet.IsValid())
+    {
+        BuildImageCompatibility();
+    }
+
+    // Kayan taşlar birbirine geçmez - düz mesh kalır
+    if (bProceduralPieceShapes && !bSlidingTileMode)
+    {
+        BuildPieceShapes();
+    }
+
+    // Blueprint mesh'i kare - altıgen ve üçgen hücrelerde parça hücre şeklini alır
+    if (GridTopology != EPuzzleGridTopology::Square)
+    {
+        BuildCellShapeMesh();
+    }
+
+    if (bSlidingTileMode && TotalPieces >= 3)
+    {
+        TArray<int32>& Arrangement = Shuffle.Arrangement;
+        const int32 BlankTile = TotalPieces - 1;
+
+        // Permütasyonların yarısı çözülemez - boşluk dışı iki taşın takası pariteyi çevirir
+        if (!FPuzzleSlidingSolver::IsSolvable(PuzzleWidth, PuzzleHeight, BlankTile, Arrangement))
+        {
+            const int32 First = Arrangement[0] != BlankTile ? 0 : 1;
+            const int32 Second = Arrangement[First + 1] != BlankTile ? First + 1 : First + 2;
+            Swap(Arrangement[First], Arrangement[Second]);
+        }
+
+        SlidingBlankGridID = Arrangement.IndexOfByKey(BlankTile);
+        Arrangement[SlidingBlankGridID] = -1;
+
+        if (PuzzleWidth <= 5 && PuzzleHeight <= 5)
+        {
+            // Dosya yoksa solver Manhattan + linear conflict ile çalışır
+            if (!SlidingPatternDatabase.IsValid() || !SlidingPatternDatabase->IsCompatible(PuzzleWidth, PuzzleHeight, BlankTile))
+            {
+                SlidingPatternDatabase = FPuzzlePatternDatabase::FindOrLoad(PuzzleWidth, PuzzleHeight);
+                if (!SlidingPatternDatabase.IsValid())
+                {
+                    UE_LOG(LogPuzzleGame, Log, TEXT("No pattern database for %dx%d at %s"), PuzzleWidth, PuzzleHeight,
+                        *FPuzzlePatternDatabase::GetDefaultPath(PuzzleWidth, PuzzleHeight));
+                }
+            }
+            SlidingSolver = MakeShared<FPuzzleSlidingSolver, ESPMode::ThreadSafe>(PuzzleWidth, PuzzleHeight, BlankTile, SlidingPatternDatabase);
+        }
+
+        // Replay doğrulayıcısı dolu board bekler - kayan taş hamleleri kaydedilmez
+        bReplayActive = false;
+        AvailablePieceIDs.Empty();
+        ApplyBoardArrangement(Arrangement);
+        StartGame();
+    }
+    else if (bPrePlaceShuffledBoard && !FreePlacement.IsActive())
+    {
+        AvailablePieceIDs.Empty();
+        ApplyBoardArrangement(Shuffle.Arrangement);
+        StartGame();
+    }
+    else
+    {
+        AvailablePieceIDs = MoveTemp(Shuffle.Arrangement);
+    }
+}
+
+void APuzzleGameMode::ApplyBoardArrangement(const TArray<int32>& Arrangement)
+{
+    // Her parça bir Spawn kaydı olur - büyük board'larda kayıt bellek maliyetine değmez
+    if (bRecordReplay && Arrangement.Num() > FMath::Min(ReplayMaxPreplacedCells, FPuzzleReplayValidator::MaxCells))
+    {
+        bReplayActive = false;
+        UE_LOG(LogPuzzleGame, Log, TEXT("Replay recording disabled for pre-placed %d-cell board"), Arrangement.Num());
+    }
+
+    TArray<int32> ChangedCells;
+    ChangedCells.SetNumUninitialized(Arrangement.Num());
+    for (int32 GridID = 0; GridID < Arrangement.Num(); GridID++)
+    {
+        if (Arrangement[GridID] >= 0)
+        {
+            RecordReplayMove(EPuzzleReplayMoveType::Spawn, Arrangement[GridID], -1, GridID);
+        }
+        SetCellOccupant(GridID, Arrangement[GridID]);
+        ChangedCells[GridID] = GridID;
+    }
+    NotifyCellsChanged(ChangedCells);
+
+    // Streaming kapalıysa her parçanın actor'ü olur (donmuşlar batch'te çizilir)
+    if (!IsChunkStreamingActive())
+    {
+        for (int32 GridID = 0; GridID < Arrangement.Num(); GridID++)
+        {
+            const int32 PieceID = Arrangement[GridID];
+            if (PieceID >= 0 && !FrozenPieces[PieceID] && !IsValid(PuzzlePieces[PieceID]))
+            {
+                AcquirePieceActor(PieceID, GetGridPositionFromID(GridID));
+            }
+        }
+    }
+}
+
+void APuzzleGameMode::CreateGridVisualization()
+{
+
+    ClearGridVisualization();
+
+    // Streaming açıkken marker'lar sadece yüklü chunk'lar için oluşturulur
+    if (IsChunkStreamingActive())
+    {
+        for (TConstSetBitIterator<> It(ResidentChunks); It; ++It)
+        {
+            CreateChunkGridMarkers(It.GetIndex());
+        }
+        return;
+    }
+
+    int32 TotalPieces = PuzzleWidth * PuzzleHeight;
+
+    // Marker'lar frame bütçesine bölünerek oluşturulur
+    TSharedRef<int32> NextIndex = MakeShared<int32>(0);
+    WorkScheduler.Enqueue(TEXT("GridVisualization"), EPuzzleWorkPriority::Normal, [this, NextIndex, TotalPieces]()
+    {
+        const int32 EndIndex = FMath::Min(*NextIndex + FMath::Max(GridMarkersPerStep, 1), TotalPieces);
+        for (int32 i = *NextIndex; i < EndIndex; i++)
+        {
+            CreateGridMarker(GetGridPositionFromID(i) + FVector(0.0f, 0.0f, -10.0f), i);
+        }
+        *NextIndex = EndIndex;
+        return EndIndex >= TotalPieces;
+    });
+
+}
+
+// Gridleri görselleştirmek için oluşturulan fonksiyon 
+AStaticMeshActor* APuzzleGameMode::CreateGridMarker(const FVector& Position, int32 GridIndex)
+{
+    
+    AStaticMeshActor* GridMarker = GetWorld()->SpawnActor<AStaticMeshActor>();
+
+    if (GridMarker)
+    {
+        
+        UStaticMeshComponent* MeshComp = GridMarker->GetStaticMeshComponent();
+
+        if (MeshComp && GridMarkerMesh)
+        {
+            
+            MeshComp->SetStaticMesh(GridMarkerMesh);
+
+           
+            GridMarker->SetActorLocation(Position);
+
+            // Aşağı bakan üçgen hücrelerde marker çevrilir
+            const float Yaw = DispatchGridTopology(GridTopology, [this, GridIndex](auto Policy)
+            {
+                return decltype(Policy)::GetCellYaw(GridIndex % PuzzleWidth, GridIndex / PuzzleWidth);
+            });
+            GridMarker->SetActorRotation(FRotator(0.0f, Yaw, 0.0f));
+            GridMarker->SetActorScale3D(FVector(GridMarkerScale, GridMarkerScale, 0.02f)); // Flat marker
+
+            
+            UMaterialInterface* DefaultMaterial = MeshComp->GetMaterial(0);
+            if (DefaultMaterial)
+            {
+                UMaterialInstanceDynamic* DynamicMat = UMaterialInstanceDynamic::Create(DefaultMaterial, this);
+                if (DynamicMat)
+                {
+                    
+                    DynamicMat->SetVectorParameterValue(TEXT("BaseColor"), GridMarkerColor);
+                    MeshComp->SetMaterial(0, DynamicMat);
+                }
+            }
+
+           
+            MeshComp->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+
+            MeshComp->SetCastShadow(false);
+            MeshComp->SetReceivesDecals(false);
+
+            GridMarkers.Add(GridMarker);
+
+        }
+    }
+
+    return GridMarker;
+}
+
+void APuzzleGameMode::ClearGridVisualization()
+{
+    WorkScheduler.CancelByName(TEXT("GridVisualization"));
+
+    for (AStaticMeshActor* Marker : GridMarkers)
+    {
+        if (IsValid(Marker))
+        {
+            Marker->Destroy();
+        }
+    }
+
+    GridMarkers.Empty();
+    ChunkGridMarkers.Empty();
+}
+
+void APuzzleGameMode::ToggleGridVisualization()
+{
+    bShowGridMarkers = !bShowGridMarkers;
+
+    if (bShowGridMarkers)
+    {
+        CreateGridVisualization();
+    }
+    else
+    {
+        ClearGridVisualization();
+    }
+}
+
+
+// Boundry box alanı hesaplama
+void APuzzleGameMode::CalculateBoundary()
+{
+   
+    // Hücre merkezlerinin kutusu - hex/üçgen satırları kaydığı için topolojiden alınır
+    FVector2D CenterMin, CenterMax;
+    DispatchGridTopology(GridTopology, [&](auto Policy)
+    {
+        GetGridCenterBounds<decltype(Policy)>(PuzzleWidth, PuzzleHeight, PieceSpacing, CenterMin, CenterMax);
+    });
+
+    FVector MinCorner = PuzzleStartLocation + FVector(CenterMin.X, CenterMin.Y, 0.0f);
+    FVector MaxCorner = PuzzleStartLocation + FVector(CenterMax.X, CenterMax.Y, 0.0f);
+
+    BoundaryMin = MinCorner - FVector(BoundaryPadding, BoundaryPadding, 0.0f);
+    BoundaryMax = MaxCorner + FVector(BoundaryPadding, BoundaryPadding, 0.0f);
+
+    DrawBoundaryDebug();
+}
+
+bool APuzzleGameMode::IsLocationWithinBoundary(const FVector& Location)
+{
+    return (Location.X >= BoundaryMin.X && Location.X <= BoundaryMax.X &&
+        Location.Y >= BoundaryMin.Y && Location.Y <= BoundaryMax.Y);
+}
+
+FVector APuzzleGameMode::ClampLocationToBoundary(const FVector& Location)
+{
+    FVector ClampedLocation = Location;
+
+    ClampedLocation.X = FMath::Clamp(ClampedLocation.X, BoundaryMin.X, BoundaryMax.X);
+
+    ClampedLocation.Y = FMath::Clamp(ClampedLocation.Y, BoundaryMin.Y, BoundaryMax.Y);
+
+    // Z değeri değişmeyecek
+    ClampedLocation.Z = 0.0f;
+
+    return ClampedLocation;
+}
+
+void APuzzleGameMode::EnforceAllPieceBoundaries()
+{
+    int32 ConstrainedPieces = 0;
+
+    for (APuzzlePiece* Piece : PuzzlePieces)
+    {
+        if (IsValid(Piece))
+        {
+            FVector CurrentLocation = Piece->GetActorLocation();
+
+            if (!IsLocationWithinBoundary(CurrentLocation))
+            {
+                FVector ConstrainedLocation = ClampLocationToBoundary(CurrentLocation);
+                Piece->MovePieceToLocation(ConstrainedLocation, true);
+
+                ConstrainedPieces++;
+
+
+            }
+        }
+    }
+
+    if (ConstrainedPieces > 0)
+    {
+    }
+}
+
+void APuzzleGameMode::DrawBoundaryDebug()
+{
+#if ENABLE_DRAW_DEBUG
+    // Heatmap açıkken boundary kutusu da gösterilir
+    if (!bShowHeatmapOverlay || !GetWorld())
+    {
+        return;
+    }
+
+    FVector BoxCenter = (BoundaryMin + BoundaryMax) * 0.5f;
+    FVector BoxExtent = (BoundaryMax - BoundaryMin) * 0.5f;
+    BoxExtent.Z = 50.0f;
+
+    FlushPersistentDebugLines(GetWorld());
+    DrawDebugBox(GetWorld(), BoxCenter, BoxExtent, FColor::Yellow, true, -1.0f, 0, 8.0f);
+#endif
+}
+
+
+
+void APuzzleGameMode::RefreshGridVisualization()
+{
+    ClearGridVisualization();
+    if (bShowGridMarkers)
+    {
+        CreateGridVisualization();
+    }
+}
+
+void APuzzleGameMode::SetBoundaryPadding(float NewPadding)
+{
+    BoundaryPadding = NewPadding;
+    CalculateBoundary();
+    EnforceAllPieceBoundaries();
+    
+}
+
+void APuzzleGameMode::PrintAllPiecePositions()
+{
+    
+    int32 TotalPieces = 0;
+    int32 SpawnedPieces = 0;
+    int32 CorrectPieces = 0;
+    
+    for (int32 i = 0; i < PuzzlePieces.Num(); i++)
+    {
+        TotalPieces++;
+        APuzzlePiece* Piece = PuzzlePieces[i];
+        
+        if (Piece)
+        {
+            SpawnedPieces++;
+            FVector Location = Piece->GetActorLocation();
+            FVector CorrectPos = Piece->GetCorrectPosition();
+            bool bIsCorrect = Piece->IsInCorrectPosition();
+            
+            if (bIsCorrect)
+            {
+                CorrectPieces++;
+            }
+            
+            int32 CurrentGridID = GetGridIDFromPosition(Location);
+            
+        }
+        else
+        {
+        }
+    }
+    
+        bool bShouldBeComplete = SpawnedPieces == TotalPieces && CorrectPieces == TotalPieces;
+    
+    if (bShouldBeComplete && CurrentGameState != EPuzzleGameState::Completed)
+    {
+        if (CheckGameCompletion())
+        {
+            OnGameComplete();
+        }
+    }
+}
+
+FVector APuzzleGameMode::GetNearestGridPosition(const FVector& WorldPosition)
+{
+    FVector NearestPosition = WorldPosition;
+    if (PuzzleWidth <= 0 || PuzzleHeight <= 0 || PieceSpacing <= 0.0f)
+    {
+        return NearestPosition;
+    }
+    
+    // Düzgün grid - en yakın hücre doğrudan hesaplanır, büyük board'larda tarama yok
+    NearestPosition = GetGridPositionFromID(GetGridIDFromPosition(WorldPosition));
+    NearestPosition.Z = 0.0f;
+    
+    
+    return NearestPosition;
+}
+
+APuzzlePiece* APuzzleGameMode::GetPieceAtGridPosition(const FVector& GridPosition)
+{
+    for (APuzzlePiece* Piece : PuzzlePieces)
+    {
+        if (Piece)
+        {
+            FVector PieceLocation = Piece->GetActorLocation();
+            if (FVector::Dist2D(PieceLocation, GridPosition) < 10.0f)
+            {
+                return Piece;
+            }
+        }
+    }
+    
+    return nullptr;
+}
+
+void APuzzleGameMode::RemovePieceFromAvailable(int32 PieceID)
+{
+    int32 RemovedCount = AvailablePieceIDs.Remove(PieceID);
+    
+    if (AvailablePieceIDs.Num() <= 3)
+    {
+        FString RemainingPieces = TEXT("Remaining available pieces: ");
+        for (int32 ID : AvailablePieceIDs)
+        {
+            RemainingPieces += FString::Printf(TEXT("%d "), ID);
+        }
+    }
+}
+
+int32 APuzzleGameMode::GetGridIDFromPosition(const FVector& WorldPosition)
+{
+    if (PuzzleWidth <= 0 || PuzzleHeight <= 0 || PieceSpacing <= 0.0f)
+    {
+        return -1;
+    }
+
+    // Board dışındaki pozisyonlar en yakın kenar hücresine clamp'lenir
+    const FIntPoint Cell = GetCellAtPosition(WorldPosition);
+    const int32 Col = FMath::Clamp(Cell.X, 0, PuzzleWidth - 1);
+    const int32 Row = FMath::Clamp(Cell.Y, 0, PuzzleHeight - 1);
+    
+    return Row * PuzzleWidth + Col;
+}
+
+FIntPoint APuzzleGameMode::GetCellAtPosition(const FVector& WorldPosition) const
+{
+    const FVector2D Local(WorldPosition.X - PuzzleStartLocation.X, WorldPosition.Y - PuzzleStartLocation.Y);
+    return DispatchGridTopology(GridTopology, [this, &Local](auto Policy)
+    {
+        return decltype(Policy)::GetCellAt(Local, PieceSpacing);
+    });
+}
+
+FVector APuzzleGameMode::GetGridPositionFromID(int32 GridID)
+{
+    if (GridID < 0 || GridID >= PuzzleWidth * PuzzleHeight)
+    {
+        return FVector::ZeroVector;
+    }
+    
+    const FVector2D Center = DispatchGridTopology(GridTopology, [this, GridID](auto Policy)
+    {
+        return decltype(Policy)::GetCellCenter(GridID % PuzzleWidth, GridID / PuzzleWidth, PieceSpacing);
+    });
+    
+    return PuzzleStartLocation + FVector(Center.X, Center.Y, 0.0f);
+}
+
+int32 APuzzleGameMode::GetGridIDOfPiece(int32 PieceID) const
+{
+    return PieceGridIDs.IsValidIndex(PieceID) ? PieceGridIDs[PieceID] : -1;
+}
+
+TArray<int32> APuzzleGameMode::GetClusterGridIDs(int32 GridID) const
+{
+    return Clusters.GetClusterMembers(GridID);
+}
+
+int32 APuzzleGameMode::GetClusterSize(int32 GridID) const
+{
+    return Clusters.GetClusterSize(GridID);
+}
+
+TArray<APuzzlePiece*> APuzzleGameMode::GetClusterPieces(APuzzlePiece* Piece) const
+{
+    TArray<APuzzlePiece*> Result;
+    if (!Piece)
+    {
+        return Result;
+    }
+
+    // Serbest modda küme, yapışmış parça grubudur
+    if (FreePlacement.IsActive() && FreePlacement.IsPlaced(Piece->GetPieceID()))
+    {
+        for (const int32 MemberPieceID : FreePlacement.GetGroupMembers(Piece->GetPieceID()))
+        {
+            if (PuzzlePieces.IsValidIndex(MemberPieceID) && IsValid(PuzzlePieces[MemberPieceID]))
+            {
+                Result.Add(PuzzlePieces[MemberPieceID]);
+            }
+        }
+        return Result;
+    }
+
+    const int32 GridID = GetGridIDOfPiece(Piece->GetPieceID());
+    if (GridID < 0)
+    {
+        Result.Add(Piece);
+        return Result;
+    }
+
+    for (int32 MemberGridID : Clusters.GetClusterMembers(GridID))
+    {
+        const int32 MemberPieceID = GridOccupancy[MemberGridID];
+        if (PuzzlePieces.IsValidIndex(MemberPieceID) && IsValid(PuzzlePieces[MemberPieceID]))
+        {
+            Result.Add(PuzzlePieces[MemberPieceID]);
+        }
+    }
+    return Result;
+}
+
+bool APuzzleGameMode::ReleaseFreePieces(const TArray<APuzzlePiece*>& Pieces, bool bCountMove)
+{
+    if (!FreePlacement.IsActive())
+    {
+        return false;
+    }
+
+    // Önce sürüklenen tüm parçaların konumu - çoklu seçimde birden fazla grup olabilir
+    for (APuzzlePiece* Piece : Pieces)
+    {
+        if (IsValid(Piece) && PuzzlePieces.IsValidIndex(Piece->GetPieceID()))
+        {
+            FreePlacement.SetPiecePosition(Piece->GetPieceID(), FVector2D(Piece->GetActorLocation()));
+        }
+    }
+
+    bool bSnapped = false;
+    TArray<int32> MovedPieces;
+    for (APuzzlePiece* Piece : Pieces)
+    {
+        if (IsValid(Piece) && FreePlacement.IsPlaced(Piece->GetPieceID()))
+        {
+            bSnapped |= FreePlacement.SnapGroup(Piece->GetPieceID(), FreeSnapDistance, MovedPieces);
+        }
+    }
+
+    // Masa düzlemine indir - yapışan gruplar index'teki konuma hizalanır, tekrar eden ID'ler zararsız
+    for (APuzzlePiece* Piece : Pieces)
+    {
+        if (IsValid(Piece))
+        {
+            MovedPieces.Add(Piece->GetPieceID());
+        }
+    }
+    for (const int32 PieceID : MovedPieces)
+    {
+        if (PuzzlePieces.IsValidIndex(PieceID) && IsValid(PuzzlePieces[PieceID]))
+        {
+            const FVector2D Position = FreePlacement.GetPiecePosition(PieceID);
+            PuzzlePieces[PieceID]->MovePieceToLocation(FVector(Position.X, Position.Y, 0.0f), false);
+        }
+    }
+
+    if (bCountMove)
+    {
+        IncrementMoveCount();
+    }
+    else if (CurrentGameState == EPuzzleGameState::InProgress && CheckGameCompletion())
+    {
+        OnGameComplete();
+    }
+    return bSnapped;
+}
+
+int32 APuzzleGameMode::GetFreeGroupSize(int32 PieceID) const
+{
+    return FreePlacement.IsActive() && FreePlacement.IsPlaced(PieceID) ? FreePlacement.GetGroupMembers(PieceID).Num() : 0;
+}
+
+APuzzlePiece* APuzzleGameMode::GetPieceAtGridID(int32 GridID)
+{
+    if (GridID < 0 || GridID >= PuzzleWidth * PuzzleHeight)
+    {
+        return nullptr;
+    }
+    
+    if (GridOccupancy.IsValidIndex(GridID))
+    {
+        int32 PieceID = GridOccupancy[GridID];
+        if (PieceID >= 0 && PuzzlePieces.IsValidIndex(PieceID))
+        {
+            return PuzzlePieces[PieceID];
+        }
+    }
+    
+    return nullptr;
+}
+
+void APuzzleGameMode::UpdateGridOccupancy(int32 GridID, APuzzlePiece* Piece)
+{
+    if (GridID < 0 || GridID >= PuzzleWidth * PuzzleHeight || !GridOccupancy.IsValidIndex(GridID))
+    {
+        return;
+    }
+
+    if (Piece)
+    {
+        RecordReplayMove(EPuzzleReplayMoveType::Occupy, Piece->GetPieceID(), -1, GridID);
+    }
+
+    ApplyGridOccupancy(GridID, Piece);
+}
+
+void APuzzleGameMode::ApplyGridOccupancy(int32 GridID, APuzzlePiece* Piece)
+{
+    if (!GridOccupancy.IsValidIndex(GridID))
+    {
+        return;
+    }
+    
+    if (Piece)
+    {
+        int32 PieceID = Piece->GetPieceID();
+        
+        // Parçanın eski hücresini boşalt
+        const int32 OldGridID = PieceGridIDs.IsValidIndex(PieceID) ? PieceGridIDs[PieceID] : -1;
+        if (OldGridID >= 0 && OldGridID != GridID)
+        {
+            SetCellOccupant(OldGridID, -1);
+            SetCellOccupant(GridID, PieceID);
+
+            const int32 ChangedCells[] = { OldGridID, GridID };
+            NotifyCellsChanged(ChangedCells);
+            return;
+        }
+        
+        SetCellOccupant(GridID, PieceID);
+    }
+    else
+    {
+        SetCellOccupant(GridID, -1);
+    }
+
+    const int32 ChangedCells[] = { GridID };
+    NotifyCellsChanged(ChangedCells);
+}
+
+void APuzzleGameMode::SetCellOccupant(int32 GridID, int32 PieceID)
+{
+    // Tüm occupancy yazımları buradan geçer - ters eşleme senkron kalır
+    const int32 OldPieceID = GridOccupancy[GridID];
+    if (PieceGridIDs.IsValidIndex(OldPieceID) && PieceGridIDs[OldPieceID] == GridID)
+    {
+        PieceGridIDs[OldPieceID] = -1;
+    }
+
+    BoardJournal.RecordCell(GridID, OldPieceID == GridID);
+    BoardHash.OnCellChanged(GridID, OldPieceID, PieceID);
+
+    // Yazım sadece hücrenin ve komşularının skorunu değiştirir
+    if (EdgeSet.IsValid())
+    {
+        EdgeMatchScore -= EdgeSet->ScoreNeighbourhood(GridOccupancy, GridID);
+        GridOccupancy[GridID] = PieceID;
+        EdgeMatchScore += EdgeSet->ScoreNeighbourhood(GridOccupancy, GridID);
+    }
+    GridOccupancy[GridID] = PieceID;
+
+    if (PieceGridIDs.IsValidIndex(PieceID))
+    {
+        PieceGridIDs[PieceID] = GridID;
+    }
+
+    // Yerinden çıkarılan donmuş parça actor'üne geri döner
+    if (FrozenPieces.IsValidIndex(OldPieceID) && FrozenPieces[OldPieceID] && OldPieceID != PieceID)
+    {
+        PendingUnfreezePieces.AddUnique(OldPieceID);
+    }
+
+    // Doğru hücre ve chunk sayaçlarını artımlı tut
+    const int32 CorrectDelta = (PieceID == GridID ? 1 : 0) - (OldPieceID == GridID ? 1 : 0);
+    const int32 OccupiedDelta = (PieceID >= 0 ? 1 : 0) - (OldPieceID >= 0 ? 1 : 0);
+    CorrectCellCount += CorrectDelta;
+
+    const int32 ChunkIndex = GetChunkIndexForGridID(GridID);
+    if (ChunkIndex >= 0 && (CorrectDelta != 0 || OccupiedDelta != 0))
+    {
+        ChunkCorrectCounts[ChunkIndex] += CorrectDelta;
+        ChunkOccupiedCounts[ChunkIndex] += OccupiedDelta;
+        if (!DirtyProxyChunks[ChunkIndex])
+        {
+            DirtyProxyChunks[ChunkIndex] = true;
+            DirtyProxyList.Add(ChunkIndex);
+        }
+    }
+
+    if (IsIndirectionRendererActive())
+    {
+        IndirectionBoard->SetCell(GridID, PieceID);
+    }
+
+    if (IsHeatmapActive())
+    {
+        UpdateHeatmapCell(GridID, true);
+    }
+
+    // Tile içeriği parça kimliğine bağlı - doğru/dolu sayısı değişmese de yeniden bake et
+    if (ChunkIndex >= 0 && DirtyTileRegions.IsValidIndex(ChunkIndex) && !DirtyTileRegions[ChunkIndex] && OldPieceID != PieceID)
+    {
+        DirtyTileRegions[ChunkIndex] = true;
+        DirtyTileList.Add(ChunkIndex);
+    }
+}
+
+void APuzzleGameMode::NotifyCellsChanged(TArrayView<const int32> ChangedGridIDs)
+{
+    Clusters.OnCellsChanged(ChangedGridIDs, GridOccupancy);
+
+    const int32 SwapsBefore = SwapDistance.GetMinSwaps();
+    SwapDistance.OnCellsChanged(ChangedGridIDs, GridOccupancy);
+    LastOperationSwapGain = SwapsBefore - SwapDistance.GetMinSwaps();
+
+    NotifyPlayerActivity();
+
+    // Yeri değişen donmuş parçaları çöz, yeni oturan parçaları dondur
+    for (const int32 PieceID : PendingUnfreezePieces)
+    {
+        if (FrozenPieces[PieceID] && PieceGridIDs[PieceID] != PieceID)
+        {
+            UnfreezePiece(PieceID);
+        }
+    }
+    PendingUnfreezePieces.Reset();
+    EvaluateFreeze(ChangedGridIDs);
+
+    // İşlemin tüm texel'leri tek bölge güncellemesiyle gider
+    if (IsIndirectionRendererActive())
+    {
+        IndirectionBoard->FlushCells();
+    }
+    if (IsHeatmapActive())
+    {
+        HeatmapOverlay->FlushCells();
+    }
+
+    if (!IsChunkStreamingActive())
+    {
+        return;
+    }
+
+    // Yüklü chunk'a giren parçalar actor kazanır, yüklü olmayana gidenler sonra havuza döner
+    for (const int32 GridID : ChangedGridIDs)
+    {
+        const int32 PieceID = GridOccupancy[GridID];
+        if (PieceID < 0 || FrozenPieces[PieceID])
+        {
+            continue;
+        }
+
+        const int32 ChunkIndex = GetChunkIndexForGridID(GridID);
+        if (ResidentChunks[ChunkIndex])
+        {
+            PendingReleasePieces.Remove(PieceID);
+            if (!IsValid(PuzzlePieces[PieceID]))
+            {
+                AcquirePieceActor(PieceID, GetGridPositionFromID(GridID));
+            }
+        }
+        else if (IsValid(PuzzlePieces[PieceID]))
+        {
+            PendingReleasePieces.Add(PieceID);
+        }
+    }
+}
+
+bool APuzzleGameMode::IsGridCellOccupied(int32 GridID) const
+{
+    return GridOccupancy.IsValidIndex(GridID) && GridOccupancy[GridID] >= 0;
+}
+
+void APuzzleGameMode::SwapPiecesAtGridIDs(int32 GridID1, int32 GridID2)
+{
+    if (!GridOccupancy.IsValidIndex(GridID1) || !GridOccupancy.IsValidIndex(GridID2))
+    {
+        return;
+    }
+    
+    // Occupancy ID'leri üzerinden çalış - stream edilmiş parçaların actor'ü olmayabilir
+    const int32 PieceID1 = GridOccupancy[GridID1];
+    const int32 PieceID2 = GridOccupancy[GridID2];
+    if (PieceID1 < 0 && PieceID2 < 0)
+    {
+        return;
+    }
+
+    APuzzlePiece* Piece1 = GetPieceAtGridID(GridID1);
+    APuzzlePiece* Piece2 = GetPieceAtGridID(GridID2);
+    
+    FVector GridPos1 = GetGridPositionFromID(GridID1);
+    FVector GridPos2 = GetGridPositionFromID(GridID2);
+
+    RecordReplayMove(EPuzzleReplayMoveType::Swap, -1, GridID1, GridID2);
+    
+    if (IsValid(Piece1))
+    {
+        Piece1->MovePieceToLocation(GridPos2, false);
+    }
+    if (IsValid(Piece2))
+    {
+        Piece2->MovePieceToLocation(GridPos1, false);
+    }
+
+    SetCellOccupant(GridID1, PieceID2);
+    SetCellOccupant(GridID2, PieceID1);
+
+    const int32 ChangedCells[] = { GridID1, GridID2 };
+    NotifyCellsChanged(ChangedCells);
+}
+
+bool APuzzleGameMode::SlideTile(int32 GridID)
+{
+    if (!bSlidingTileMode || CurrentGameState != EPuzzleGameState::InProgress ||
+        !GridOccupancy.IsValidIndex(GridID) || !GridOccupancy.IsValidIndex(SlidingBlankGridID))
+    {
+        return false;
+    }
+
+    // Sadece boşluğa kenar komşusu olan taş kayabilir
+    const int32 TargetGridID = SlidingBlankGridID;
+    const int32 PieceID = GridOccupancy[GridID];
+    const int32 CellDistance = FMath::Abs(GridID % PuzzleWidth - TargetGridID % PuzzleWidth) +
+        FMath::Abs(GridID / PuzzleWidth - TargetGridID / PuzzleWidth);
+    if (PieceID < 0 || CellDistance != 1)
+    {
+        return false;
+    }
+
+    if (APuzzlePiece* Piece = GetPieceAtGridID(GridID))
+    {
+        Piece->MovePieceToLocation(GetGridPositionFromID(TargetGridID), false);
+    }
+
+    SetCellOccupant(GridID, -1);
+    SetCellOccupant(TargetGridID, PieceID);
+    SlidingBlankGridID = GridID;
+
+    const int32 ChangedCells[] = { GridID, TargetGridID };
+    NotifyCellsChanged(ChangedCells);
+
+    IncrementMoveCount();
+    return true;
+}
+
+void APuzzleGameMode::GetSlidingTiles(TArray<int32>& OutTiles) const
+{
+    // Boş hücre solver'a boşluk taşı (son parça) olarak verilir
+    OutTiles = GridOccupancy;
+    for (int32& Tile : OutTiles)
+    {
+        if (Tile < 0)
+        {
+            Tile = GridOccupancy.Num() - 1;
+        }
+    }
+}
+
+void APuzzleGameMode::AutoSolveSliding()
+{
+    StopSlidingAutoSolve();
+
+    if (!bSlidingTileMode || !SlidingSolver.IsValid() || CurrentGameState != EPuzzleGameState::InProgress)
+    {
+        return;
+    }
+
+    TArray<int32> Tiles;
+    GetSlidingTiles(Tiles);
+
+    TSharedPtr<std::atomic<bool>, ESPMode::ThreadSafe> Cancel = MakeShared<std::atomic<bool>, ESPMode::ThreadSafe>(false);
+    SlidingSolveCancel = Cancel;
+
+    TWeakObjectPtr<APuzzleGameMode> WeakThis(this);
+    SlidingSolveTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [WeakThis, Solver = SlidingSolver, Tiles, Cancel]()
+    {
+        FPuzzleSlidingSolution Solution;
+        Solver->Solve(Tiles, Solution, Cancel.Get());
+
+        if (Cancel->load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, Tiles, Cancel, Solution = MoveTemp(Solution)]()
+        {
+            APuzzleGameMode* GameMode = WeakThis.Get();
+            if (GameMode && !Cancel->load(std::memory_order_relaxed))
+            {
+                GameMode->OnSlidingSolutionFound(Tiles, Solution);
+            }
+        });
+    });
+}
+
+void APuzzleGameMode::OnSlidingSolutionFound(const TArray<int32>& SolvedTiles, const FPuzzleSlidingSolution& Solution)
+{
+    UE_LOG(LogPuzzleGame, Log, TEXT("Sliding solve: %d moves, %llu nodes, %d iterations, %.3fs"),
+        Solution.Moves.Num(), Solution.NodesExpanded, Solution.Iterations, Solution.Seconds);
+
+    // Arama sürerken board değiştiyse çözüm artık geçerli değil
+    TArray<int32> Tiles;
+    GetSlidingTiles(Tiles);
+    if (!Solution.bSolved || Tiles != SolvedTiles)
+    {
+        StopSlidingAutoSolve();
+        return;
+    }
+
+    SlidingAutoSolveMoves = Solution.Moves;
+    SlidingAutoSolveIndex = 0;
+    GetWorldTimerManager().SetTimer(SlidingAutoSolveTimerHandle, this, &APuzzleGameMode::StepSlidingAutoSolve,
+        FMath::Max(SlidingAutoSolveInterval, 0.01f), true);
+}
+
+void APuzzleGameMode::StepSlidingAutoSolve()
+{
+    if (!SlidingAutoSolveMoves.IsValidIndex(SlidingAutoSolveIndex) ||
+        !SlideTile(SlidingAutoSolveMoves[SlidingAutoSolveIndex++]) ||
+        SlidingAutoSolveIndex == SlidingAutoSolveMoves.Num())
+    {
+        StopSlidingAutoSolve();
+    }
+}
+
+void APuzzleGameMode::StopSlidingAutoSolve()
+{
+    if (SlidingSolveCancel.IsValid())
+    {
+        SlidingSolveCancel->store(true, std::memory_order_relaxed);
+        SlidingSolveCancel.Reset();
+    }
+
+    GetWorldTimerManager().ClearTimer(SlidingAutoSolveTimerHandle);
+    SlidingAutoSolveMoves.Reset();
+    SlidingAutoSolveIndex = 0;
+}
+
+bool APuzzleGameMode::MovePieceGroup(const TArray<int32>& SourceGridIDs, int32 DeltaCol, int32 DeltaRow)
+{
+    // Hex'te tek satır, üçgende tek parite kaydırma grubun şeklini bozar
+    const bool bPreservesShape = DispatchGridTopology(GridTopology, [DeltaCol, DeltaRow](auto Policy)
+    {
+        return decltype(Policy)::PreservesShape(DeltaCol, DeltaRow);
+    });
+    if (!bPreservesShape)
+    {
+        return false;
+    }
+
+    FPuzzleBoardTransaction Transaction;
+    if (!FPuzzleBoardTransaction::BuildGroupTranslation(PuzzleWidth, PuzzleHeight, GridOccupancy,
+        SourceGridIDs, DeltaCol, DeltaRow, Transaction))
+    {
+        return false;
+    }
+
+    if (bRecordReplay && CurrentGameState != EPuzzleGameState::Completed)
+    {
+        RecordReplayMove(EPuzzleReplayMoveType::Group, -1, -1, -1);
+        FPuzzleReplayMove& Move = CurrentReplay.Moves.Last();
+        Move.GroupGridIDs = SourceGridIDs;
+        Move.DeltaCol = DeltaCol;
+        Move.DeltaRow = DeltaRow;
+    }
+
+    CommitBoardTransaction(Transaction);
+    return true;
+}
+
+void APuzzleGameMode::CommitBoardTransaction(const FPuzzleBoardTransaction& Transaction)
+{
+    // Tek occupancy geçişi - önce eski içerikleri temizle ki ters eşleme doğru kalsın
+    TArray<int32, TInlineAllocator<64>> ChangedCells;
+    for (const FPuzzleCellWrite& Write : Transaction.CellWrites)
+    {
+        SetCellOccupant(Write.GridID, -1);
+        ChangedCells.Add(Write.GridID);
+    }
+    for (const FPuzzleCellWrite& Write : Transaction.CellWrites)
+    {
+        SetCellOccupant(Write.GridID, Write.PieceID);
+    }
+
+    NotifyCellsChanged(ChangedCells);
+
+    // Parçaları yeni hücrelerine taşı
+    for (const FPuzzleCellWrite& Write : Transaction.CellWrites)
+    {
+        if (PuzzlePieces.IsValidIndex(Write.PieceID) && IsValid(PuzzlePieces[Write.PieceID]))
+        {
+            PuzzlePieces[Write.PieceID]->MovePieceToLocation(GetGridPositionFromID(Write.GridID), false);
+        }
+    }
+}
+
+void APuzzleGameMode::RecordReplayMove(EPuzzleReplayMoveType Type, int32 PieceID, int32 FromGridID, int32 ToGridID)
+{
+    // Tamamlandıktan sonraki hamleler leaderboard'u etkilemez
+    if (!bRecordReplay || !bReplayActive || CurrentGameState == EPuzzleGameState::Completed)
+    {
+        return;
+    }
+
+    // Duraklatma timer'ın saniye kesrini sıfırlar - kayıt zamanı geri gitmesin
+    const float Time = CurrentReplay.Moves.Num() > 0
+        ? FMath::Max(GetReplayTimestamp(), CurrentReplay.Moves.Last().Time)
+        : GetReplayTimestamp();
+
+    FPuzzleReplayMove& Move = CurrentReplay.Moves.AddDefaulted_GetRef();
+    Move.Type = Type;
+    Move.PieceID = PieceID;
+    Move.FromGridID = FromGridID;
+    Move.ToGridID = ToGridID;
+    Move.Time = Time;
+}
+
+float APuzzleGameMode::GetReplayTimestamp() const
+{
+    // GameTime tam saniye sayar, aradaki kesri timer'dan al
+    const float TickElapsed = GetWorldTimerManager().GetTimerElapsed(GameTimerHandle);
+    return GameTime + FMath::Max(TickElapsed, 0.0f);
+}
+
+bool APuzzleGameMode::SaveReplayToFile(const FString& FilePath)
+{
+    if (!FPuzzleReplayValidator::SaveRecordToFile(CurrentReplay, FilePath))
+    {
+        UE_LOG(LogPuzzleGame, Warning, TEXT("Failed to save replay to %s"), *FilePath);
+        return false;
+    }
+    return true;
+}
+
+void APuzzleGameMode::ForceCheckGameCompletion()
+{
+    
+    PrintAllPiecePositions();
+    
+    if (CheckGameCompletion())
+    {
+        OnGameComplete();
+    }
+    else
+    {
+    }
+}
+
+void APuzzleGameMode::DebugPuzzleState()
+{
+    
+    PrintAllPiecePositions();
+    
+    int32 EmptyCells = 0;
+    for (int32 i = 0; i < GridOccupancy.Num(); i++)
+    {
+        if (GridOccupancy[i] < 0)
+        {
+            EmptyCells++;
+        }
+    }
+    
+    UE_LOG(LogPuzzleGame, Log, TEXT("Board %dx%d: %d correct, %d wrong, %d empty, %d moves, %.0fs"),
+        PuzzleWidth, PuzzleHeight, CorrectCellCount, GridOccupancy.Num() - CorrectCellCount - EmptyCells,
+        EmptyCells, TotalMoves, GameTime);
+    UE_LOG(LogPuzzleGame, Log, TEXT("Min swaps remaining: %d (%d cycles), move efficiency %.2f"),
+        GetMinSwapsRemaining(), SwapDistance.GetCycleCount(), GetMoveEfficiency());
+    UE_LOG(LogPuzzleGame, Log, TEXT("Board hash: %016llx"), BoardHash.Get());
+
+    if (bSlidingTileMode && SlidingSolver.IsValid())
+    {
+        TArray<int32> Tiles;
+        GetSlidingTiles(Tiles);
+        UE_LOG(LogPuzzleGame, Log, TEXT("Sliding: blank at %d, at least %d moves remaining"),
+            SlidingBlankGridID, SlidingSolver->EstimateMoves(Tiles));
+    }
+
+    if (EdgeSet.IsValid())
+    {
+        UE_LOG(LogPuzzleGame, Log, TEXT("Edge matching: score %d/%d, %d mismatched edges"),
+            EdgeMatchScore, EdgeSet->GetSolvedScore(), EdgeSet->CountMismatchedEdges(GridOccupancy));
+    }
+
+    if (FreePlacement.IsActive())
+    {
+        UE_LOG(LogPuzzleGame, Log, TEXT("Free placement: %d/%d pieces on the table, group of piece 0: %d"),
+            FreePlacement.GetNumPlaced(), FreePlacement.GetNumPieces(), GetFreeGroupSize(0));
+    }
+    
+    // Hücre durumlarını board üzerinde göster
+    SetHeatmapVisible(true);
+}
+
+void APuzzleGameMode::VerifyBoardHash()
+{
+    const uint64 Recomputed = FPuzzleZobristHash::Compute(GridOccupancy);
+    if (BoardHash.Get() != Recomputed)
+    {
+        UE_LOG(LogPuzzleGame, Error, TEXT("Board hash mismatch: incremental %016llx, recomputed %016llx"), BoardHash.Get(), Recomputed);
+    }
+    else
+    {
+        UE_LOG(LogPuzzleGame, Log, TEXT("Board hash OK: %016llx"), Recomputed);
+    }
+}
+
+void APuzzleGameMode::BenchmarkSlidingSolver()
+{
+    // Korf'un 100 örneğinden zor 4x4 board'lar - boşluk 0, hedef sıralı
+    // PuzzleSlidingSolverTest aynı board'larla 1 saniye sınırını doğrular
+    static const int32 Instances[][16] =
+    {
+        { 14, 13, 15, 7, 11, 12, 9, 5, 6, 0, 2, 1, 4, 8, 10, 3 },
+        { 13, 5, 4, 10, 9, 12, 8, 14, 2, 3, 7, 1, 0, 15, 11, 6 },
+        { 14, 7, 8, 2, 13, 11, 10, 4, 9, 12, 5, 0, 3, 6, 1, 15 },
+    };
+
+    // Oyunun pattern database'i boşluğu son taş sayar - board merkeze göre yansıtılır (mesafe aynı kalır)
+    const FPuzzleSlidingSolver Solver(4, 4, 15, FPuzzlePatternDatabase::FindOrLoad(4, 4));
+    UE_LOG(LogPuzzleGame, Log, TEXT("Sliding benchmark heuristic: %s"),
+        Solver.HasPatternDatabase() ? TEXT("pattern database") : TEXT("Manhattan + linear conflict"));
+
+    int32 UnderTarget = 0;
+    for (int32 Index = 0; Index < UE_ARRAY_COUNT(Instances); Index++)
+    {
+        int32 Tiles[16];
+        for (int32 Cell = 0; Cell < 16; Cell++)
+        {
+            Tiles[15 - Cell] = 15 - Instances[Index][Cell];
+        }
+
+        FPuzzleSlidingSolution Solution;
+        Solver.Solve(MakeArrayView(Tiles, 16), Solution);
+        UnderTarget += Solution.bSolved && Solution.Seconds < 1.0 ? 1 : 0;
+
+        UE_LOG(LogPuzzleGame, Log, TEXT("Sliding benchmark #%d: %s in %d moves, %llu nodes, %d iterations, %.3fs%s"),
+            Index + 1, Solution.bSolved ? TEXT("solved") : TEXT("FAILED"), Solution.Moves.Num(),
+            Solution.NodesExpanded, Solution.Iterations, Solution.Seconds,
+            Solution.Seconds < 1.0 ? TEXT("") : TEXT(" (over 1s target)"));
+    }
+
+    // Hedef karşılanmıyorsa açıkça söyle - bu board'lar Content/PatternDatabases'taki dosya olmadan saniyeler sürer
+    if (UnderTarget < UE_ARRAY_COUNT(Instances))
+    {
+        UE_LOG(LogPuzzleGame, Warning, TEXT("Sliding benchmark: sub-second target NOT met, %d of %d hard boards solved under 1s"),
+            UnderTarget, (int32)UE_ARRAY_COUNT(Instances));
+    }
+    else
+    {
+        UE_LOG(LogPuzzleGame, Log, TEXT("Sliding benchmark: all %d hard boards solved under 1s"), UnderTarget);
+    }
+}
+
+void APuzzleGameMode::BenchmarkEdgeMatchingSolver(int32 Size, int32 Colours)
+{
+    Size = FMath::Clamp(Size, 2, 64);
+    const TSharedRef<const FPuzzleEdgeSet, ESPMode::ThreadSafe> BenchmarkSet = FPuzzleEdgeSet::Generate(Size, Size, Colours, 1);
+
+    // Döndürmeli arama 4 kat yönlendirme tarar - oyunda kapalı, Eternity II kurallarında açık
+    for (const bool bAllowRotation : { false, true })
+    {
+        const FPuzzleEdgeSolver Solver(BenchmarkSet, bAllowRotation);
+        FPuzzleEdgeSolution Solution;
+        Solver.Solve(TArrayView<const int32>(), Solution);
+
+        UE_LOG(LogPuzzleGame, Log, TEXT("Edge benchmark %dx%d, %d colours, rotation %s: %s, %llu nodes, %.3fs"),
+            Size, Size, Colours, bAllowRotation ? TEXT("on") : TEXT("off"),
+            Solution.bSolved ? TEXT("solved") : TEXT("FAILED"), Solution.NodesExpanded, Solution.Seconds);
+    }
+
+    // Board doğrulayıcısının artımlı skorla tutarlılığı
+    if (EdgeSet.IsValid())
+    {
+        int32 Recomputed = 0;
+        for (int32 GridID = 0; GridID < GridOccupancy.Num(); GridID++)
+        {
+            Recomputed += EdgeSet->ScoreCell(GridOccupancy, GridID);
+        }
+        UE_LOG(LogPuzzleGame, Log, TEXT("Edge score: incremental %d, recomputed %d, %d mismatched edges"),
+            EdgeMatchScore, Recomputed, EdgeSet->CountMismatchedEdges(GridOccupancy));
+    }
+}
+
+void APuzzleGameMode::BenchmarkFreePlacement(int32 Size)
+{
+    Size = FMath::Clamp(Size, 2, 1000);
+    const float Spacing = 100.0f;
+    const int32 NumPieces = Size * Size;
+
+    TArray<FVector2D> CorrectPositions;
+    CorrectPositions.SetNumUninitialized(NumPieces);
+    for (int32 PieceID = 0; PieceID < NumPieces; PieceID++)
+    {
+        CorrectPositions[PieceID] = FVector2D((PieceID % Size) * Spacing, (PieceID / Size) * Spacing);
+    }
+
+    FPuzzleFreePlacement Benchmark;
+    Benchmark.Init(Size, Size, EPuzzleGridTopology::Square, CorrectPositions, Spacing);
+
+    // Önce tüm parçalar masaya dağılır, sonra rastgele sırayla doğru yerine küçük bir sapmayla bırakılır
+    FRandomStream Random(1);
+    const float TableSize = Size * Spacing * 3.0f;
+    for (int32 PieceID = 0; PieceID < NumPieces; PieceID++)
+    {
+        Benchmark.SetPiecePosition(PieceID, FVector2D(Random.FRandRange(-TableSize, TableSize), Random.FRandRange(-TableSize, TableSize)));
+    }
+
+    TArray<int32> Order;
+    Order.SetNumUninitialized(NumPieces);
+    for (int32 PieceID = 0; PieceID < NumPieces; PieceID++)
+    {
+        Order[PieceID] = PieceID;
+    }
+    for (int32 Index = NumPieces - 1; Index > 0; Index--)
+    {
+        Swap(Order[Index], Order[Random.RandRange(0, Index)]);
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+    TArray<int32> MovedPieces;
+    int32 Snaps = 0;
+    for (const int32 PieceID : Order)
+    {
+        // Sadece yalnız parçalar bırakılır - gruba katılmış parçanın yeri grubuyla belirlenir
+        if (Benchmark.GetGroupMembers(PieceID).Num() > 1)
+        {
+            continue;
+        }
+
+        const FVector2D Jitter(Random.FRandRange(-5.0f, 5.0f), Random.FRandRange(-5.0f, 5.0f));
+        Benchmark.SetPiecePosition(PieceID, CorrectPositions[PieceID] + Jitter);
+        MovedPieces.Reset();
+        Snaps += Benchmark.SnapGroup(PieceID, 25.0f, MovedPieces) ? 1 : 0;
+    }
+    const double Seconds = FPlatformTime::Seconds() - StartTime;
+
+    UE_LOG(LogPuzzleGame, Log, TEXT("Free placement benchmark %dx%d: %d snaps in %.1fms (%.2fus per release), complete %s"),
+        Size, Size, Snaps, Seconds * 1000.0, Seconds * 1000000.0 / NumPieces,
+        Benchmark.IsComplete() ? TEXT("yes") : TEXT("NO"));
+}
+
+void APuzzleGameMode::BenchmarkPieceShapes(int32 Size)
+{
+    Size = FMath::Clamp(Size, 2, 256);
+    const TSharedRef<const FPuzzlePieceShapeSet, ESPMode::ThreadSafe> Shapes =
+        FPuzzlePieceShapeSet::Generate(Size, Size, PieceShapeVariants, 1);
+
+    TArray<uint32> Signatures;
+    Shapes->GetUniqueSignatures(Signatures);
+
+    // Cache'siz en kötü durum: her parça kendi mesh'ini kurar
+    double StartTime = FPlatformTime::Seconds();
+    int32 NumTriangles = 0;
+    for (int32 PieceID = 0; PieceID < Shapes->GetNumPieces(); PieceID++)
+    {
+        FMeshDescription Description;
+        FPuzzlePieceShapeSet::BuildMeshDescription(Shapes->GetSignature(PieceID), PieceSpacing, PieceShapeThickness, PieceShapeCurveSegments, Description);
+        NumTriangles += Description.Triangles().Num();
+    }
+    const double SerialSeconds = FPlatformTime::Seconds() - StartTime;
+
+    StartTime = FPlatformTime::Seconds();
+    TArray<FMeshDescription> Descriptions;
+    Descriptions.SetNum(Signatures.Num());
+    ParallelFor(Signatures.Num(), [&](int32 Index)
+    {
+        FPuzzlePieceShapeSet::BuildMeshDescription(Signatures[Index], PieceSpacing, PieceShapeThickness, PieceShapeCurveSegments, Descriptions[Index]);
+    });
+    const double ParallelSeconds = FPlatformTime::Seconds() - StartTime;
+
+    // Yükleme sırasında asıl maliyet game thread'deki UStaticMesh kurulumu - iş kuyruğu adım adım, WorkBudgetMs içinde çalıştırır
+    double MeshSeconds = 0.0;
+    double MaxMeshSeconds = 0.0;
+    for (const FMeshDescription& Description : Descriptions)
+    {
+        StartTime = FPlatformTime::Seconds();
+        CreatePieceShapeMesh(Description);
+        const double Seconds = FPlatformTime::Seconds() - StartTime;
+        MeshSeconds += Seconds;
+        MaxMeshSeconds = FMath::Max(MaxMeshSeconds, Seconds);
+    }
+
+    // Her frame en az bir adım çalışır - bütçeden uzun adımlar kendi frame'ini alır
+    const double BudgetSeconds = WorkBudgetMs / 1000.0;
+    const int32 EstimatedFrames = FMath::Max((int32)FMath::CeilToDouble(MeshSeconds / FMath::Max(BudgetSeconds, MaxMeshSeconds)), Descriptions.Num() > 0 ? 1 : 0);
+
+    UE_LOG(LogPuzzleGame, Log, TEXT("Piece shape benchmark %dx%d, %d variants: %d unique shapes, %.0f triangles per piece"),
+        Size, Size, PieceShapeVariants, Signatures.Num(), (double)NumTriangles / Shapes->GetNumPieces());
+    UE_LOG(LogPuzzleGame, Log, TEXT("  every piece serial %.1fms, unique shapes parallel %.1fms"),
+        SerialSeconds * 1000.0, ParallelSeconds * 1000.0);
+    UE_LOG(LogPuzzleGame, Log, TEXT("  meshes on game thread %.1fms (max %.2fms), about %d frames at %.1fms budget, %.2fs at 60 fps"),
+        MeshSeconds * 1000.0, MaxMeshSeconds * 1000.0, EstimatedFrames, WorkBudgetMs, ParallelSeconds + EstimatedFrames / 60.0);
+}
+
+void APuzzleGameMode::BenchmarkImageImport(const FString& FilePath)
+{
+    IImageWrapperModule& ImageWrapperModule = FModuleManager::LoadModuleChecked<IImageWrapperModule>(FName("ImageWrapper"));
+
+    FPuzzleImageImportSettings Settings;
+    Settings.GridWidth = PuzzleWidth;
+    Settings.GridHeight = PuzzleHeight;
+    Settings.MaxTileSize = ImportMaxTileSize;
+    Settings.ThumbnailSize = ImportThumbnailSize;
+    Settings.TileMargin = bProceduralPieceShapes ? FPuzzlePieceShapeSet::TileMargin : 0.0f;
+    Settings.MemoryBudgetBytes = (int64)ImportMemoryBudgetMB * 1024 * 1024;
+
+    // İkinci koşuda dosya OS cache'inde - okuma süreleri karşılaştırılmaz
+    for (const bool bParallel : { false, true })
+    {
+        Settings.bParallel = bParallel;
+        FPuzzleImageImportResult Result;
+        const double StartTime = FPlatformTime::Seconds();
+        if (!FPuzzleImageImport::Import(FilePath, ImageWrapperModule, Settings, Result))
+        {
+            UE_LOG(LogPuzzleGame, Warning, TEXT("Image import benchmark failed: %s"), *Result.Error);
+            return;
+        }
+        const double Seconds = FPlatformTime::Seconds() - StartTime;
+
+        const FPuzzleImageImportStats& Stats = Result.Stats;
+        UE_LOG(LogPuzzleGame, Log, TEXT("Image import %s, %dx%d grid: %dx%d -> 1/%d, %d px tiles, peak %.1f of %d MB"),
+            bParallel ? TEXT("parallel") : TEXT("single thread"), PuzzleWidth, PuzzleHeight, Stats.DecodedWidth, Stats.DecodedHeight,
+            Stats.Downscale, Result.Tiles[0].Size, Stats.PeakBytes / (1024.0 * 1024.0), ImportMemoryBudgetMB);
+        UE_LOG(LogPuzzleGame, Log, TEXT("  read %.1fms, decode %.1fms, downscale %.1fms, slice %.1fms, total %.1fms"),
+            Stats.ReadSeconds * 1000.0, Stats.DecodeSeconds * 1000.0, Stats.DownscaleSeconds * 1000.0,
+            Stats.SliceSeconds * 1000.0, Seconds * 1000.0);
+    }
+}
+
+void APuzzleGameMode::ToggleHeatmapOverlay()
+{
+    SetHeatmapVisible(!bShowHeatmapOverlay);
+}
+
+void APuzzleGameMode::SetHeatmapVisible(bool bVisible)
+{
+    GetWorldTimerManager().ClearTimer(HeatmapTimerHandle);
+
+    // Texel'ler dikdörtgen hücreler - altıgen ve üçgen hücreler texture ızgarasına oturmaz
+    if (bVisible && GridTopology != EPuzzleGridTopology::Square)
+    {
+        UE_LOG(LogPuzzleGame, Warning, TEXT("Heatmap overlay requires a square grid"));
+        bVisible = false;
+    }
+    bShowHeatmapOverlay = bVisible;
+
+    if (!bVisible)
+    {
+        // Gizliyken güncelleme yapılmaz, texture serbest bırakılır
+        if (IsValid(HeatmapOverlay))
+        {
+            HeatmapOverlay->ClearOverlay();
+        }
+        HeatmapChangeTimes.Empty();
+        RecentHeatmapCells.Empty();
+        RecentHeatmapHead = 0;
+#if ENABLE_DRAW_DEBUG
+        FlushPersistentDebugLines(GetWorld());
+#endif
+        return;
+    }
+
+    if (!IsValid(HeatmapOverlay))
+    {
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        HeatmapOverlay = GetWorld()->SpawnActor<APuzzleHeatmapOverlay>(APuzzleHeatmapOverlay::StaticClass(), FTransform::Identity, SpawnParams);
+        if (!HeatmapOverlay)
+        {
+            return;
+        }
+    }
+
+    FVector2D CellAreaMin, CellAreaMax;
+    GetBoardCellArea(CellAreaMin, CellAreaMax);
+    if (!HeatmapOverlay->InitializeOverlay(PuzzleWidth, PuzzleHeight, CellAreaMin, CellAreaMax, HeatmapEmptyColor.ToFColor(false)))
+    {
+        UE_LOG(LogPuzzleGame, Warning, TEXT("Heatmap overlay unavailable for %dx%d board"), PuzzleWidth, PuzzleHeight);
+        return;
+    }
+
+    RebuildHeatmap();
+    HeatmapOverlay->SetOverlayVisible(true);
+    DrawBoundaryDebug();
+
+    if (HeatmapRecentSeconds > 0.0f)
+    {
+        GetWorldTimerManager().SetTimer(HeatmapTimerHandle, this, &APuzzleGameMode::ExpireHeatmapChanges,
+            FMath::Min(HeatmapRecentSeconds, 0.25f), true);
+    }
+}
+
+bool APuzzleGameMode::IsHeatmapActive() const
+{
+    return bShowHeatmapOverlay && IsValid(HeatmapOverlay) && HeatmapOverlay->IsInitialized();
+}
+
+void APuzzleGameMode::RebuildHeatmap()
+{
+    HeatmapChangeTimes.Init(-FLT_MAX, GridOccupancy.Num());
+    RecentHeatmapCells.Reset();
+    RecentHeatmapHead = 0;
+
+    for (int32 GridID = 0; GridID < GridOccupancy.Num(); GridID++)
+    {
+        UpdateHeatmapCell(GridID, false);
+    }
+    HeatmapOverlay->FlushCells();
+}
+
+void APuzzleGameMode::UpdateHeatmapCell(int32 GridID, bool bRecentlyChanged)
+{
+    FLinearColor Color = HeatmapEmptyColor;
+    if (bRecentlyChanged && HeatmapRecentSeconds > 0.0f)
+    {
+        Color = HeatmapRecentColor;
+        HeatmapChangeTimes[GridID] = GetWorld()->GetTimeSeconds();
+        RecentHeatmapCells.Emplace(GridID, HeatmapChangeTimes[GridID]);
+    }
+    else if (GridOccupancy[GridID] == GridID)
+    {
+        Color = HeatmapCorrectColor;
+    }
+    else if (GridOccupancy[GridID] >= 0)
+    {
+        Color = HeatmapWrongColor;
+    }
+
+    HeatmapOverlay->SetCellColor(GridID, Color.ToFColor(false));
+}
+
+void APuzzleGameMode::ExpireHeatmapChanges()
+{
+    if (!IsHeatmapActive())
+    {
+        return;
+    }
+
+    // Kuyruk zaman sıralı - sadece süresi dolan baştaki hücreler işlenir
+    const float Now = GetWorld()->GetTimeSeconds();
+    while (RecentHeatmapHead < RecentHeatmapCells.Num())
+    {
+        const TPair<int32, float>& Entry = RecentHeatmapCells[RecentHeatmapHead];
+        if (Entry.Value + HeatmapRecentSeconds > Now)
+        {
+            break;
+        }
+        RecentHeatmapHead++;
+
+        // Hücre daha sonra yeniden değiştiyse kendi girdisi sonra gelecek
+        if (HeatmapChangeTimes[Entry.Key] == Entry.Value)
+        {
+            HeatmapChangeTimes[Entry.Key] = -FLT_MAX;
+            UpdateHeatmapCell(Entry.Key, false);
+        }
+    }
+
+    if (RecentHeatmapHead == RecentHeatmapCells.Num())
+    {
+        RecentHeatmapCells.Reset();
+        RecentHeatmapHead = 0;
+    }
+
+    HeatmapOverlay->FlushCells();
+}
+
+bool APuzzleGameMode::IsChunkStreamingActive() const
+{
+    // Chunk'lar ve kamera izdüşümü kare grid'e göre hesaplanır
+    return bEnableChunkStreaming && GridTopology == EPuzzleGridTopology::Square && ChunkSize > 0 && GridOccupancy.Num() >= StreamingMinCells;
+}
+
+int32 APuzzleGameMode::GetResidentChunkCount() const
+{
+    return ResidentChunks.CountSetBits();
+}
+
+void APuzzleGameMode::InitializeChunks()
+{
+    ChunksX = 0;
+    ChunksY = 0;
+    ResidentChunks.Empty();
+    DirtyProxyChunks.Empty();
+    DirtyProxyList.Reset();
+    DirtyTileRegions.Empty();
+    DirtyTileList.Reset();
+    bTileLODZoomedOut = false;
+    ChunkOccupiedCounts.Reset();
+    ChunkCorrectCounts.Reset();
+    ChunkGridMarkers.Empty();
+
+    if (!IsChunkStreamingActive())
+    {
+        if (IsValid(BoardProxy))
+        {
+            BoardProxy->ClearChunks();
+        }
+        if (IsValid(BoardTiles))
+        {
+            BoardTiles->ClearTiles();
+        }
+        return;
+    }
+
+    ChunksX = FMath::DivideAndRoundUp(PuzzleWidth, ChunkSize);
+    ChunksY = FMath::DivideAndRoundUp(PuzzleHeight, ChunkSize);
+    const int32 NumChunks = ChunksX * ChunksY;
+
+    ResidentChunks.Init(false, NumChunks);
+    DirtyProxyChunks.Init(false, NumChunks);
+    ChunkOccupiedCounts.Init(0, NumChunks);
+    ChunkCorrectCounts.Init(0, NumChunks);
+
+    // Marker'lar chunk yüklendikçe oluşturulur
+    ClearGridVisualization();
+
+    // Proxy görünürlüğü tile LOD'un aktif olup olmadığına bağlı, önce tile'ları hazırla
+    InitializeTileLOD();
+
+    if (!IsValid(BoardProxy))
+    {
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        BoardProxy = GetWorld()->SpawnActor<APuzzleBoardProxy>(APuzzleBoardProxy::StaticClass(), FTransform::Identity, SpawnParams);
+    }
+
+    if (BoardProxy)
+    {
+        // Proxy'ler tile atlas'ını örnekler - atlas yoksa sadece doluluk rengi
+        BoardProxy->InitializeChunks(PuzzleWidth, PuzzleHeight, ChunkSize, ChunkProxyMaterial,
+            IsValid(BoardTiles) ? BoardTiles->GetTileTexture() : nullptr);
+        for (int32 ChunkIndex = 0; ChunkIndex < NumChunks; ChunkIndex++)
+        {
+            UpdateChunkProxy(ChunkIndex);
+        }
+        BoardProxy->FlushChunkUpdates();
+    }
+
+    UE_LOG(LogPuzzleGame, Log, TEXT("Chunk streaming enabled: %dx%d board in %dx%d chunks of %d"),
+        PuzzleWidth, PuzzleHeight, ChunksX, ChunksY, ChunkSize);
+}
+
+int32 APuzzleGameMode::GetChunkIndexForGridID(int32 GridID) const
+{
+    if (ChunksX <= 0 || PuzzleWidth <= 0 || !GridOccupancy.IsValidIndex(GridID))
+    {
+        return -1;
+    }
+
+    const int32 Row = GridID / PuzzleWidth;
+    const int32 Col = GridID % PuzzleWidth;
+    return (Row / ChunkSize) * ChunksX + (Col / ChunkSize);
+}
+
+void APuzzleGameMode::GetChunkCellRange(int32 ChunkIndex, int32& OutMinCol, int32& OutMinRow, int32& OutMaxCol, int32& OutMaxRow) const
+{
+    OutMinCol = (ChunkIndex % ChunksX) * ChunkSize;
+    OutMinRow = (ChunkIndex / ChunksX) * ChunkSize;
+    OutMaxCol = FMath::Min(OutMinCol + ChunkSize, PuzzleWidth) - 1;
+    OutMaxRow = FMath::Min(OutMinRow + ChunkSize, PuzzleHeight) - 1;
+}
+
+bool APuzzleGameMode::GetCameraViewBounds(FBox2D& OutBounds) const
+{
+    APlayerController* PC = GetWorld() ? GetWorld()->GetFirstPlayerController() : nullptr;
+    if (!PC)
     {
-        GridOccupancy[i] = -1;
+        return false;
     }
-    
-    for (int32 i = 0; i < TotalPieces; i++)
+
+    int32 ViewportX = 0;
+    int32 ViewportY = 0;
+    PC->GetViewportSize(ViewportX, ViewportY);
+    if (ViewportX <= 0 || ViewportY <= 0)
     {
-        PuzzlePieces[i] = nullptr;
+        return false;
     }
-    
-    // Parçaç ID leri karıştır 
-    AvailablePieceIDs.Empty();
-    for (int32 i = 0; i < TotalPieces; i++)
+
+    // Ekran köşelerini board düzlemine (Z=0) iz düşür
+    const FVector2D Corners[] = {
+        FVector2D(0.0f, 0.0f),
+        FVector2D(ViewportX, 0.0f),
+        FVector2D(0.0f, ViewportY),
+        FVector2D(ViewportX, ViewportY)
+    };
+
+    OutBounds = FBox2D(ForceInit);
+    for (const FVector2D& Corner : Corners)
     {
-        AvailablePieceIDs.Add(i);
+        FVector WorldLocation;
+        FVector WorldDirection;
+        if (!PC->DeprojectScreenPositionToWorld(Corner.X, Corner.Y, WorldLocation, WorldDirection))
+        {
+            return false;
+        }
+
+        float Distance = MaxStreamingViewDistance;
+        if (WorldDirection.Z < -KINDA_SMALL_NUMBER)
+        {
+            Distance = FMath::Min(-WorldLocation.Z / WorldDirection.Z, MaxStreamingViewDistance);
+        }
+
+        const FVector Hit = WorldLocation + WorldDirection * Distance;
+        OutBounds += FVector2D(Hit.X, Hit.Y);
     }
-    
-    // Duplike için kontrol et
-    TSet<int32> UniqueCheck;
-    for (int32 ID : AvailablePieceIDs)
+
+    return OutBounds.bIsValid;
+}
+
+void APuzzleGameMode::UpdateChunkStreaming()
+{
+    if (!IsChunkStreamingActive() || ChunksX <= 0)
+    {
+        return;
+    }
+
+    const int32 NumChunks = ChunksX * ChunksY;
+    TBitArray<> WantedChunks(false, NumChunks);
+
+    FBox2D ViewBounds;
+    if (GetCameraViewBounds(ViewBounds))
     {
-        bool bAlreadyInSet = false;
-        UniqueCheck.Add(ID, &bAlreadyInSet);
-        if (bAlreadyInSet)
+        // Hücre merkezi grid pozisyonunda, kenarı yarım aralık geride
+        const float ChunkWorldSize = ChunkSize * PieceSpacing;
+        const FVector2D Origin(PuzzleStartLocation.X - PieceSpacing * 0.5f, PuzzleStartLocation.Y - PieceSpacing * 0.5f);
+
+        const int32 MinChunkX = FMath::Max(FMath::FloorToInt((ViewBounds.Min.X - Origin.X) / ChunkWorldSize) - StreamingMarginChunks, 0);
+        const int32 MinChunkY = FMath::Max(FMath::FloorToInt((ViewBounds.Min.Y - Origin.Y) / ChunkWorldSize) - StreamingMarginChunks, 0);
+        const int32 MaxChunkX = FMath::Min(FMath::FloorToInt((ViewBounds.Max.X - Origin.X) / ChunkWorldSize) + StreamingMarginChunks, ChunksX - 1);
+        const int32 MaxChunkY = FMath::Min(FMath::FloorToInt((ViewBounds.Max.Y - Origin.Y) / ChunkWorldSize) + StreamingMarginChunks, ChunksY - 1);
+
+        // Yeterince uzaktan bakılıyorsa parçalar yerine sadece tile'lar çizilir
+        const FVector2D ViewSize = ViewBounds.GetSize();
+        const double VisibleCells = (ViewSize.X / PieceSpacing) * (ViewSize.Y / PieceSpacing);
+        bTileLODZoomedOut = IsTileLODActive() && VisibleCells > TileLODMaxVisibleCells;
+
+        for (int32 ChunkY = MinChunkY; ChunkY <= MaxChunkY && !bTileLODZoomedOut; ChunkY++)
         {
+            for (int32 ChunkX = MinChunkX; ChunkX <= MaxChunkX; ChunkX++)
+            {
+                WantedChunks[ChunkY * ChunksX + ChunkX] = true;
+            }
         }
     }
-    
-    for (int32 i = AvailablePieceIDs.Num() - 1; i > 0; i--)
+
+    // Yakın görünümde parçalar actor olarak çizilir - tile quad altta ikinci kopya göstermesin
+    if (IsTileLODActive())
     {
-        int32 j = FMath::RandRange(0, i);
-        AvailablePieceIDs.Swap(i, j);
+        BoardTiles->SetTilesVisible(bTileLODZoomedOut);
     }
-    
-    // Debug: Log 
-    FString InitialPieces = TEXT("Initial available pieces: ");
-    for (int32 ID : AvailablePieceIDs)
+
+    for (int32 ChunkIndex = 0; ChunkIndex < NumChunks; ChunkIndex++)
+    {
+        const bool bWanted = WantedChunks[ChunkIndex];
+        if (bWanted && !ResidentChunks[ChunkIndex])
+        {
+            MaterializeChunk(ChunkIndex);
+        }
+        else if (!bWanted && ResidentChunks[ChunkIndex])
+        {
+            DematerializeChunk(ChunkIndex);
+        }
+    }
+
+    // Yüklü olmayan chunk'lara taşınmış parçaları havuza döndür (tutulanlar hariç)
+    for (auto It = PendingReleasePieces.CreateIterator(); It; ++It)
     {
-        InitialPieces += FString::Printf(TEXT("%d "), ID);
+        const int32 PieceID = *It;
+        APuzzlePiece* Piece = PuzzlePieces.IsValidIndex(PieceID) ? PuzzlePieces[PieceID] : nullptr;
+        if (!IsValid(Piece))
+        {
+            It.RemoveCurrent();
+            continue;
+        }
+        if (Piece->IsSelected() || Piece->IsMoving())
+        {
+            continue;
+        }
+
+        const int32 ChunkIndex = GetChunkIndexForGridID(PieceGridIDs[PieceID]);
+        if (ChunkIndex < 0 || !ResidentChunks[ChunkIndex])
+        {
+            ReleasePieceActor(PieceID);
+        }
+        It.RemoveCurrent();
     }
 
+    FlushChunkProxies();
+    BakeDirtyTiles();
 }
 
-void APuzzleGameMode::CreateGridVisualization()
+void APuzzleGameMode::MaterializeChunk(int32 ChunkIndex)
 {
+    ResidentChunks[ChunkIndex] = true;
 
-    ClearGridVisualization();
-
-    int32 TotalPieces = PuzzleWidth * PuzzleHeight;
+    int32 MinCol, MinRow, MaxCol, MaxRow;
+    GetChunkCellRange(ChunkIndex, MinCol, MinRow, MaxCol, MaxRow);
 
-    for (int32 i = 0; i < TotalPieces; i++)
+    for (int32 Row = MinRow; Row <= MaxRow; Row++)
     {
-        int32 Row = i / PuzzleWidth;
-        int32 Col = i % PuzzleWidth;
+        for (int32 Col = MinCol; Col <= MaxCol; Col++)
+        {
+            const int32 GridID = Row * PuzzleWidth + Col;
+            const int32 PieceID = GridOccupancy[GridID];
+            if (PieceID < 0 || FrozenPieces[PieceID])
+            {
+                continue;
+            }
 
-        FVector GridPosition = PuzzleStartLocation + FVector(
-            Col * PieceSpacing,
-            Row * PieceSpacing,
-            -10.0f 
-        );
+            PendingReleasePieces.Remove(PieceID);
+            if (!IsValid(PuzzlePieces[PieceID]))
+            {
+                AcquirePieceActor(PieceID, GetGridPositionFromID(GridID));
+            }
 
-        CreateGridMarker(GridPosition, i);
+            // Stream dışındayken oturmuş parçalar burada donar
+            if (bFreezeSettledPieces && IsFreezeEligible(GridID))
+            {
+                FreezePiece(PieceID);
+            }
+        }
+    }
 
-#if WITH_EDITOR
-#endif
+    if (bShowGridMarkers)
+    {
+        CreateChunkGridMarkers(ChunkIndex);
     }
 
+    UpdateChunkProxy(ChunkIndex);
 }
 
-// Gridleri görselleştirmek için oluşturulan fonksiyon 
-void APuzzleGameMode::CreateGridMarker(const FVector& Position, int32 GridIndex)
+void APuzzleGameMode::DematerializeChunk(int32 ChunkIndex)
 {
-    
-    AStaticMeshActor* GridMarker = GetWorld()->SpawnActor<AStaticMeshActor>();
+    ResidentChunks[ChunkIndex] = false;
 
-    if (GridMarker)
+    int32 MinCol, MinRow, MaxCol, MaxRow;
+    GetChunkCellRange(ChunkIndex, MinCol, MinRow, MaxCol, MaxRow);
+
+    for (int32 Row = MinRow; Row <= MaxRow; Row++)
     {
-        
-        UStaticMeshComponent* MeshComp = GridMarker->GetStaticMeshComponent();
+        for (int32 Col = MinCol; Col <= MaxCol; Col++)
+        {
+            const int32 PieceID = GridOccupancy[Row * PuzzleWidth + Col];
+            if (PieceID < 0 || !IsValid(PuzzlePieces[PieceID]))
+            {
+                continue;
+            }
 
-        if (MeshComp && GridMarkerMesh)
+            // Sürüklenen ya da animasyondaki parça bırakılınca havuza döner
+            if (PuzzlePieces[PieceID]->IsSelected() || PuzzlePieces[PieceID]->IsMoving())
+            {
+                PendingReleasePieces.Add(PieceID);
+                continue;
+            }
+
+            ReleasePieceActor(PieceID);
+        }
+    }
+
+    TArray<AStaticMeshActor*> Markers;
+    ChunkGridMarkers.MultiFind(ChunkIndex, Markers);
+    for (AStaticMeshActor* Marker : Markers)
+    {
+        GridMarkers.RemoveSwap(Marker);
+        if (IsValid(Marker))
         {
-            
-            MeshComp->SetStaticMesh(GridMarkerMesh);
+            Marker->Destroy();
+        }
+    }
+    ChunkGridMarkers.Remove(ChunkIndex);
 
-           
-            GridMarker->SetActorLocation(Position);
-            GridMarker->SetActorScale3D(FVector(GridMarkerScale, GridMarkerScale, 0.02f)); // Flat marker
+    UpdateChunkProxy(ChunkIndex);
+}
 
-            
-            UMaterialInterface* DefaultMaterial = MeshComp->GetMaterial(0);
-            if (DefaultMaterial)
+void APuzzleGameMode::CreateChunkGridMarkers(int32 ChunkIndex)
+{
+    int32 MinCol, MinRow, MaxCol, MaxRow;
+    GetChunkCellRange(ChunkIndex, MinCol, MinRow, MaxCol, MaxRow);
+
+    for (int32 Row = MinRow; Row <= MaxRow; Row++)
+    {
+        for (int32 Col = MinCol; Col <= MaxCol; Col++)
+        {
+            const int32 GridID = Row * PuzzleWidth + Col;
+            if (AStaticMeshActor* Marker = CreateGridMarker(GetGridPositionFromID(GridID) + FVector(0.0f, 0.0f, -10.0f), GridID))
             {
-                UMaterialInstanceDynamic* DynamicMat = UMaterialInstanceDynamic::Create(DefaultMaterial, this);
-                if (DynamicMat)
-                {
-                    
-                    DynamicMat->SetVectorParameterValue(TEXT("BaseColor"), GridMarkerColor);
-                    MeshComp->SetMaterial(0, DynamicMat);
-                }
+                ChunkGridMarkers.Add(ChunkIndex, Marker);
             }
+        }
+    }
+}
 
-           
-            MeshComp->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+void APuzzleGameMode::UpdateChunkProxy(int32 ChunkIndex)
+{
+    if (!IsValid(BoardProxy))
+    {
+        return;
+    }
 
-            MeshComp->SetCastShadow(false);
-            MeshComp->SetReceivesDecals(false);
+    int32 MinCol, MinRow, MaxCol, MaxRow;
+    GetChunkCellRange(ChunkIndex, MinCol, MinRow, MaxCol, MaxRow);
 
-            GridMarkers.Add(GridMarker);
+    const int32 NumCells = (MaxCol - MinCol + 1) * (MaxRow - MinRow + 1);
+    const FVector Center = PuzzleStartLocation + FVector(
+        (MinCol + MaxCol) * 0.5f * PieceSpacing,
+        (MinRow + MaxRow) * 0.5f * PieceSpacing,
+        0.0f
+    );
+    const FVector2D Size((MaxCol - MinCol + 1) * PieceSpacing, (MaxRow - MinRow + 1) * PieceSpacing);
+
+    // Yüklü chunk'ları gerçek parçalar, tile LOD açıksa diğerlerini tile'lar temsil eder
+    BoardProxy->UpdateChunk(ChunkIndex, !ResidentChunks[ChunkIndex] && !IsTileLODActive() && !IsIndirectionRendererActive(), Center, Size,
+        (float)ChunkOccupiedCounts[ChunkIndex] / NumCells,
+        (float)ChunkCorrectCounts[ChunkIndex] / NumCells);
+
+    if (DirtyProxyChunks[ChunkIndex])
+    {
+        DirtyProxyChunks[ChunkIndex] = false;
+        DirtyProxyList.RemoveSwap(ChunkIndex);
+    }
+}
 
+void APuzzleGameMode::FlushChunkProxies()
+{
+    // Occupancy değişen chunk'ların proxy verisini toplu güncelle
+    for (const int32 ChunkIndex : DirtyProxyList)
+    {
+        DirtyProxyChunks[ChunkIndex] = false;
+        if (!ResidentChunks[ChunkIndex])
+        {
+            UpdateChunkProxy(ChunkIndex);
         }
     }
+    DirtyProxyList.Reset();
+
+    if (IsValid(BoardProxy))
+    {
+        BoardProxy->FlushChunkUpdates();
+    }
 }
 
-void APuzzleGameMode::ClearGridVisualization()
+void APuzzleGameMode::GetBoardCellArea(FVector2D& OutMin, FVector2D& OutMax) const
 {
+    // Boundary padding'i çıkarıp hücre kenarına kadar genişlet
+    const FVector2D HalfExtent = DispatchGridTopology(GridTopology, [this](auto Policy)
+    {
+        return decltype(Policy)::GetCellHalfExtent(PieceSpacing);
+    });
+    const FVector2D CellAreaInset(BoundaryPadding - HalfExtent.X, BoundaryPadding - HalfExtent.Y);
+    OutMin = FVector2D(BoundaryMin.X + CellAreaInset.X, BoundaryMin.Y + CellAreaInset.Y);
+    OutMax = FVector2D(BoundaryMax.X - CellAreaInset.X, BoundaryMax.Y - CellAreaInset.Y);
+}
 
-    for (AStaticMeshActor* Marker : GridMarkers)
+bool APuzzleGameMode::IsTileLODActive() const
+{
+    return bEnableTileLOD && IsValid(BoardTiles) && BoardTiles->HasTileQuad();
+}
+
+void APuzzleGameMode::InitializeTileLOD()
+{
+    // Indirection renderer tüm board'u zaten tek quad'da çiziyor; tile atlas kare hücreli
+    // Atlas tile quad'ı ya da chunk proxy'leri için bake edilir, ikisi de yoksa kurulmaz
+    const bool bWantsTileQuad = bEnableTileLOD && TileLODMaterial;
+    if ((!bWantsTileQuad && !ChunkProxyMaterial) || IsIndirectionRendererActive() || GridTopology != EPuzzleGridTopology::Square)
     {
-        if (IsValid(Marker))
+        if (IsValid(BoardTiles))
         {
-            Marker->Destroy();
+            BoardTiles->ClearTiles();
         }
+        return;
     }
 
-    GridMarkers.Empty();
+    if (!IsValid(BoardTiles))
+    {
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        BoardTiles = GetWorld()->SpawnActor<APuzzleBoardTiles>(APuzzleBoardTiles::StaticClass(), FTransform::Identity, SpawnParams);
+        if (!BoardTiles)
+        {
+            return;
+        }
+    }
+
+    FVector2D CellAreaMin, CellAreaMax;
+    GetBoardCellArea(CellAreaMin, CellAreaMax);
+
+    if (!BoardTiles->InitializeTiles(PuzzleWidth, PuzzleHeight, CellAreaMin, CellAreaMax, bWantsTileQuad ? TileLODMaterial : nullptr, TileLODMaxTextureSize))
+    {
+        // Chunk proxy'leri uzak görünümü atlas'sız, doluluk rengiyle üstlenir
+        UE_LOG(LogPuzzleGame, Warning, TEXT("Tile LOD disabled: %dx%d board does not fit a %d px texture"),
+            PuzzleWidth, PuzzleHeight, TileLODMaxTextureSize);
+        return;
+    }
+
+    // Quad sadece uzaklaşınca görünür - yakında parça actor'leri çizilir
+    BoardTiles->SetTilesVisible(bTileLODZoomedOut);
+
+    // Board boş başlar, tile texture'ı zaten boş renkle temizlendi
+    DirtyTileRegions.Init(false, ChunksX * ChunksY);
 }
 
-void APuzzleGameMode::ToggleGridVisualization()
+void APuzzleGameMode::BakeDirtyTiles()
 {
-    bShowGridMarkers = !bShowGridMarkers;
+    if (!IsValid(BoardTiles) || DirtyTileList.Num() == 0 || !BoardTiles->BeginBake())
+    {
+        return;
+    }
 
-    if (bShowGridMarkers)
+    const int32 NumBakes = MaxTileBakesPerUpdate > 0 ? FMath::Min(DirtyTileList.Num(), MaxTileBakesPerUpdate) : DirtyTileList.Num();
+    for (int32 i = 0; i < NumBakes; i++)
     {
-        CreateGridVisualization();
+        const int32 ChunkIndex = DirtyTileList.Pop(EAllowShrinking::No);
+        DirtyTileRegions[ChunkIndex] = false;
+
+        int32 MinCol, MinRow, MaxCol, MaxRow;
+        GetChunkCellRange(ChunkIndex, MinCol, MinRow, MaxCol, MaxRow);
+        BoardTiles->BakeRegion(MinCol, MinRow, MaxCol, MaxRow, GridOccupancy, PieceMaterials, PieceMaterialMargin);
     }
-    else
+
+    BoardTiles->EndBake();
+}
+
+void APuzzleGameMode::NotifyPlayerActivity()
+{
+    LastActivityTime = FPlatformTime::Seconds();
+
+    if (bIsIdle)
     {
-        ClearGridVisualization();
+        ExitIdle();
     }
 }
 
+void APuzzleGameMode::CheckIdle()
+{
+    if (bIsIdle || !bEnableIdleThrottling)
+    {
+        return;
+    }
 
-// Boundry box alanı hesaplama
-void APuzzleGameMode::CalculateBoundary()
+    if (FPlatformTime::Seconds() - LastActivityTime >= IdleDelaySeconds)
+    {
+        EnterIdle();
+    }
+}
+
+void APuzzleGameMode::EnterIdle()
 {
-   
-    FVector MinCorner = PuzzleStartLocation;
-    FVector MaxCorner = PuzzleStartLocation + FVector(
-        (PuzzleWidth - 1) * PieceSpacing,
-        (PuzzleHeight - 1) * PieceSpacing,
-        0.0f
-    );
+    const double Now = FPlatformTime::Seconds();
+    AccumulatedActiveSeconds += Now - IdleStateChangeTime;
+    IdleStateChangeTime = Now;
+    bIsIdle = true;
+    IdleEnterCount++;
+
+    // Frame rate'i düşür - tick'ler de aynı oranda seyrekleşir
+    if (GEngine)
+    {
+        SavedMaxFPS = GEngine->GetMaxFPS();
+        GEngine->SetMaxFPS(IdleMaxFPS);
+    }
 
-    BoundaryMin = MinCorner - FVector(BoundaryPadding, BoundaryPadding, 0.0f);
-    BoundaryMax = MaxCorner + FVector(BoundaryPadding, BoundaryPadding, 0.0f);
+    // Ekranda değişiklik yokken yan işler bekler
+    GetWorldTimerManager().PauseTimer(StreamingTimerHandle);
+    GetWorldTimerManager().PauseTimer(HeatmapTimerHandle);
+    GetWorldTimerManager().PauseTimer(FreezeTimerHandle);
 
-    DrawBoundaryDebug();
+    UE_LOG(LogPuzzleGame, Log, TEXT("Entering idle mode (%.0f fps cap)"), IdleMaxFPS);
+    OnIdleStateChanged.Broadcast(true);
 }
 
-bool APuzzleGameMode::IsLocationWithinBoundary(const FVector& Location)
+void APuzzleGameMode::ExitIdle()
 {
-    return (Location.X >= BoundaryMin.X && Location.X <= BoundaryMax.X &&
-        Location.Y >= BoundaryMin.Y && Location.Y <= BoundaryMax.Y);
+    const double Now = FPlatformTime::Seconds();
+    AccumulatedIdleSeconds += Now - IdleStateChangeTime;
+    IdleStateChangeTime = Now;
+    bIsIdle = false;
+
+    if (GEngine)
+    {
+        GEngine->SetMaxFPS(SavedMaxFPS);
+    }
+
+    GetWorldTimerManager().UnPauseTimer(StreamingTimerHandle);
+    GetWorldTimerManager().UnPauseTimer(HeatmapTimerHandle);
+    GetWorldTimerManager().UnPauseTimer(FreezeTimerHandle);
+
+    OnIdleStateChanged.Broadcast(false);
 }
 
-FVector APuzzleGameMode::ClampLocationToBoundary(const FVector& Location)
+float APuzzleGameMode::GetIdleTimeSeconds() const
 {
-    FVector ClampedLocation = Location;
+    const double Current = bIsIdle ? FPlatformTime::Seconds() - IdleStateChangeTime : 0.0;
+    return (float)(AccumulatedIdleSeconds + Current);
+}
 
-    ClampedLocation.X = FMath::Clamp(ClampedLocation.X, BoundaryMin.X, BoundaryMax.X);
+float APuzzleGameMode::GetActiveTimeSeconds() const
+{
+    const double Current = bIsIdle ? 0.0 : FPlatformTime::Seconds() - IdleStateChangeTime;
+    return (float)(AccumulatedActiveSeconds + Current);
+}
 
-    ClampedLocation.Y = FMath::Clamp(ClampedLocation.Y, BoundaryMin.Y, BoundaryMax.Y);
+void APuzzleGameMode::RetireActor(AActor* Actor)
+{
+    if (!IsValid(Actor))
+    {
+        return;
+    }
 
-    // Z değeri değişmeyecek
-    ClampedLocation.Z = 0.0f;
+    Actor->SetActorHiddenInGame(true);
+    Actor->SetActorEnableCollision(false);
+    Actor->SetActorTickEnabled(false);
+    RetiredActors.Add(Actor);
 
-    return ClampedLocation;
+    if (!WorkScheduler.IsQueued(TEXT("RetireActors")))
+    {
+        WorkScheduler.Enqueue(TEXT("RetireActors"), EPuzzleWorkPriority::Low, [this]() { return DestroyRetiredActors(); });
+    }
 }
 
-void APuzzleGameMode::EnforceAllPieceBoundaries()
+bool APuzzleGameMode::DestroyRetiredActors()
 {
-    int32 ConstrainedPieces = 0;
+    const int32 NumToDestroy = FMath::Min(RetiredActors.Num(), FMath::Max(ActorDestroysPerStep, 1));
+    for (int32 i = 0; i < NumToDestroy; i++)
+    {
+        AActor* Actor = RetiredActors.Pop(EAllowShrinking::No);
+        if (IsValid(Actor))
+        {
+            Actor->Destroy();
+        }
+    }
+    return RetiredActors.Num() == 0;
+}
 
-    for (APuzzlePiece* Piece : PuzzlePieces)
+bool APuzzleGameMode::IsGridCellFrozen(int32 GridID) const
+{
+    const int32 PieceID = GridOccupancy.IsValidIndex(GridID) ? GridOccupancy[GridID] : -1;
+    return FrozenPieces.IsValidIndex(PieceID) && FrozenPieces[PieceID];
+}
+
+bool APuzzleGameMode::IsFreezeEligible(int32 GridID) const
+{
+    // Sliding modunda her taş tıklanabilir kalmalı - donmuş parçanın actor'ü yoktur
+    // Edge-matching modunda planlanan çözüm dışındaki düzenler de geçerli, dondurma oyuncuyu ona kilitler
+    if (bSlidingTileMode || EdgeSet.IsValid())
     {
-        if (IsValid(Piece))
+        return false;
+    }
+
+    // Parça doğru ve board içindeki tüm komşuları da doğru - kümesi bu parça etrafında tamam
+    if (GridOccupancy[GridID] != GridID)
+    {
+        return false;
+    }
+
+    return DispatchGridTopology(GridTopology, [this, GridID](auto Policy)
+    {
+        bool bNeighboursCorrect = true;
+        ForEachGridNeighbour<decltype(Policy)>(GridID, PuzzleWidth, PuzzleHeight, [this, &bNeighboursCorrect](int32 Direction, int32 Neighbour)
         {
-            FVector CurrentLocation = Piece->GetActorLocation();
+            bNeighboursCorrect &= GridOccupancy[Neighbour] == Neighbour;
+        });
+        return bNeighboursCorrect;
+    });
+}
 
-            if (!IsLocationWithinBoundary(CurrentLocation))
+void APuzzleGameMode::EvaluateFreeze(TArrayView<const int32> ChangedGridIDs)
+{
+    if (!bFreezeSettledPieces)
+    {
+        return;
+    }
+
+    // Değişen hücre ve komşularının uygunluğu değişmiş olabilir
+    TArray<int32, TInlineAllocator<1 + FPuzzleHexTopology::NumDirections>> Candidates;
+    for (const int32 GridID : ChangedGridIDs)
+    {
+        Candidates.Reset();
+        Candidates.Add(GridID);
+        DispatchGridTopology(GridTopology, [this, GridID, &Candidates](auto Policy)
+        {
+            ForEachGridNeighbour<decltype(Policy)>(GridID, PuzzleWidth, PuzzleHeight, [&Candidates](int32 Direction, int32 Neighbour)
             {
-                FVector ConstrainedLocation = ClampLocationToBoundary(CurrentLocation);
-                Piece->MovePieceToLocation(ConstrainedLocation, true);
+                Candidates.Add(Neighbour);
+            });
+        });
 
-                ConstrainedPieces++;
+        for (const int32 Candidate : Candidates)
+        {
+            if (FrozenPieces[Candidate] || !IsFreezeEligible(Candidate))
+            {
+                continue;
+            }
 
+            // Uygun hücrede doğru parça var, PieceID == GridID
+            APuzzlePiece* Piece = PuzzlePieces[Candidate];
+            if (!IsValid(Piece))
+            {
+                // Stream dışında - chunk yüklendiğinde donar
+                continue;
+            }
 
+            if (Piece->IsSelected() || Piece->IsMoving())
+            {
+                PendingFreezePieces.Add(Candidate);
+                continue;
             }
+
+            FreezePiece(Candidate);
         }
     }
 
-    if (ConstrainedPieces > 0)
+    if (PendingFreezePieces.Num() > 0 && !GetWorldTimerManager().IsTimerActive(FreezeTimerHandle))
     {
+        GetWorldTimerManager().SetTimer(FreezeTimerHandle, this, &APuzzleGameMode::ProcessPendingFreezes, 0.25f, true);
     }
 }
 
-void APuzzleGameMode::DrawBoundaryDebug()
+void APuzzleGameMode::ProcessPendingFreezes()
 {
-#if WITH_EDITOR
-    FVector BoxCenter = (BoundaryMin + BoundaryMax) * 0.5f;
-    FVector BoxExtent = (BoundaryMax - BoundaryMin) * 0.5f;
-
-#endif
-}
-
+    for (auto It = PendingFreezePieces.CreateIterator(); It; ++It)
+    {
+        const int32 PieceID = *It;
+        APuzzlePiece* Piece = PuzzlePieces.IsValidIndex(PieceID) ? PuzzlePieces[PieceID] : nullptr;
 
+        if (!IsValid(Piece) || FrozenPieces[PieceID] || PieceGridIDs[PieceID] != PieceID || !IsFreezeEligible(PieceID))
+        {
+            It.RemoveCurrent();
+        }
+        else if (!Piece->IsSelected() && !Piece->IsMoving())
+        {
+            FreezePiece(PieceID);
+            It.RemoveCurrent();
+        }
+    }
 
-void APuzzleGameMode::RefreshGridVisualization()
-{
-    ClearGridVisualization();
-    if (bShowGridMarkers)
+    if (PendingFreezePieces.Num() == 0)
     {
-        CreateGridVisualization();
+        GetWorldTimerManager().ClearTimer(FreezeTimerHandle);
     }
 }
 
-void APuzzleGameMode::SetBoundaryPadding(float NewPadding)
+void APuzzleGameMode::FreezePiece(int32 PieceID)
 {
-    BoundaryPadding = NewPadding;
-    CalculateBoundary();
-    EnforceAllPieceBoundaries();
-    
-}
+    APuzzlePiece* Piece = PuzzlePieces[PieceID];
+    if (!IsValid(Piece))
+    {
+        return;
+    }
 
-void APuzzleGameMode::PrintAllPiecePositions()
-{
-    
-    int32 TotalPieces = 0;
-    int32 SpawnedPieces = 0;
-    int32 CorrectPieces = 0;
-    
-    for (int32 i = 0; i < PuzzlePieces.Num(); i++)
+    if (!IsValid(FrozenBatch))
     {
-        TotalPieces++;
-        APuzzlePiece* Piece = PuzzlePieces[i];
-        
-        if (Piece)
-        {
-            SpawnedPieces++;
-            FVector Location = Piece->GetActorLocation();
-            FVector CorrectPos = Piece->GetCorrectPosition();
-            bool bIsCorrect = Piece->IsInCorrectPosition();
-            
-            if (bIsCorrect)
-            {
-                CorrectPieces++;
-            }
-            
-            int32 CurrentGridID = GetGridIDFromPosition(Location);
-            
-        }
-        else
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        FrozenBatch = GetWorld()->SpawnActor<APuzzleFrozenBatch>(APuzzleFrozenBatch::StaticClass(), FTransform::Identity, SpawnParams);
+        if (!FrozenBatch)
         {
+            return;
         }
+        FrozenBatch->SetAtlasMaterial(CreateFrozenBatchMaterial());
     }
-    
-        bool bShouldBeComplete = SpawnedPieces == TotalPieces && CorrectPieces == TotalPieces;
-    
-    if (bShouldBeComplete && CurrentGameState != EPuzzleGameState::Completed)
+
+    // Indirection renderer board'u zaten çiziyor, sadece actor bırakılır
+    // Batch'e eklenemeyen parça (atlas materyali yok) actor olarak kalır, yoksa görünmez olurdu
+    if (!IsIndirectionRendererActive() && !FrozenBatch->AddPiece(PieceID, Piece, PieceID % PuzzleWidth, PieceID / PuzzleWidth))
     {
-        if (CheckGameCompletion())
-        {
-            OnGameComplete();
-        }
+        return;
     }
+
+    FrozenPieces[PieceID] = true;
+    FrozenPieceCount++;
+    PendingReleasePieces.Remove(PieceID);
+    ReleasePieceActor(PieceID);
 }
 
-FVector APuzzleGameMode::GetNearestGridPosition(const FVector& WorldPosition)
+UMaterialInterface* APuzzleGameMode::CreateFrozenBatchMaterial()
 {
-    FVector NearestPosition = WorldPosition;
-    float MinDistance = FLT_MAX;
-    
-    for (int32 Row = 0; Row < PuzzleHeight; Row++)
+    if (!FrozenBatchMaterial || !BoardSourceImage)
     {
-        for (int32 Col = 0; Col < PuzzleWidth; Col++)
-        {
-            FVector GridPosition = PuzzleStartLocation + FVector(
-                Col * PieceSpacing,
-                Row * PieceSpacing,
-                0.0f
-            );
-            
-            float Distance = FVector::Dist2D(WorldPosition, GridPosition);
-            if (Distance < MinDistance)
-            {
-                MinDistance = Distance;
-                NearestPosition = GridPosition;
-            }
-        }
+        return nullptr;
     }
-    
-    NearestPosition.Z = 0.0f;
-    
-    
-    return NearestPosition;
+
+    // Parça mesh'inin UV0'ı TileMargin paylı hücreyi kaplar - materyal aynı payla resimden keser
+    UMaterialInstanceDynamic* Material = UMaterialInstanceDynamic::Create(FrozenBatchMaterial, this);
+    Material->SetTextureParameterValue(TEXT("SourceImage"), BoardSourceImage);
+    Material->SetVectorParameterValue(TEXT("BoardSize"), FLinearColor(PuzzleWidth, PuzzleHeight, 0.0f, 0.0f));
+    Material->SetScalarParameterValue(TEXT("TileMargin"), PieceMaterialMargin);
+    return Material;
 }
 
-APuzzlePiece* APuzzleGameMode::GetPieceAtGridPosition(const FVector& GridPosition)
+APuzzlePiece* APuzzleGameMode::UnfreezePiece(int32 PieceID)
 {
-    for (APuzzlePiece* Piece : PuzzlePieces)
+    FrozenPieces[PieceID] = false;
+    FrozenPieceCount--;
+    PendingFreezePieces.Remove(PieceID);
+
+    if (IsValid(FrozenBatch))
     {
-        if (Piece)
-        {
-            FVector PieceLocation = Piece->GetActorLocation();
-            if (FVector::Dist2D(PieceLocation, GridPosition) < 10.0f)
-            {
-                return Piece;
-            }
-        }
+        FrozenBatch->RemovePiece(PieceID);
     }
-    
-    return nullptr;
-}
 
-void APuzzleGameMode::RemovePieceFromAvailable(int32 PieceID)
-{
-    int32 RemovedCount = AvailablePieceIDs.Remove(PieceID);
-    
-    if (AvailablePieceIDs.Num() <= 3)
+    const int32 GridID = PieceGridIDs[PieceID];
+    if (GridID < 0)
     {
-        FString RemainingPieces = TEXT("Remaining available pieces: ");
-        for (int32 ID : AvailablePieceIDs)
-        {
-            RemainingPieces += FString::Printf(TEXT("%d "), ID);
-        }
+        return nullptr;
+    }
+
+    // Stream dışındaki hücrede actor gerekmez
+    const int32 ChunkIndex = GetChunkIndexForGridID(GridID);
+    if (IsChunkStreamingActive() && (ChunkIndex < 0 || !ResidentChunks[ChunkIndex]))
+    {
+        return nullptr;
     }
+
+    return AcquirePieceActor(PieceID, GetGridPositionFromID(GridID));
 }
 
-int32 APuzzleGameMode::GetGridIDFromPosition(const FVector& WorldPosition)
+APuzzlePiece* APuzzleGameMode::LiftFrozenPieceAt(const FVector& WorldLocation)
 {
-    FVector NearestGridPos = GetNearestGridPosition(WorldPosition);
-    
-    FVector RelativePos = NearestGridPos - PuzzleStartLocation;
-    
-    int32 Col = FMath::RoundToInt(RelativePos.X / PieceSpacing);
-    int32 Row = FMath::RoundToInt(RelativePos.Y / PieceSpacing);
-    
-    if (Col < 0 || Col >= PuzzleWidth || Row < 0 || Row >= PuzzleHeight)
+    const int32 GridID = GetGridIDFromPosition(WorldLocation);
+    if (GridID < 0 || !IsGridCellFrozen(GridID))
     {
-        return -1; 
+        return nullptr;
     }
-    
-    int32 GridID = Row * PuzzleWidth + Col;
-    
-    
-    return GridID;
+
+    // En yakın hücre clamp'lenir - tıklama gerçekten hücrenin içinde olmalı
+    if (GetCellAtPosition(WorldLocation) != FIntPoint(GridID % PuzzleWidth, GridID / PuzzleWidth))
+    {
+        return nullptr;
+    }
+
+    return UnfreezePiece(GridOccupancy[GridID]);
 }
 
-FVector APuzzleGameMode::GetGridPositionFromID(int32 GridID)
+void APuzzleGameMode::LiftFrozenCells(const TArray<int32>& GridIDs)
 {
-    if (GridID < 0 || GridID >= PuzzleWidth * PuzzleHeight)
+    for (const int32 GridID : GridIDs)
     {
-        return FVector::ZeroVector;
+        if (IsGridCellFrozen(GridID))
+        {
+            UnfreezePiece(GridOccupancy[GridID]);
+        }
     }
-    
-    int32 Row = GridID / PuzzleWidth;
-    int32 Col = GridID % PuzzleWidth;
-    
-    FVector GridPosition = PuzzleStartLocation + FVector(
-        Col * PieceSpacing,
-        Row * PieceSpacing,
-        0.0f
-    );
-    
-    return GridPosition;
 }
 
-APuzzlePiece* APuzzleGameMode::GetPieceAtGridID(int32 GridID)
+void APuzzleGameMode::SettleLiftedCells(const TArray<int32>& GridIDs)
 {
-    if (GridID < 0 || GridID >= PuzzleWidth * PuzzleHeight)
+    // Board değişmediği için NotifyCellsChanged çalışmaz - seçili parçalar zamanlayıcıyla donar
+    EvaluateFreeze(GridIDs);
+}
+
+void APuzzleGameMode::HideCellsOnBoard(const TArray<int32>& GridIDs)
+{
+    if (!IsIndirectionRendererActive())
     {
-        return nullptr;
+        return;
     }
-    
-    if (GridOccupancy.IsValidIndex(GridID))
+
+    for (const int32 GridID : GridIDs)
     {
-        int32 PieceID = GridOccupancy[GridID];
-        if (PieceID >= 0 && PuzzlePieces.IsValidIndex(PieceID))
+        if (GridOccupancy.IsValidIndex(GridID))
         {
-            return PuzzlePieces[PieceID];
+            IndirectionBoard->SetCell(GridID, -1);
         }
     }
-    
-    return nullptr;
+    IndirectionBoard->FlushCells();
 }
 
-void APuzzleGameMode::UpdateGridOccupancy(int32 GridID, APuzzlePiece* Piece)
+void APuzzleGameMode::RestoreCellsOnBoard(const TArray<int32>& GridIDs)
 {
-    if (GridID < 0 || GridID >= PuzzleWidth * PuzzleHeight || !GridOccupancy.IsValidIndex(GridID))
+    if (!IsIndirectionRendererActive())
     {
         return;
     }
-    
-    if (Piece)
+
+    for (const int32 GridID : GridIDs)
     {
-        int32 PieceID = Piece->GetPieceID();
-        
-        for (int32 i = 0; i < GridOccupancy.Num(); i++)
+        if (GridOccupancy.IsValidIndex(GridID))
         {
-            if (GridOccupancy[i] == PieceID && i != GridID)
-            {
-                GridOccupancy[i] = -1;
-            }
+            IndirectionBoard->SetCell(GridID, GridOccupancy[GridID]);
         }
-        
-        GridOccupancy[GridID] = PieceID;
-    }
-    else
-    {
-        GridOccupancy[GridID] = -1;
     }
+    IndirectionBoard->FlushCells();
 }
 
-void APuzzleGameMode::SwapPiecesAtGridIDs(int32 GridID1, int32 GridID2)
+bool APuzzleGameMode::IsIndirectionRendererActive() const
 {
-    if (!GridOccupancy.IsValidIndex(GridID1) || !GridOccupancy.IsValidIndex(GridID2))
+    return bUseIndirectionRenderer && IsValid(IndirectionBoard) && IndirectionBoard->IsInitialized();
+}
+
+void APuzzleGameMode::InitializeIndirectionRenderer()
+{
+    // Indirection texture'ı hücre başına bir kare texel - sadece kare grid
+    if (!bUseIndirectionRenderer || !IndirectionBoardMaterial || GridTopology != EPuzzleGridTopology::Square)
     {
+        if (IsValid(IndirectionBoard))
+        {
+            IndirectionBoard->ClearBoard();
+        }
         return;
     }
-    
-    APuzzlePiece* Piece1 = GetPieceAtGridID(GridID1);
-    APuzzlePiece* Piece2 = GetPieceAtGridID(GridID2);
-    
-    FVector GridPos1 = GetGridPositionFromID(GridID1);
-    FVector GridPos2 = GetGridPositionFromID(GridID2);
-    
-    if (Piece1 && Piece2)
-    {
-        
-        Piece1->MovePieceToLocation(GridPos2, false);
-        Piece2->MovePieceToLocation(GridPos1, false);
-        
-        GridOccupancy[GridID1] = Piece2->GetPieceID();
-        GridOccupancy[GridID2] = Piece1->GetPieceID();
-    }
-    else if (Piece1 && !Piece2)
+
+    if (!IsValid(IndirectionBoard))
     {
-        
-        Piece1->MovePieceToLocation(GridPos2, false);
-        
-        GridOccupancy[GridID1] = -1;
-        GridOccupancy[GridID2] = Piece1->GetPieceID();
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        IndirectionBoard = GetWorld()->SpawnActor<APuzzleIndirectionBoard>(APuzzleIndirectionBoard::StaticClass(), FTransform::Identity, SpawnParams);
+        if (!IndirectionBoard)
+        {
+            return;
+        }
     }
-    else if (!Piece1 && Piece2)
+
+    FVector2D CellAreaMin, CellAreaMax;
+    GetBoardCellArea(CellAreaMin, CellAreaMax);
+
+    if (!IndirectionBoard->InitializeBoard(PuzzleWidth, PuzzleHeight, CellAreaMin, CellAreaMax, IndirectionBoardMaterial, BoardSourceImage))
     {
-        
-        Piece2->MovePieceToLocation(GridPos1, false);
-        
-        GridOccupancy[GridID2] = -1;
-        GridOccupancy[GridID1] = Piece2->GetPieceID();
+        UE_LOG(LogPuzzleGame, Warning, TEXT("Indirection renderer unavailable for %dx%d board"), PuzzleWidth, PuzzleHeight);
     }
 }
 
-void APuzzleGameMode::ForceCheckGameCompletion()
+APuzzlePiece* APuzzleGameMode::AcquirePieceActor(int32 PieceID, const FVector& Location)
 {
-    
-    PrintAllPiecePositions();
-    
-    if (CheckGameCompletion())
+    APuzzlePiece* Piece = nullptr;
+    while (!Piece && PiecePool.Num() > 0)
     {
-        OnGameComplete();
+        Piece = PiecePool.Pop(EAllowShrinking::No);
+        if (!IsValid(Piece))
+        {
+            Piece = nullptr;
+        }
+    }
+
+    if (Piece)
+    {
+        Piece->SetActorLocation(Location);
+        Piece->SetActorHiddenInGame(false);
+        Piece->SetActorEnableCollision(true);
+        Piece->SetActorTickEnabled(true);
     }
     else
     {
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+        Piece = GetWorld()->SpawnActor<APuzzlePiece>(PuzzlePieceClass, Location, FRotator::ZeroRotator, SpawnParams);
+        if (!Piece)
+        {
+            return nullptr;
+        }
     }
+
+    ConfigurePieceActor(Piece, PieceID);
+    Piece->SetBoardRendered(IsIndirectionRendererActive());
+    PuzzlePieces[PieceID] = Piece;
+    Piece->CheckIfInCorrectPosition();
+
+    return Piece;
 }
 
-void APuzzleGameMode::DebugPuzzleState()
+void APuzzleGameMode::ReleasePieceActor(int32 PieceID)
 {
-    
-    PrintAllPiecePositions();
-    
-    for (int32 i = 0; i < GridOccupancy.Num(); i++)
+    APuzzlePiece* Piece = PuzzlePieces[PieceID];
+    PuzzlePieces[PieceID] = nullptr;
+
+    if (!IsValid(Piece))
     {
-        int32 PieceID = GridOccupancy[i];
-        FVector GridPos = GetGridPositionFromID(i);
-        if (PieceID >= 0)
-        {
-        }
-        else
-        {
-        }
+        return;
     }
+
+    // Destroy yerine gizle - bir sonraki materialize spawn maliyeti ödemez
+    // Seçim bırakılır: havuzdan başka PieceID ile dönen actor seçili gelmesin, controller seçimi budar
+    Piece->SetSelected(false);
+    Piece->SetActorHiddenInGame(true);
+    Piece->SetActorEnableCollision(false);
+    Piece->SetActorTickEnabled(false);
+    PiecePool.Add(Piece);
+}
+
+void APuzzleGameMode::ConfigurePieceActor(APuzzlePiece* Piece, int32 PieceID)
+{
+    Piece->SetPieceID(PieceID);
     
-    
-    
-    for (int32 i = 0; i < PuzzlePieces.Num(); i++)
+    // Bu parça için doğru pozisyon hesabı
+    Piece->SetCorrectPosition(GetGridPositionFromID(PieceID));
+    Piece->SetPlacementEventsEnabled(bFirePerPieceEvents);
+    ApplyPieceShape(Piece, PieceID);
+
+    // Parça doğru hücresinin yönünü taşır - aşağı bakan üçgenler çevrilir, havuzdan gelen actor'de eski yön kalmasın
+    const float Yaw = DispatchGridTopology(GridTopology, [this, PieceID](auto Policy)
     {
-        if (PuzzlePieces[i] && !PuzzlePieces[i]->IsInCorrectPosition())
-        {
-            FVector CurrentPos = PuzzlePieces[i]->GetActorLocation();
-            FVector CorrectPos = PuzzlePieces[i]->GetCorrectPosition();
-            float Distance = FVector::Dist2D(CurrentPos, CorrectPos);
-            
-        }
-    }
+        return decltype(Policy)::GetCellYaw(PieceID % PuzzleWidth, PieceID / PuzzleWidth);
+    });
+    Piece->SetActorRotation(FRotator(0.0f, Yaw, 0.0f));
     
-    for (int32 i = 0; i < GridOccupancy.Num(); i++)
+    // Set material et
+    if (PieceMaterials.IsValidIndex(PieceID))
     {
-        if (GridOccupancy[i] < 0)
-        {
-            FVector GridPos = GetGridPositionFromID(i);
-        }
+        Piece->SetPieceMaterial(PieceMaterials[PieceID]);
     }
-    
-    if (PuzzlePieces.IsValidIndex(8) && PuzzlePieces[8])
+
+    if (EdgeSet.IsValid() && PieceID < EdgeSet->GetNumPieces())
     {
-        FVector Piece8Pos = PuzzlePieces[8]->GetActorLocation();
-        int32 Piece8GridID = GetGridIDFromPosition(Piece8Pos);
-        
-        bool bFoundInOccupancy = false;
-        for (int32 i = 0; i < GridOccupancy.Num(); i++)
-        {
-            if (GridOccupancy[i] == 8)
-            {
-                bFoundInOccupancy = true;
-                break;
-            }
-        }
-        if (!bFoundInOccupancy)
+        const uint32 Edges = EdgeSet->GetPieceEdges(PieceID);
+        auto GetEdgeColour = [this, Edges](int32 Side)
         {
-        }
+            // Renk indeksleri altın açıyla ton çemberine dağıtılır - komşu indeksler ayırt edilir
+            const uint8 Colour = FPuzzleEdgeSet::GetColour(Edges, Side);
+            return Colour == FPuzzleEdgeSet::FrameColour
+                ? EdgeFrameColour
+                : FLinearColor::MakeFromHSV8((uint8)((Colour * 97) & 0xFF), 200, 230);
+        };
+        Piece->SetEdgeColours(GetEdgeColour(FPuzzleEdgeSet::North), GetEdgeColour(FPuzzleEdgeSet::East),
+            GetEdgeColour(FPuzzleEdgeSet::South), GetEdgeColour(FPuzzleEdgeSet::West));
     }
-    else
-    {
-    }
-}
\ No newline at end of file
+}
@@ -5,9 +5,32 @@
 #include "CoreMinimal.h"
 #include "GameFramework/GameModeBase.h"
 #include "PuzzlePiece.h"
+#include "PuzzleReplay.h"
+#include "PuzzleGridTopology.h"
+#include "PuzzleBoardTransaction.h"
+#include "PuzzleClusterSet.h"
+#include "PuzzleSwapDistance.h"
+#include "PuzzleZobristHash.h"
+#include "PuzzleShuffleGenerator.h"
+#include "PuzzleBoardProxy.h"
+#include "PuzzleBoardTiles.h"
+#include "PuzzleIndirectionBoard.h"
+#include "PuzzleHeatmapOverlay.h"
+#include "PuzzleFrozenBatch.h"
+#include "PuzzleWorkScheduler.h"
+#include "PuzzleChangeJournal.h"
+#include "PuzzleBoardSnapshot.h"
+#include "PuzzleHintEngine.h"
+#include "PuzzleSlidingSolver.h"
+#include "PuzzleEdgeSolver.h"
+#include "PuzzleEdgeCompatibility.h"
+#include "PuzzleFreePlacement.h"
+#include "PuzzlePieceShape.h"
+#include "Tasks/Task.h"
 #include "Engine/TimerHandle.h"
 #include "Components/StaticMeshComponent.h"
 #include "Materials/MaterialInstanceDynamic.h"
+#include "Engine/Texture2D.h"
 #include "Engine/StaticMeshActor.h"
 #include "DrawDebugHelpers.h"
 #include "PuzzleGameMode.generated.h"
@@ -25,6 +48,12 @@ enum class EPuzzleGameState : uint8
 // Game completion event için delegate
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnGameCompleted, float, TotalTime, int32, TotalMoves);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnStatsUpdated, float, CurrentTime, int32, CurrentMoves);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnIdleStateChanged, bool, bIsIdle);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnBoardChanged, const FPuzzleBoardDelta&, Delta);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnHintReady, const FPuzzleHint&, Hint);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnImageImported, bool, bSuccess);
+
+struct FPuzzleImageMipChain;
 
 UCLASS()
 class PUZZLEGAME_API APuzzleGameMode : public AGameModeBase
@@ -38,6 +67,7 @@ public:
 protected:
     virtual void BeginPlay() override;
     virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+    virtual void Tick(float DeltaSeconds) override;
 
     // Oyun istatistikleri
     UPROPERTY(BlueprintReadOnly, Category = "Game Stats")
@@ -59,9 +89,91 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Puzzle Config")
     float PieceSpacing;
 
+    // Hücre düzeni - PieceSpacing komşu hücre merkezleri arası mesafe (üçgenlerde kenar uzunluğu)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Puzzle Config")
+    EPuzzleGridTopology GridTopology;
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Puzzle Config")
     FVector PuzzleStartLocation;
 
+    // Seed'li, zorluk hedefli karıştırma - tray sırası veya ön yerleşim bundan üretilir
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Puzzle Config")
+    FPuzzleShuffleSettings ShuffleSettings;
+
+    // true: karışık düzen doğrudan board'a yerleşir (takas modu), tray boş kalır
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Puzzle Config")
+    bool bPrePlaceShuffledBoard;
+
+    // Son InitializePuzzle'da kullanılan seed - aynı board'u yeniden üretmek için
+    UPROPERTY(BlueprintReadOnly, Category = "Puzzle Config")
+    int32 CurrentShuffleSeed;
+
+    // Sliding-tile modu - son parça boşluk olur, sadece boşluğa komşu taş kayar
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sliding")
+    bool bSlidingTileMode;
+
+    // Otomatik çözümde hamleler arası süre (saniye)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sliding")
+    float SlidingAutoSolveInterval;
+
+    // İpucu aramasının düğüm bütçesi (0: sınırsız) - aşılırsa ipucu geçersiz döner
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sliding")
+    int64 SlidingHintMaxNodes;
+
+    // Edge-matching modu - parçalar kenar renkleriyle eşleşir, tüm kenarlar eşleşince çözülmüş sayılır
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Edge Matching")
+    bool bEdgeMatchingMode;
+
+    // İç kenar renk sayısı - az renk daha çok alternatif çözüm, çok renk daha kolay arama
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Edge Matching", meta = (ClampMin = "1", ClampMax = "254"))
+    int32 EdgeMatchingColours;
+
+    // İpucu aramasının düğüm bütçesi (0: sınırsız)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Edge Matching")
+    int64 EdgeMatchingHintMaxNodes;
+
+    // Çerçeve kenarlarının rengi
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Edge Matching")
+    FLinearColor EdgeFrameColour;
+
+    // Serbest yerleştirme - parçalar masada her yerde durur, sadece gerçek komşularına yapışır
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Free Placement")
+    bool bFreePlacementMode;
+
+    // Bırakılan parçanın komşusuna göre beklenen yerinden en fazla bu kadar sapması yapışmaya yeter
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Free Placement", meta = (ClampMin = "0.0"))
+    float FreeSnapDistance;
+
+    // Prosedürel tab/blank parça şekilleri - kapalıyken Blueprint'teki mesh kullanılır
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Piece Shape")
+    bool bProceduralPieceShapes;
+
+    // Kenar başına çıkıntı varyantı - az varyant daha çok parçanın aynı mesh'i paylaşması demek
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Piece Shape", meta = (ClampMin = "1", ClampMax = "8"))
+    int32 PieceShapeVariants;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Piece Shape", meta = (ClampMin = "0.1"))
+    float PieceShapeThickness;
+
+    // Kübik eğri başına segment - çıkıntı başına üç eğri
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Piece Shape", meta = (ClampMin = "1", ClampMax = "32"))
+    int32 PieceShapeCurveSegments;
+
+    // İçe aktarılan resmin parça materyali - PieceTexture texture parametresi parça dilimini alır
+    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Import")
+    UMaterialInterface* ImportedPieceMaterial;
+
+    // Parça texture'ı kenarı (2'nin kuvveti) - hücre daha küçükse hücre boyutuna iner
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Import", meta = (ClampMin = "1", ClampMax = "4096"))
+    int32 ImportMaxTileSize;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Import", meta = (ClampMin = "1", ClampMax = "512"))
+    int32 ImportThumbnailSize;
+
+    // Çözme ve dilimleme sırasında tutulan CPU belleği üst sınırı - aşılacaksa resim küçültülür
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Import", meta = (ClampMin = "16"))
+    int32 ImportMemoryBudgetMB;
+
     // Puzzle parçaları
     UPROPERTY(BlueprintReadOnly, Category = "Puzzle")
     TArray<APuzzlePiece*> PuzzlePieces;
@@ -110,6 +222,194 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Boundary")
     float BoundaryPadding;
 
+    // Replay kaydı - leaderboard doğrulaması için
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Replay")
+    bool bRecordReplay;
+
+    // Ön yerleşimli board bu kadar hücreyi aşarsa kayıt kapanır - her parça bir Spawn kaydı olur
+    // FPuzzleReplayValidator::MaxCells'e kısılır, daha büyük kayıtlar zaten reddedilir
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Replay", meta = (ClampMin = "0"))
+    int32 ReplayMaxPreplacedCells;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    FPuzzleReplayRecord CurrentReplay;
+
+    // Chunk streaming - büyük board'larda sadece kameraya yakın chunk'lar actor olarak var
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming")
+    bool bEnableChunkStreaming;
+
+    // Bu hücre sayısının altında tüm parçalar her zaman actor olarak kalır
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming")
+    int32 StreamingMinCells;
+
+    // Chunk kenar uzunluğu (hücre)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming")
+    int32 ChunkSize;
+
+    // Görünür alanın etrafında ayrıca yüklenen chunk halkası
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming")
+    int32 StreamingMarginChunks;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming")
+    float StreamingUpdateInterval;
+
+    // Ufka bakan kamera ışınları için üst sınır
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming")
+    float MaxStreamingViewDistance;
+
+    // BoardTexture parametresi olan materyal - tile atlas'ındaki chunk dikdörtgeni instance custom data 2-5'ten okunur
+    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Streaming")
+    UMaterialInterface* ChunkProxyMaterial;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Streaming")
+    APuzzleBoardProxy* BoardProxy;
+
+    // Zoom LOD - uzaktan bakıldığında board chunk başına bir bake edilmiş tile olarak çizilir
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming")
+    bool bEnableTileLOD;
+
+    // BoardTexture parametresi olan materyal, atanmazsa chunk proxy'leri kullanılır
+    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Streaming")
+    UMaterialInterface* TileLODMaterial;
+
+    // Görünen hücre sayısı bunu aşınca parçalar kaldırılır, sadece tile'lar çizilir
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming")
+    int32 TileLODMaxVisibleCells;
+
+    // Tile texture'ının en uzun kenarı - board'un uzun kenarı bundan fazla hücreyse tile LOD kapanır
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming")
+    int32 TileLODMaxTextureSize;
+
+    // Streaming güncellemesi başına yeniden bake edilen en fazla tile (0: sınırsız)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming")
+    int32 MaxTileBakesPerUpdate;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Streaming")
+    APuzzleBoardTiles* BoardTiles;
+
+    // Indirection renderer - tüm board tek quad, hücre -> parça texture'ı GridOccupancy'den beslenir
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rendering")
+    bool bUseIndirectionRenderer;
+
+    // CellTexture, SourceImage ve BoardSize parametreleri olan materyal
+    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Rendering")
+    UMaterialInterface* IndirectionBoardMaterial;
+
+    // Çözülmüş puzzle resmi
+    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Rendering")
+    UTexture* BoardSourceImage;
+
+    // BoardSourceImage'dan parça kenarı uyum tablosu kurulur - ipuçları çözümü kullanmadan önerilir
+    // Resim CPU'dan okunabilmeli (sıkıştırmasız BGRA8 mip 0) - cook edilmiş build'ler bunu normalde tutmaz,
+    // editör dışında tablo pratikte sadece ImportPuzzleImage'ın kurduğu BoardSourceImage ile kurulur
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hint")
+    bool bUseImageCompatibilityHints;
+
+    // Parça kenarı başına tutulan en iyi komşu adayı sayısı
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hint", meta = (ClampMin = "1", ClampMax = "32"))
+    int32 CompatibilityNeighbours;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Rendering")
+    APuzzleIndirectionBoard* IndirectionBoard;
+
+    // Doğruluk heatmap'i - hücre başına tek texture, occupancy değiştikçe artımlı güncellenir
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Debug")
+    bool bShowHeatmapOverlay;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Debug")
+    FLinearColor HeatmapEmptyColor;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Debug")
+    FLinearColor HeatmapWrongColor;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Debug")
+    FLinearColor HeatmapCorrectColor;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Debug")
+    FLinearColor HeatmapRecentColor;
+
+    // Değişen hücre bu süre boyunca "yeni değişti" rengiyle gösterilir
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Debug")
+    float HeatmapRecentSeconds;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Debug")
+    APuzzleHeatmapOverlay* HeatmapOverlay;
+
+    FTimerHandle HeatmapTimerHandle;
+
+    // Doğru yerleşmiş ve tüm komşuları doğru olan parçalar statik batch'e alınır
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Puzzle")
+    bool bFreezeSettledPieces;
+
+    // Donmuş parçaların ortak materyali - SourceImage, BoardSize ve TileMargin parametreleri,
+    // parçanın resim hücresi instance custom data 0-1'den (sütun, satır) okunur. Atanmazsa parçalar donmaz
+    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Puzzle")
+    UMaterialInterface* FrozenBatchMaterial;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Puzzle")
+    APuzzleFrozenBatch* FrozenBatch;
+
+    FTimerHandle FreezeTimerHandle;
+
+    // Idle throttling - kimse dokunmuyorken frame rate düşürülür, yan işler durur
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Idle")
+    bool bEnableIdleThrottling;
+
+    // Son etkileşimden bu kadar saniye sonra idle moda geçilir
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Idle")
+    float IdleDelaySeconds;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Idle")
+    float IdleMaxFPS;
+
+    FTimerHandle IdleCheckTimerHandle;
+
+    // Frame başına zaman dilimli işlere ayrılan süre (ms)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance")
+    float WorkBudgetMs;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance")
+    int32 GridMarkersPerStep;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance")
+    int32 ActorDestroysPerStep;
+
+    // Parça actor'lerinin OnCorrectPlacement/OnIncorrectPlacement event'leri
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance")
+    bool bFirePerPieceEvents;
+
+    // Restart sonrası gizlenmiş, dilim dilim yok edilecek actor'ler
+    UPROPERTY()
+    TArray<AActor*> RetiredActors;
+
+    // Yeniden kullanılmak üzere gizlenmiş parça actor'leri
+    UPROPERTY()
+    TArray<APuzzlePiece*> PiecePool;
+
+    // Şekil imzası -> mesh, board'lar arası paylaşılır - ölçüler değişince boşaltılır
+    UPROPERTY()
+    TMap<uint32, UStaticMesh*> PieceShapeMeshes;
+
+    // Kare olmayan grid'lerde tüm parçaların hücre prizması - CellShapeMeshKey ölçüleriyle geçerli
+    UPROPERTY()
+    UStaticMesh* CellShapeMesh;
+
+    // İçe aktarılan resmin tepsi küçük resimleri, PieceID sırasıyla
+    UPROPERTY()
+    TArray<UTexture2D*> PieceThumbnails;
+
+    // Yüklemesi süren içe aktarmanın materyal ve küçük resimleri - bitince asıl dizilerle yer değiştirir
+    UPROPERTY()
+    TArray<UMaterialInterface*> PendingImportMaterials;
+
+    UPROPERTY()
+    TArray<UTexture2D*> PendingImportThumbnails;
+
+    // PieceMaterials dilimlerinin her yandaki payı (hücre oranı) - board'a çizilirken kırpılır
+    float PieceMaterialMargin;
+
+    FTimerHandle StreamingTimerHandle;
+
 public:
     // Event dispatchers
     UPROPERTY(BlueprintAssignable, Category = "Events")
@@ -118,6 +418,24 @@ public:
     UPROPERTY(BlueprintAssignable, Category = "Events")
     FOnStatsUpdated OnStatsUpdated;
 
+    UPROPERTY(BlueprintAssignable, Category = "Events")
+    FOnIdleStateChanged OnIdleStateChanged;
+
+    // Frame başına en fazla bir kez - toplu işlemlerde parça başına event yerine
+    UPROPERTY(BlueprintAssignable, Category = "Events")
+    FOnBoardChanged OnBoardChanged;
+
+    // OnBoardChanged'ın C++ karşılığı, Blueprint VM'e girmez
+    FPuzzleOnBoardDeltaNative OnBoardChangedNative;
+
+    // İpucu worker thread'de hesaplandıktan sonra game thread'de yayınlanır
+    UPROPERTY(BlueprintAssignable, Category = "Events")
+    FOnHintReady OnHintReady;
+
+    // İçe aktarma bitip materyaller değiştiğinde ya da başarısız olduğunda
+    UPROPERTY(BlueprintAssignable, Category = "Events")
+    FOnImageImported OnImageImported;
+
     // Oyun kontrol fonksiyonları
     UFUNCTION(BlueprintCallable, Category = "Game Control")
     void StartGame();
@@ -157,8 +475,20 @@ public:
     UFUNCTION(BlueprintPure, Category = "Puzzle")
     int32 GetCompletedPiecesCount() const;
 
+    // Board dizilimin 64-bit Zobrist hash'i - her occupancy yazımında O(1) güncellenir
+    UFUNCTION(BlueprintPure, Category = "Puzzle")
+    int64 GetBoardHash() const { return (int64)BoardHash.Get(); }
+
     UFUNCTION(BlueprintPure, Category = "Puzzle")
     float GetCompletionPercentage() const;
+
+    // Board'daki parçaları çözmek için gereken en az takas sayısı (tray'dekiler hariç)
+    UFUNCTION(BlueprintPure, Category = "Puzzle")
+    int32 GetMinSwapsRemaining() const { return SwapDistance.GetMinSwaps(); }
+
+    // Sayılan hamle başına kapanan takas mesafesi - 1.0 takas-optimal oyun
+    UFUNCTION(BlueprintPure, Category = "Puzzle")
+    float GetMoveEfficiency() const;
     
     UFUNCTION(BlueprintPure, Category = "Puzzle")
     const TArray<UMaterialInterface*>& GetPieceMaterials() const { return PieceMaterials; }
@@ -197,6 +527,15 @@ public:
     
     float GetPieceSpacing() const { return PieceSpacing; }
 
+    UFUNCTION(BlueprintPure, Category = "Puzzle Config")
+    int32 GetPuzzleWidth() const { return PuzzleWidth; }
+
+    UFUNCTION(BlueprintPure, Category = "Puzzle Config")
+    int32 GetPuzzleHeight() const { return PuzzleHeight; }
+
+    UFUNCTION(BlueprintPure, Category = "Puzzle Config")
+    EPuzzleGridTopology GetGridTopology() const { return GridTopology; }
+
     // Grid snapping function
     UFUNCTION(BlueprintCallable, Category = "Grid")
     FVector GetNearestGridPosition(const FVector& WorldPosition);
@@ -221,7 +560,196 @@ public:
     
     UFUNCTION(BlueprintCallable, Category = "Grid")
     void SwapPiecesAtGridIDs(int32 GridID1, int32 GridID2);
+
+    // Actor'ü stream edilmemiş parçalar için de doğru sonuç verir
+    UFUNCTION(BlueprintPure, Category = "Grid")
+    bool IsGridCellOccupied(int32 GridID) const;
+
+    // Freeze functions - donmuş parçaların actor'ü yoktur, tutulunca ya da kümesi sürüklenince geri döner
+    UFUNCTION(BlueprintPure, Category = "Puzzle")
+    bool IsGridCellFrozen(int32 GridID) const;
+
+    UFUNCTION(BlueprintPure, Category = "Puzzle")
+    int32 GetFrozenPieceCount() const { return FrozenPieceCount; }
+
+    // Oyuncu donmuş bir parçayı tuttuğunda actor'ünü geri getirir
+    UFUNCTION(BlueprintCallable, Category = "Puzzle")
+    APuzzlePiece* LiftFrozenPieceAt(const FVector& WorldLocation);
+
+    // Sürüklenen kümenin donmuş hücrelerini actor'lerine döndürür - küme parçalanmadan birlikte taşınır
+    UFUNCTION(BlueprintCallable, Category = "Puzzle")
+    void LiftFrozenCells(const TArray<int32>& GridIDs);
+
+    // Kaldırılan parçalar hamle olmadan bırakıldığında dondurma kontrolünü yeniden çalıştırır
+    UFUNCTION(BlueprintCallable, Category = "Puzzle")
+    void SettleLiftedCells(const TArray<int32>& GridIDs);
+
+    // Sürüklenen parçaların hücreleri indirection board'da boş çizilir - parça iki kez görünmesin
+    UFUNCTION(BlueprintCallable, Category = "Puzzle")
+    void HideCellsOnBoard(const TArray<int32>& GridIDs);
+
+    // Bırakıldıktan sonra hücreler güncel occupant'larıyla yeniden yazılır - hamle olsa da olmasa da doğru
+    UFUNCTION(BlueprintCallable, Category = "Puzzle")
+    void RestoreCellsOnBoard(const TArray<int32>& GridIDs);
+
+    // Cluster functions - doğru komşu parçalar birlikte hareket eder
+    UFUNCTION(BlueprintPure, Category = "Grid")
+    int32 GetGridIDOfPiece(int32 PieceID) const;
+
+    UFUNCTION(BlueprintCallable, Category = "Grid")
+    TArray<int32> GetClusterGridIDs(int32 GridID) const;
+
+    UFUNCTION(BlueprintPure, Category = "Grid")
+    int32 GetClusterSize(int32 GridID) const;
+
+    UFUNCTION(BlueprintCallable, Category = "Puzzle")
+    TArray<APuzzlePiece*> GetClusterPieces(APuzzlePiece* Piece) const;
+
+    // Seçili parçaları tek bir board transaction'ı olarak ötele
+    // Hamle sayısı çağıran tarafından bir kez artırılır
+    UFUNCTION(BlueprintCallable, Category = "Grid")
+    bool MovePieceGroup(const TArray<int32>& SourceGridIDs, int32 DeltaCol, int32 DeltaRow);
+
+    // Sliding functions - GridID'deki taş boşluğa komşuysa kayar ve hamle sayılır
+    UFUNCTION(BlueprintCallable, Category = "Sliding")
+    bool SlideTile(int32 GridID);
+
+    UFUNCTION(BlueprintPure, Category = "Sliding")
+    bool IsSlidingTileMode() const { return bSlidingTileMode; }
+
+    UFUNCTION(BlueprintPure, Category = "Sliding")
+    int32 GetSlidingBlankGridID() const { return SlidingBlankGridID; }
+
+    // Optimal çözüm worker'da bulunur, hamleler SlidingAutoSolveInterval aralığıyla oynanır
+    UFUNCTION(BlueprintCallable, Category = "Sliding")
+    void AutoSolveSliding();
+
+    UFUNCTION(BlueprintCallable, Category = "Sliding")
+    void StopSlidingAutoSolve();
+
+    UFUNCTION(BlueprintPure, Category = "Sliding")
+    bool IsSlidingAutoSolving() const { return SlidingSolveCancel.IsValid(); }
+
+    // Edge-matching functions
+    UFUNCTION(BlueprintPure, Category = "Edge Matching")
+    bool IsEdgeMatchingMode() const { return EdgeSet.IsValid(); }
+
+    // Eşleşen kenar sayısı (çerçeve 1, iç kenar her iki taraftan 1) - tamamlanınca GetEdgeMatchSolvedScore
+    UFUNCTION(BlueprintPure, Category = "Edge Matching")
+    int32 GetEdgeMatchScore() const { return EdgeMatchScore; }
+
+    UFUNCTION(BlueprintPure, Category = "Edge Matching")
+    int32 GetEdgeMatchSolvedScore() const { return EdgeSet.IsValid() ? EdgeSet->GetSolvedScore() : 0; }
+
+    // Free-placement functions
+    UFUNCTION(BlueprintPure, Category = "Free Placement")
+    bool IsFreePlacementMode() const { return FreePlacement.IsActive(); }
+
+    // Bırakılan parçaların konumu kaydedilir, grupları komşularına yapıştırılır
+    // bCountMove false ise (tepsiden ilk bırakma) sadece tamamlanma kontrol edilir
+    UFUNCTION(BlueprintCallable, Category = "Free Placement")
+    bool ReleaseFreePieces(const TArray<APuzzlePiece*>& Pieces, bool bCountMove);
+
+    UFUNCTION(BlueprintCallable, Category = "Free Placement")
+    int32 GetFreeGroupSize(int32 PieceID) const;
+
+    // Piece shape functions - mesh'i henüz hazır değilse nullptr
+    UFUNCTION(BlueprintPure, Category = "Piece Shape")
+    UStaticMesh* GetPieceShapeMesh(int32 PieceID) const;
+
+    UFUNCTION(BlueprintPure, Category = "Piece Shape")
+    int32 GetPieceShapeMeshCount() const { return PieceShapeMeshes.Num(); }
+
+    // Image import functions - PNG/JPEG worker'da çözülüp dilimlenir, bitince puzzle yeni resimle yeniden kurulur
+    UFUNCTION(BlueprintCallable, Category = "Import", Exec)
+    void ImportPuzzleImage(const FString& FilePath);
+
+    UFUNCTION(BlueprintCallable, Category = "Import")
+    void CancelImageImport();
+
+    UFUNCTION(BlueprintPure, Category = "Import")
+    bool IsImportingImage() const { return ImageImportCancel.IsValid(); }
+
+    // İçe aktarılmış resim yoksa nullptr - tepsi materyale geri döner
+    UFUNCTION(BlueprintPure, Category = "Import")
+    UTexture2D* GetPieceThumbnail(int32 PieceID) const { return PieceThumbnails.IsValidIndex(PieceID) ? PieceThumbnails[PieceID] : nullptr; }
     
+    // Streaming functions
+    UFUNCTION(BlueprintPure, Category = "Streaming")
+    bool IsChunkStreamingActive() const;
+
+    UFUNCTION(BlueprintCallable, Category = "Streaming")
+    void UpdateChunkStreaming();
+
+    UFUNCTION(BlueprintPure, Category = "Streaming")
+    int32 GetResidentChunkCount() const;
+
+    UFUNCTION(BlueprintPure, Category = "Streaming")
+    bool IsTileLODActive() const;
+
+    UFUNCTION(BlueprintPure, Category = "Rendering")
+    bool IsIndirectionRendererActive() const;
+
+    UFUNCTION(BlueprintPure, Category = "Streaming")
+    bool IsTileLODZoomedOut() const { return bTileLODZoomedOut; }
+
+    // Work scheduler - tray, grid, restart ve kayıt işleri frame bütçesine bölünür
+    FPuzzleWorkScheduler& GetWorkScheduler() { return WorkScheduler; }
+
+    UFUNCTION(BlueprintPure, Category = "Performance")
+    FPuzzleWorkStats GetWorkStats() const { return WorkScheduler.GetStats(); }
+
+    // Worker thread'lerden kilitsiz okunabilen son yayınlanmış board - Tick'te güncellenir
+    FPuzzleBoardSnapshotRef AcquireBoardSnapshot() const { return BoardSnapshots.Acquire(); }
+
+    UFUNCTION(BlueprintPure, Category = "Puzzle")
+    int64 GetBoardSnapshotVersion() const { return (int64)BoardSnapshots.GetPublishedVersion(); }
+
+    // Hint functions - istenen ipucu board her değiştiğinde yeniden hesaplanır
+    UFUNCTION(BlueprintCallable, Category = "Hint")
+    void RequestHint();
+
+    UFUNCTION(BlueprintCallable, Category = "Hint")
+    void ClearHint();
+
+    UFUNCTION(BlueprintPure, Category = "Hint")
+    bool IsHintPending() const { return bHintRequested && HintEngine.IsRunning(); }
+
+    // Son teslim edilen ipucu - board değiştiyse bValid false
+    UFUNCTION(BlueprintPure, Category = "Hint")
+    FPuzzleHint GetCurrentHint() const { return CurrentHint; }
+
+    // Kenar uyum tablosunu worker'da yeniden kurar - hazır olana kadar eski ipucu yolu kullanılır
+    UFUNCTION(BlueprintCallable, Category = "Hint")
+    void BuildImageCompatibility();
+
+    UFUNCTION(BlueprintPure, Category = "Hint")
+    bool HasImageCompatibility() const { return ImageCompatibility.IsValid(); }
+
+    // "Bu hücreye hangi parça": komşuların kenar uyumuna göre, senkron - tablo yoksa bValid false
+    UFUNCTION(BlueprintCallable, Category = "Hint")
+    FPuzzleHint FindFittingPiece(int32 GridID) const;
+
+    // Idle functions - controller her girdi ve board değişikliğinde bildirir
+    UFUNCTION(BlueprintCallable, Category = "Idle")
+    void NotifyPlayerActivity();
+
+    UFUNCTION(BlueprintPure, Category = "Idle")
+    bool IsIdle() const { return bIsIdle; }
+
+    UFUNCTION(BlueprintPure, Category = "Idle")
+    float GetIdleTimeSeconds() const;
+
+    UFUNCTION(BlueprintPure, Category = "Idle")
+    float GetActiveTimeSeconds() const;
+
+    // Replay functions
+    UFUNCTION(BlueprintPure, Category = "Replay")
+    const FPuzzleReplayRecord& GetCurrentReplay() const { return CurrentReplay; }
+
+    UFUNCTION(BlueprintCallable, Category = "Replay")
+    bool SaveReplayToFile(const FString& FilePath);
+
     // Get available pieces for UI
     UFUNCTION(BlueprintCallable, Category = "Puzzle")
     TArray<int32> GetAvailablePieceIDs() const { return AvailablePieceIDs; }
@@ -243,6 +771,40 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Debug", Exec)
     void DebugPuzzleState();
 
+    UFUNCTION(BlueprintCallable, Category = "Debug", Exec)
+    void ToggleHeatmapOverlay();
+
+    // Zor 4x4 örneklerini senkron çözer ve sürelerini loglar
+    UFUNCTION(BlueprintCallable, Category = "Debug", Exec)
+    void BenchmarkSlidingSolver();
+
+    // Artımlı board hash'ini tam hesapla karşılaştırır - board'a yazmaz, fuzz PuzzleBoardHashTest'te
+    UFUNCTION(BlueprintCallable, Category = "Debug", Exec)
+    void VerifyBoardHash();
+
+    // Üretilmiş edge-matching board'larını (döndürmeli/döndürmesiz) senkron çözer ve sürelerini loglar
+    UFUNCTION(BlueprintCallable, Category = "Debug", Exec)
+    void BenchmarkEdgeMatchingSolver(int32 Size = 8, int32 Colours = 6);
+
+    // Dağınık Size x Size parçayı tek tek doğru yerlerine bırakıp yapıştırır, süreyi ve grup sayısını loglar
+    UFUNCTION(BlueprintCallable, Category = "Debug", Exec)
+    void BenchmarkFreePlacement(int32 Size = 100);
+
+    // Size x Size board'un şekil imzalarını üretir, tekil mesh açıklamalarını tek thread ve paralel kurar
+    // Tekil UStaticMesh'lerin game thread süresinden iş kuyruğuyla yükleme süresini tahmin eder - 32x32 ~1000 parça
+    UFUNCTION(BlueprintCallable, Category = "Debug", Exec)
+    void BenchmarkPieceShapes(int32 Size = 32);
+
+    // Resmi mevcut grid için senkron içe aktarır - tek thread ve paralel aşama sürelerini loglar
+    UFUNCTION(BlueprintCallable, Category = "Debug", Exec)
+    void BenchmarkImageImport(const FString& FilePath);
+
+    UFUNCTION(BlueprintCallable, Category = "Debug")
+    void SetHeatmapVisible(bool bVisible);
+
+    UFUNCTION(BlueprintPure, Category = "Debug")
+    bool IsHeatmapVisible() const { return bShowHeatmapOverlay; }
+
 protected:
     // Internal fonksiyonlar
     void InitializePuzzle();
@@ -253,7 +815,7 @@ protected:
     void OnTimerTick();
 
     // Grid internal functions - NEW
-    void CreateGridMarker(const FVector& Position, int32 GridIndex);
+    AStaticMeshActor* CreateGridMarker(const FVector& Position, int32 GridIndex);
     void UpdateGridMarkerVisibility();
     void SetGridMarkerMaterial(AStaticMeshActor* GridMarker, const FLinearColor& Color, float Opacity = 0.3f);
 
@@ -261,6 +823,99 @@ protected:
     void UpdateBoundaryConstraints();
     bool ValidatePuzzleConfiguration();
 
+    // Replay internal functions
+    void RecordReplayMove(EPuzzleReplayMoveType Type, int32 PieceID, int32 FromGridID, int32 ToGridID);
+
+    // Üretilen düzeni board'a tek işlemde yerleştir (-1: boş hücre)
+    void ApplyBoardArrangement(const TArray<int32>& Arrangement);
+    float GetReplayTimestamp() const;
+
+    // UpdateGridOccupancy'nin kayıt yapmayan hali
+    void ApplyGridOccupancy(int32 GridID, APuzzlePiece* Piece);
+
+    // Batch yazımlarını tek geçişte occupancy'ye ve parçalara uygula
+    void CommitBoardTransaction(const FPuzzleBoardTransaction& Transaction);
+
+    // Tek occupancy yazım noktası ve değişiklik bildirimi
+    void SetCellOccupant(int32 GridID, int32 PieceID);
+    void NotifyCellsChanged(TArrayView<const int32> ChangedGridIDs);
+
+    // Pozisyonu içeren hücre (Col, Row) - board sınırına clamp'lenmez
+    FIntPoint GetCellAtPosition(const FVector& WorldPosition) const;
+
+    // Streaming internal functions
+    void InitializeChunks();
+    int32 GetChunkIndexForGridID(int32 GridID) const;
+    void GetChunkCellRange(int32 ChunkIndex, int32& OutMinCol, int32& OutMinRow, int32& OutMaxCol, int32& OutMaxRow) const;
+    bool GetCameraViewBounds(FBox2D& OutBounds) const;
+    void MaterializeChunk(int32 ChunkIndex);
+    void DematerializeChunk(int32 ChunkIndex);
+    void CreateChunkGridMarkers(int32 ChunkIndex);
+    void UpdateChunkProxy(int32 ChunkIndex);
+    void FlushChunkProxies();
+    void GetBoardCellArea(FVector2D& OutMin, FVector2D& OutMax) const;
+    void InitializeTileLOD();
+    void InitializeIndirectionRenderer();
+
+    // Freeze internal functions
+    bool IsFreezeEligible(int32 GridID) const;
+    void EvaluateFreeze(TArrayView<const int32> ChangedGridIDs);
+    void FreezePiece(int32 PieceID);
+    UMaterialInterface* CreateFrozenBatchMaterial();
+    APuzzlePiece* UnfreezePiece(int32 PieceID);
+    void ProcessPendingFreezes();
+
+    // Restart'ta actor'leri hemen yok etmek yerine gizle ve kuyruğa al
+    void RetireActor(AActor* Actor);
+    bool DestroyRetiredActors();
+
+    // Biriken board değişikliklerini ve istatistikleri tek seferde yayınla
+    void FlushBoardChanges();
+    void FlushStatsUpdate();
+
+    // Güncel snapshot üzerinde ipucu aramasını (yeniden) başlat
+    void StartHintSearch();
+    void StopImageCompatibilityBuild();
+
+    // Şekil mesh açıklamaları worker'da, UStaticMesh'ler iş kuyruğunda frame bütçesiyle kurulur
+    void BuildPieceShapes();
+    void StopPieceShapeBuild();
+    UStaticMesh* CreatePieceShapeMesh(const FMeshDescription& Description);
+    void ApplyPieceShape(APuzzlePiece* Piece, int32 PieceID) const;
+
+    // Hex/üçgen hücre mesh'i tek ve küçük - game thread'de doğrudan kurulur
+    void BuildCellShapeMesh();
+
+    // Mip'leri ardışık BGRA8 verisinden transient texture - sadece game thread
+    UTexture2D* CreateImportTexture(const FColor* Pixels, int32 Width, int32 Height, int32 NumMips) const;
+    UTexture2D* CreateImportTexture(const FPuzzleImageMipChain& Chain) const;
+
+    // BoardSourceImage mip 0'ı CPU'ya kopyalar - sadece sıkıştırmasız BGRA8 ve bulk data yüklüyse
+    bool ReadSourceImagePixels(TArray<FColor>& OutPixels, int32& OutWidth, int32& OutHeight) const;
+    void OnHintFound(const FPuzzleHint& Hint);
+
+    // Sliding internal functions
+    void GetSlidingTiles(TArray<int32>& OutTiles) const;
+    void OnSlidingSolutionFound(const TArray<int32>& SolvedTiles, const FPuzzleSlidingSolution& Solution);
+    void StepSlidingAutoSolve();
+
+    // Idle internal functions
+    void CheckIdle();
+    void EnterIdle();
+    void ExitIdle();
+
+    // Heatmap internal functions
+    bool IsHeatmapActive() const;
+    void RebuildHeatmap();
+    void UpdateHeatmapCell(int32 GridID, bool bRecentlyChanged);
+    void ExpireHeatmapChanges();
+    void BakeDirtyTiles();
+
+    // Parça actor havuzu - stream edilen parçalar spawn/destroy yerine buradan gelir
+    APuzzlePiece* AcquirePieceActor(int32 PieceID, const FVector& Location);
+    void ReleasePieceActor(int32 PieceID);
+    void ConfigurePieceActor(APuzzlePiece* Piece, int32 PieceID);
+
 private:
     // Internal state tracking - NEW
     bool bGridInitialized;
@@ -275,4 +930,121 @@ private:
     // Using array instead of TMap to avoid pointer issues
     UPROPERTY()
     TArray<int32> GridOccupancy; // GridID -> PieceID mapping (-1 means empty)
+
+    // PieceID -> GridID (-1 means not on the board)
+    TArray<int32> PieceGridIDs;
+
+    // Correctly adjacent piece clusters, keyed by GridID
+    FPuzzleClusterSet Clusters;
+
+    // Büyük ön yerleşimli board'larda replay kaydı kapatılır (her parça bir Spawn olurdu)
+    bool bReplayActive;
+
+    // Minimum takas mesafesi - döngü ayrışımı artımlı tutulur
+    FPuzzleSwapDistance SwapDistance;
+
+    // Son board işleminin mesafe değişimi, IncrementMoveCount sayarsa verime eklenir
+    int32 LastOperationSwapGain;
+    int32 ProductiveMoveGain;
+
+    // GridOccupancy[i] == i olan hücre sayısı - tamamlanma kontrolü O(1)
+    int32 CorrectCellCount;
+
+    // GridOccupancy'nin Zobrist hash'i - SetCellOccupant'ta artımlı
+    FPuzzleZobristHash BoardHash;
+
+    // Chunk bookkeeping - her occupancy yazımında artımlı güncellenir
+    int32 ChunksX;
+    int32 ChunksY;
+    TBitArray<> ResidentChunks;
+    TBitArray<> DirtyProxyChunks;
+    TArray<int32> DirtyProxyList;
+    TArray<int32> ChunkOccupiedCounts;
+    TArray<int32> ChunkCorrectCounts;
+
+    // Tile LOD - yeniden bake bekleyen chunk'lar
+    TBitArray<> DirtyTileRegions;
+    TArray<int32> DirtyTileList;
+    bool bTileLODZoomedOut;
+
+    // Freeze state - PieceID başına
+    TBitArray<> FrozenPieces;
+    int32 FrozenPieceCount;
+    TSet<int32> PendingFreezePieces;
+    TArray<int32> PendingUnfreezePieces;
+
+    FPuzzleWorkScheduler WorkScheduler;
+
+    // Frame içindeki occupancy yazımları - Tick'te tek delta olarak yayınlanır
+    FPuzzleChangeJournal BoardJournal;
+    FPuzzleBoardDelta PendingDelta;
+
+    // Delta ile birlikte yayınlanan değişmez occupancy kopyaları
+    FPuzzleSnapshotPublisher BoardSnapshots;
+
+    // BoardSnapshots'tan sonra tanımlı - önce yok edilir, pin'lerini bırakır
+    FPuzzleHintEngine HintEngine;
+    FPuzzleHint CurrentHint;
+    bool bHintRequested;
+
+    // Resim kenarı uyum tablosu - ipucu task'larıyla paylaşılır
+    TSharedPtr<const FPuzzleEdgeCompatibility, ESPMode::ThreadSafe> ImageCompatibility;
+    TSharedPtr<std::atomic<bool>, ESPMode::ThreadSafe> ImageCompatibilityCancel;
+    UE::Tasks::FTask ImageCompatibilityTask;
+
+    // Sliding state - solver sadece 5x5'e kadar board'larda kurulur, ipucu task'larıyla paylaşılır
+    TSharedPtr<const FPuzzleSlidingSolver, ESPMode::ThreadSafe> SlidingSolver;
+
+    // Map edilmiş pattern database - restart'larda yeniden map edilmez
+    TSharedPtr<const FPuzzlePatternDatabase, ESPMode::ThreadSafe> SlidingPatternDatabase;
+    int32 SlidingBlankGridID;
+    TArray<int32> SlidingAutoSolveMoves;
+    int32 SlidingAutoSolveIndex;
+    TSharedPtr<std::atomic<bool>, ESPMode::ThreadSafe> SlidingSolveCancel;
+    UE::Tasks::FTask SlidingSolveTask;
+    FTimerHandle SlidingAutoSolveTimerHandle;
+
+    // Edge-matching state - set ve solver ipucu task'larıyla paylaşılır
+    TSharedPtr<const FPuzzleEdgeSet, ESPMode::ThreadSafe> EdgeSet;
+    TSharedPtr<const FPuzzleEdgeSolver, ESPMode::ThreadSafe> EdgeSolver;
+
+    // Tüm hücrelerin ScoreCell toplamı - SetCellOccupant'ta artımlı
+    int32 EdgeMatchScore;
+
+    // Free-placement state - parçalar grid occupancy'ye girmez
+    FPuzzleFreePlacement FreePlacement;
+
+    // Piece shape state - imzalar board'a göre, mesh cache'i PieceShapeMeshKey ölçüleriyle geçerli
+    TSharedPtr<const FPuzzlePieceShapeSet, ESPMode::ThreadSafe> PieceShapes;
+    FVector PieceShapeMeshKey;
+    FVector CellShapeMeshKey;
+    TSharedPtr<std::atomic<bool>, ESPMode::ThreadSafe> PieceShapeCancel;
+    UE::Tasks::FTask PieceShapeTask;
+
+    // Image import state - worker çözer ve dilimler, texture'lar iş kuyruğunda yüklenir
+    TSharedPtr<std::atomic<bool>, ESPMode::ThreadSafe> ImageImportCancel;
+    UE::Tasks::FTask ImageImportTask;
+
+    // OnStatsUpdated frame başına en fazla bir kez, idle iken uyanışa kadar ertelenir
+    bool bStatsDirty;
+
+    // Idle state - süreler gerçek zamanla (FPlatformTime) ölçülür
+    bool bIsIdle;
+    float SavedMaxFPS;
+    double LastActivityTime;
+    double IdleStateChangeTime;
+    double AccumulatedIdleSeconds;
+    double AccumulatedActiveSeconds;
+    int32 IdleEnterCount;
+
+    // Heatmap - hücrenin son değişim zamanı ve süresi dolacak hücreler (zaman sıralı)
+    TArray<float> HeatmapChangeTimes;
+    TArray<TPair<int32, float>> RecentHeatmapCells;
+    int32 RecentHeatmapHead;
+
+    // Stream edilmemiş chunk'a taşınmış, bir sonraki güncellemede havuza dönecek parçalar
+    TSet<int32> PendingReleasePieces;
+
+    // ChunkIndex -> o chunk'ın grid marker'ları
+    TMultiMap<int32, AStaticMeshActor*> ChunkGridMarkers;
 };
\ No newline at end of file
@@ -0,0 +1,305 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PuzzleGridTopology.generated.h"
+
+UENUM(BlueprintType)
+enum class EPuzzleGridTopology : uint8
+{
+    Square,
+    // Sivri tepeli altıgenler, tek satırlar yarım hücre sağa kaymış (odd-r)
+    Hex,
+    // Satır başına dönüşümlü yukarı/aşağı bakan eşkenar üçgenler
+    Triangle
+};
+
+/**
+ * Compile-time grid topology policies. Every policy maps (Col, Row) cells to board-local
+ * positions relative to cell (0, 0) and back in O(1), and names the neighbours of a cell
+ * by direction index. GridID stays Row * Width + Col for every topology, so occupancy,
+ * snapshots and replays do not change with the layout.
+ *
+ * Neighbour directions are chosen so that "piece B is piece A's neighbour in direction D"
+ * means the same edge on every cell, which is what cluster and freeze checks compare.
+ * Callers pick the policy once per operation with DispatchGridTopology; the per-cell
+ * calls are static and inline.
+ */
+struct FPuzzleSquareTopology
+{
+    static constexpr EPuzzleGridTopology Type = EPuzzleGridTopology::Square;
+
+    // Sol, sağ, üst, alt
+    static constexpr int32 NumDirections = 4;
+
+    static FVector2D GetCellCenter(int32 Col, int32 Row, float Spacing)
+    {
+        return FVector2D(Col * Spacing, Row * Spacing);
+    }
+
+    // Pozisyonu içeren hücre - board sınırına clamp'lenmez
+    static FIntPoint GetCellAt(const FVector2D& Local, float Spacing)
+    {
+        return FIntPoint(FMath::RoundToInt(Local.X / Spacing), FMath::RoundToInt(Local.Y / Spacing));
+    }
+
+    static bool GetNeighbour(int32 Col, int32 Row, int32 Direction, FIntPoint& OutCell)
+    {
+        static constexpr int32 Offsets[NumDirections][2] = { { -1, 0 }, { 1, 0 }, { 0, -1 }, { 0, 1 } };
+        OutCell = FIntPoint(Col + Offsets[Direction][0], Row + Offsets[Direction][1]);
+        return true;
+    }
+
+    // Hücrenin eksen hizalı yarı boyutu
+    static FVector2D GetCellHalfExtent(float Spacing)
+    {
+        return FVector2D(Spacing * 0.5f, Spacing * 0.5f);
+    }
+
+    static float GetCellYaw(int32 Col, int32 Row)
+    {
+        return 0.0f;
+    }
+
+    // İki hücreye aynı parça şekli oturur mu
+    static bool HaveSameShape(int32 CellA, int32 CellB, int32 Width)
+    {
+        return true;
+    }
+
+    // Grup bu ötelemeyle taşındığında hücre şekilleri korunur mu
+    static bool PreservesShape(int32 DeltaCol, int32 DeltaRow)
+    {
+        return true;
+    }
+};
+
+struct FPuzzleHexTopology
+{
+    static constexpr EPuzzleGridTopology Type = EPuzzleGridTopology::Hex;
+
+    // Doğu, batı, kuzeydoğu, kuzeybatı, güneydoğu, güneybatı
+    static constexpr int32 NumDirections = 6;
+
+    // Satırlar arası mesafe: Spacing * sqrt(3) / 2
+    static constexpr float RowScale = 0.8660254f;
+
+    static FVector2D GetCellCenter(int32 Col, int32 Row, float Spacing)
+    {
+        return FVector2D((Col + 0.5f * (Row & 1)) * Spacing, Row * RowScale * Spacing);
+    }
+
+    static FIntPoint GetCellAt(const FVector2D& Local, float Spacing)
+    {
+        // Axial koordinata çevir, cube rounding ile en yakın altıgen
+        const float FracQ = Local.X / Spacing - Local.Y / (2.0f * RowScale * Spacing);
+        const float FracR = Local.Y / (RowScale * Spacing);
+        const float FracS = -FracQ - FracR;
+
+        int32 Q = FMath::RoundToInt(FracQ);
+        int32 R = FMath::RoundToInt(FracR);
+        const int32 S = FMath::RoundToInt(FracS);
+
+        const float DiffQ = FMath::Abs(Q - FracQ);
+        const float DiffR = FMath::Abs(R - FracR);
+        const float DiffS = FMath::Abs(S - FracS);
+        if (DiffQ > DiffR && DiffQ > DiffS)
+        {
+            Q = -R - S;
+        }
+        else if (DiffR > DiffS)
+        {
+            R = -Q - S;
+        }
+
+        // Axial -> odd-r offset
+        return FIntPoint(Q + (R - (R & 1)) / 2, R);
+    }
+
+    static bool GetNeighbour(int32 Col, int32 Row, int32 Direction, FIntPoint& OutCell)
+    {
+        // Tek satırlar yarım hücre sağda - çapraz komşular satır paritesine göre kayar
+        static constexpr int32 Offsets[2][NumDirections][2] = {
+            { { 1, 0 }, { -1, 0 }, { 0, -1 }, { -1, -1 }, { 0, 1 }, { -1, 1 } },
+            { { 1, 0 }, { -1, 0 }, { 1, -1 }, { 0, -1 }, { 1, 1 }, { 0, 1 } }
+        };
+        const int32 Parity = Row & 1;
+        OutCell = FIntPoint(Col + Offsets[Parity][Direction][0], Row + Offsets[Parity][Direction][1]);
+        return true;
+    }
+
+    static FVector2D GetCellHalfExtent(float Spacing)
+    {
+        // Köşe yarıçapı Spacing / sqrt(3)
+        return FVector2D(Spacing * 0.5f, Spacing * 0.57735027f);
+    }
+
+    static float GetCellYaw(int32 Col, int32 Row)
+    {
+        return 0.0f;
+    }
+
+    static bool HaveSameShape(int32 CellA, int32 CellB, int32 Width)
+    {
+        return true;
+    }
+
+    static bool PreservesShape(int32 DeltaCol, int32 DeltaRow)
+    {
+        // Tek sayıda satır kaydırmak odd-r ofsetini bozar
+        return (DeltaRow & 1) == 0;
+    }
+};
+
+struct FPuzzleTriangleTopology
+{
+    static constexpr EPuzzleGridTopology Type = EPuzzleGridTopology::Triangle;
+
+    // Sol, sağ, alt (sadece yukarı bakan), üst (sadece aşağı bakan)
+    static constexpr int32 NumDirections = 4;
+
+    static constexpr float RowScale = 0.8660254f;
+
+    // (Col + Row) çiftse tepe yukarıda, taban aşağıda
+    static bool IsUpward(int32 Col, int32 Row)
+    {
+        return ((Col + Row) & 1) == 0;
+    }
+
+    static FVector2D GetCellCenter(int32 Col, int32 Row, float Spacing)
+    {
+        // Ağırlık merkezi satır ortasından yüksekliğin 1/6'sı kadar tabana yakın
+        const float RowHeight = RowScale * Spacing;
+        return FVector2D(Col * Spacing * 0.5f, Row * RowHeight + (IsUpward(Col, Row) ? RowHeight : -RowHeight) / 6.0f);
+    }
+
+    static FIntPoint GetCellAt(const FVector2D& Local, float Spacing)
+    {
+        const float RowHeight = RowScale * Spacing;
+        const float RowPosition = Local.Y / RowHeight + 0.5f;
+        const int32 Row = FMath::FloorToInt(RowPosition);
+        const float FracY = RowPosition - Row;
+
+        // Yarım kenar birimlerinde x; Col ile Col + 1 arasındaki kenar çaprazdır
+        const float ColPosition = Local.X / (Spacing * 0.5f);
+        const int32 Col = FMath::FloorToInt(ColPosition);
+        const float EdgePosition = IsUpward(Col, Row) ? Col + FracY : Col + 1.0f - FracY;
+
+        return FIntPoint(ColPosition < EdgePosition ? Col : Col + 1, Row);
+    }
+
+    static bool GetNeighbour(int32 Col, int32 Row, int32 Direction, FIntPoint& OutCell)
+    {
+        switch (Direction)
+        {
+        case 0: OutCell = FIntPoint(Col - 1, Row); return true;
+        case 1: OutCell = FIntPoint(Col + 1, Row); return true;
+        case 2: OutCell = FIntPoint(Col, Row + 1); return IsUpward(Col, Row);
+        default: OutCell = FIntPoint(Col, Row - 1); return !IsUpward(Col, Row);
+        }
+    }
+
+    static FVector2D GetCellHalfExtent(float Spacing)
+    {
+        return FVector2D(Spacing * 0.5f, RowScale * Spacing * 0.5f);
+    }
+
+    static float GetCellYaw(int32 Col, int32 Row)
+    {
+        return IsUpward(Col, Row) ? 0.0f : 180.0f;
+    }
+
+    static bool HaveSameShape(int32 CellA, int32 CellB, int32 Width)
+    {
+        return IsUpward(CellA % Width, CellA / Width) == IsUpward(CellB % Width, CellB / Width);
+    }
+
+    static bool PreservesShape(int32 DeltaCol, int32 DeltaRow)
+    {
+        // Yön paritesi korunmalı - yukarı bakan hücre yukarı bakana taşınır
+        return ((DeltaCol + DeltaRow) & 1) == 0;
+    }
+};
+
+/**
+ * Calls Func with the policy object for Topology, e.g.
+ * DispatchGridTopology(GridTopology, [&](auto Policy) { using FTopology = decltype(Policy); ... }).
+ * Func must return the same type for every policy.
+ */
+template<typename FuncType>
+auto DispatchGridTopology(EPuzzleGridTopology Topology, FuncType&& Func)
+{
+    switch (Topology)
+    {
+    case EPuzzleGridTopology::Hex:
+        return Func(FPuzzleHexTopology());
+    case EPuzzleGridTopology::Triangle:
+        return Func(FPuzzleTriangleTopology());
+    default:
+        return Func(FPuzzleSquareTopology());
+    }
+}
+
+// Board içindeki komşu, yoksa -1
+template<typename TopologyType>
+FORCEINLINE int32 GetGridNeighbour(int32 GridID, int32 Direction, int32 Width, int32 Height)
+{
+    FIntPoint Cell;
+    if (!TopologyType::GetNeighbour(GridID % Width, GridID / Width, Direction, Cell) ||
+        Cell.X < 0 || Cell.X >= Width || Cell.Y < 0 || Cell.Y >= Height)
+    {
+        return -1;
+    }
+    return Cell.Y * Width + Cell.X;
+}
+
+// Func(Direction, NeighbourGridID) - sadece board içindeki komşular
+template<typename TopologyType, typename FuncType>
+FORCEINLINE void ForEachGridNeighbour(int32 GridID, int32 Width, int32 Height, FuncType&& Func)
+{
+    for (int32 Direction = 0; Direction < TopologyType::NumDirections; Direction++)
+    {
+        const int32 Neighbour = GetGridNeighbour<TopologyType>(GridID, Direction, Width, Height);
+        if (Neighbour >= 0)
+        {
+            Func(Direction, Neighbour);
+        }
+    }
+}
+
+// Hücre merkezlerinin sınır kutusu - uç hücreler hep kenar satır/sütunlarda
+template<typename TopologyType>
+void GetGridCenterBounds(int32 Width, int32 Height, float Spacing, FVector2D& OutMin, FVector2D& OutMax)
+{
+    if (Width <= 0 || Height <= 0)
+    {
+        OutMin = OutMax = FVector2D::ZeroVector;
+        return;
+    }
+
+    OutMin = FVector2D(MAX_flt, MAX_flt);
+    OutMax = FVector2D(-MAX_flt, -MAX_flt);
+
+    auto AddCell = [&](int32 Col, int32 Row)
+    {
+        const FVector2D Center = TopologyType::GetCellCenter(Col, Row, Spacing);
+        OutMin = FVector2D(FMath::Min(OutMin.X, Center.X), FMath::Min(OutMin.Y, Center.Y));
+        OutMax = FVector2D(FMath::Max(OutMax.X, Center.X), FMath::Max(OutMax.Y, Center.Y));
+    };
+
+    for (int32 Col = 0; Col < Width; Col++)
+    {
+        AddCell(Col, 0);
+        AddCell(Col, FMath::Min(1, Height - 1));
+        AddCell(Col, FMath::Max(Height - 2, 0));
+        AddCell(Col, Height - 1);
+    }
+    for (int32 Row = 0; Row < Height; Row++)
+    {
+        AddCell(0, Row);
+        AddCell(FMath::Min(1, Width - 1), Row);
+        AddCell(FMath::Max(Width - 2, 0), Row);
+        AddCell(Width - 1, Row);
+    }
+}
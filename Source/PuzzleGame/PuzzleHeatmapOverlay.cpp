@@ -0,0 +1,78 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "PuzzleHeatmapOverlay.h"
+#include "Engine/StaticMesh.h"
+#include "UObject/ConstructorHelpers.h"
+
+APuzzleHeatmapOverlay::APuzzleHeatmapOverlay()
+{
+    PrimaryActorTick.bCanEverTick = false;
+
+    OverlayQuad = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("OverlayQuad"));
+    RootComponent = OverlayQuad;
+
+    // Overlay tıklamaları engellememeli
+    OverlayQuad->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    OverlayQuad->SetCastShadow(false);
+    OverlayQuad->SetReceivesDecals(false);
+    OverlayQuad->SetVisibility(false);
+
+    static ConstructorHelpers::FObjectFinder<UStaticMesh> PlaneMeshFinder(TEXT("/Engine/BasicShapes/Plane"));
+    if (PlaneMeshFinder.Succeeded())
+    {
+        OverlayQuad->SetStaticMesh(PlaneMeshFinder.Object);
+    }
+
+    static ConstructorHelpers::FObjectFinder<UMaterialInterface> OverlayMaterialFinder(TEXT("/Engine/EngineMaterials/Widget3DPassThrough_Translucent"));
+    OverlayMaterial = OverlayMaterialFinder.Succeeded() ? OverlayMaterialFinder.Object : nullptr;
+
+    TextureParameterName = TEXT("SlateUI");
+    OverlayHeight = 60.0f;
+    OverlayMaterialInstance = nullptr;
+}
+
+bool APuzzleHeatmapOverlay::InitializeOverlay(int32 InWidth, int32 InHeight, const FVector2D& CellAreaMin, const FVector2D& CellAreaMax,
+    const FColor& ClearColor)
+{
+    ClearOverlay();
+
+    if (!OverlayMaterial || !CellTexture.Initialize(InWidth, InHeight, PF_B8G8R8A8, ClearColor))
+    {
+        return false;
+    }
+
+    OverlayMaterialInstance = UMaterialInstanceDynamic::Create(OverlayMaterial, this);
+    OverlayMaterialInstance->SetTextureParameterValue(TextureParameterName, CellTexture.GetTexture());
+    OverlayQuad->SetMaterial(0, OverlayMaterialInstance);
+
+    // Engine plane 100x100 birim
+    const FVector2D Center = (CellAreaMin + CellAreaMax) * 0.5f;
+    const FVector2D Size = CellAreaMax - CellAreaMin;
+    SetActorLocation(FVector(Center.X, Center.Y, OverlayHeight));
+    SetActorScale3D(FVector(Size.X / 100.0f, Size.Y / 100.0f, 1.0f));
+
+    CellTexture.Flush();
+    return true;
+}
+
+void APuzzleHeatmapOverlay::ClearOverlay()
+{
+    CellTexture.Reset();
+    OverlayMaterialInstance = nullptr;
+    OverlayQuad->SetVisibility(false);
+}
+
+void APuzzleHeatmapOverlay::SetCellColor(int32 GridID, const FColor& Color)
+{
+    CellTexture.SetTexel(GridID, Color);
+}
+
+int32 APuzzleHeatmapOverlay::FlushCells()
+{
+    return CellTexture.Flush();
+}
+
+void APuzzleHeatmapOverlay::SetOverlayVisible(bool bVisible)
+{
+    OverlayQuad->SetVisibility(bVisible && IsInitialized());
+}
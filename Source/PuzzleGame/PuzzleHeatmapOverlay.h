@@ -0,0 +1,58 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "Components/StaticMeshComponent.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "PuzzleCellTexture.h"
+#include "PuzzleHeatmapOverlay.generated.h"
+
+/**
+ * Translucent quad over the board tinted per cell from a single dynamic texture.
+ * The owner writes cell colours as occupancy changes and flushes once per board
+ * operation, so the per-frame cost is one draw regardless of board size.
+ */
+UCLASS()
+class PUZZLEGAME_API APuzzleHeatmapOverlay : public AActor
+{
+    GENERATED_BODY()
+
+public:
+    APuzzleHeatmapOverlay();
+
+    bool InitializeOverlay(int32 InWidth, int32 InHeight, const FVector2D& CellAreaMin, const FVector2D& CellAreaMax,
+        const FColor& ClearColor);
+
+    void ClearOverlay();
+
+    void SetCellColor(int32 GridID, const FColor& Color);
+
+    int32 FlushCells();
+
+    void SetOverlayVisible(bool bVisible);
+
+    bool IsInitialized() const { return CellTexture.IsValid(); }
+
+protected:
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+    UStaticMeshComponent* OverlayQuad;
+
+    // Varsayılan engine'in widget pass-through materyali, texture parametresi SlateUI
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Heatmap")
+    UMaterialInterface* OverlayMaterial;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Heatmap")
+    FName TextureParameterName;
+
+    // Parçaların üstünde kalacak yükseklik
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Heatmap")
+    float OverlayHeight;
+
+    UPROPERTY()
+    UMaterialInstanceDynamic* OverlayMaterialInstance;
+
+private:
+    TPuzzleCellTexture<FColor> CellTexture;
+};
@@ -0,0 +1,283 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "PuzzleHintEngine.h"
+#include "PuzzleSlidingSolver.h"
+#include "PuzzleEdgeSolver.h"
+#include "PuzzleEdgeCompatibility.h"
+#include "Async/Async.h"
+
+namespace PuzzleHint
+{
+    // İptal bayrağı bu kadar hücrede bir kontrol edilir
+    constexpr int32 CancelCheckInterval = 16 * 1024;
+
+    // Uyum ipucunda hücre başı maliyet top-K listeleriyle orantılı - daha sık kontrol
+    constexpr int32 CompatibilityCheckInterval = 256;
+}
+
+FPuzzleHintEngine::~FPuzzleHintEngine()
+{
+    Cancel(true);
+}
+
+void FPuzzleHintEngine::Start(FPuzzleBoardSnapshotRef&& Snapshot, FOnHintReady OnReady, FSearchFunction SearchFunction)
+{
+    Cancel();
+
+    if (!Snapshot.IsValid())
+    {
+        return;
+    }
+
+    Search = MakeShared<FSearchState, ESPMode::ThreadSafe>();
+    Search->OnReady = MoveTemp(OnReady);
+
+    TSharedPtr<FPuzzleBoardSnapshotRef, ESPMode::ThreadSafe> PinnedSnapshot = MakeShared<FPuzzleBoardSnapshotRef, ESPMode::ThreadSafe>(MoveTemp(Snapshot));
+    TSharedPtr<FSearchState, ESPMode::ThreadSafe> State = Search;
+
+    // Biten aramaları bırak, liste en fazla henüz iptal kontrolüne varmamış aramalar kadar büyür
+    InFlightTasks.RemoveAllSwap([](const UE::Tasks::FTask& Task) { return Task.IsCompleted(); });
+
+    InFlightTasks.Add(UE::Tasks::Launch(UE_SOURCE_LOCATION, [State, PinnedSnapshot, SearchFunction = MoveTemp(SearchFunction)]()
+    {
+        const FPuzzleHint Hint = SearchFunction
+            ? SearchFunction(**PinnedSnapshot, State->bCancelled)
+            : FindBestHint(**PinnedSnapshot, State->bCancelled);
+
+        // Pin worker'da bırakılır, game thread'e sadece sonuç gider
+        PinnedSnapshot->Release();
+
+        if (State->bCancelled.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        AsyncTask(ENamedThreads::GameThread, [State, Hint]()
+        {
+            if (!State->bCancelled.load(std::memory_order_relaxed) && !State->bDelivered)
+            {
+                State->bDelivered = true;
+                State->OnReady(Hint);
+            }
+        });
+    }));
+}
+
+void FPuzzleHintEngine::Cancel(bool bWait)
+{
+    if (Search.IsValid())
+    {
+        Search->bCancelled.store(true, std::memory_order_relaxed);
+        Search.Reset();
+    }
+
+    if (bWait)
+    {
+        UE::Tasks::Wait(InFlightTasks);
+        InFlightTasks.Reset();
+    }
+}
+
+FPuzzleHint FPuzzleHintEngine::FindBestHint(const FPuzzleBoardSnapshot& Snapshot, const std::atomic<bool>& bCancelled)
+{
+    FPuzzleHint Hint;
+    Hint.BoardVersion = (int64)Snapshot.GetVersion();
+
+    const int32 NumCells = Snapshot.GetNumCells();
+    for (int32 GridID = 0; GridID < NumCells; GridID++)
+    {
+        if ((GridID % PuzzleHint::CancelCheckInterval) == 0 && bCancelled.load(std::memory_order_relaxed))
+        {
+            return FPuzzleHint();
+        }
+
+        const int32 PieceID = Snapshot.GetOccupant(GridID);
+        if (PieceID < 0 || PieceID == GridID || PieceID >= NumCells)
+        {
+            continue;
+        }
+
+        // 2-döngü: iki parça birbirinin yerinde - tek takas ikisini de düzeltir
+        if (Snapshot.GetOccupant(PieceID) == GridID)
+        {
+            Hint.bValid = true;
+            Hint.FromGridID = GridID;
+            Hint.ToGridID = PieceID;
+            Hint.PieceID = PieceID;
+            Hint.PiecesFixed = 2;
+            return Hint;
+        }
+
+        // Yedek: parçayı kendi hücresine taşıyan ilk takas
+        if (!Hint.bValid)
+        {
+            Hint.bValid = true;
+            Hint.FromGridID = GridID;
+            Hint.ToGridID = PieceID;
+            Hint.PieceID = PieceID;
+            Hint.PiecesFixed = 1;
+        }
+    }
+
+    return Hint;
+}
+
+FPuzzleHint FPuzzleHintEngine::FindSlidingHint(const FPuzzleSlidingSolver& Solver, const FPuzzleBoardSnapshot& Snapshot,
+    const std::atomic<bool>& bCancelled, uint64 MaxNodes)
+{
+    TArray<int32> Tiles;
+    Snapshot.CopyOccupancy(Tiles);
+    if (Tiles.Num() != Solver.GetWidth() * Solver.GetHeight())
+    {
+        return FPuzzleHint();
+    }
+
+    // Boş hücre solver'da boşluk taşı olarak görünür
+    int32 BlankGridID = INDEX_NONE;
+    for (int32 GridID = 0; GridID < Tiles.Num(); GridID++)
+    {
+        if (Tiles[GridID] >= 0)
+        {
+            continue;
+        }
+        if (BlankGridID != INDEX_NONE)
+        {
+            return FPuzzleHint();
+        }
+        BlankGridID = GridID;
+        Tiles[GridID] = Solver.GetBlankTile();
+    }
+
+    FPuzzleSlidingSolution Solution;
+    if (BlankGridID == INDEX_NONE || !Solver.Solve(Tiles, Solution, &bCancelled, MaxNodes) || Solution.Moves.Num() == 0)
+    {
+        return FPuzzleHint();
+    }
+
+    FPuzzleHint Hint;
+    Hint.bValid = true;
+    Hint.FromGridID = Solution.Moves[0];
+    Hint.ToGridID = BlankGridID;
+    Hint.PieceID = Tiles[Hint.FromGridID];
+    Hint.PiecesFixed = Tiles[Hint.FromGridID] == BlankGridID ? 1 : 0;
+    Hint.MovesRemaining = Solution.Moves.Num();
+    Hint.BoardVersion = (int64)Snapshot.GetVersion();
+    return Hint;
+}
+
+FPuzzleHint FPuzzleHintEngine::FindEdgeMatchingHint(const FPuzzleEdgeSolver& Solver, const FPuzzleBoardSnapshot& Snapshot,
+    const std::atomic<bool>& bCancelled, uint64 MaxNodes)
+{
+    const FPuzzleEdgeSet& EdgeSet = Solver.GetEdgeSet();
+    TArray<int32> Occupancy;
+    Snapshot.CopyOccupancy(Occupancy);
+    if (Occupancy.Num() != EdgeSet.GetNumPieces())
+    {
+        return FPuzzleHint();
+    }
+
+    // Dört kenarı da eşleşen parçalar kilitlenir - çözüm oyuncunun kurduğu bölgeleri bozmaz
+    TArray<int32> LockedPieces;
+    LockedPieces.Init(INDEX_NONE, Occupancy.Num());
+    for (int32 GridID = 0; GridID < Occupancy.Num(); GridID++)
+    {
+        if (EdgeSet.ScoreCell(Occupancy, GridID) == 4)
+        {
+            LockedPieces[GridID] = Occupancy[GridID];
+        }
+    }
+
+    // Yerel olarak eşleşen ama küresel olarak yanlış bölge varsa kilitsiz yeniden dene
+    FPuzzleEdgeSolution Solution;
+    if (!Solver.Solve(LockedPieces, Solution, &bCancelled, MaxNodes) &&
+        (bCancelled.load(std::memory_order_relaxed) || !Solver.Solve(TArrayView<const int32>(), Solution, &bCancelled, MaxNodes)))
+    {
+        return FPuzzleHint();
+    }
+
+    // Oyunda döndürme yok - çözüm parçaları board'da olan ilk sapan hücre
+    TArray<int32> PieceCells;
+    PieceCells.Init(INDEX_NONE, Occupancy.Num());
+    for (int32 GridID = 0; GridID < Occupancy.Num(); GridID++)
+    {
+        if (Occupancy.IsValidIndex(Occupancy[GridID]))
+        {
+            PieceCells[Occupancy[GridID]] = GridID;
+        }
+    }
+
+    for (int32 GridID = 0; GridID < Occupancy.Num(); GridID++)
+    {
+        const int32 TargetPiece = Solution.Pieces[GridID];
+        const int32 FromGridID = PieceCells[TargetPiece];
+        if (Occupancy[GridID] == TargetPiece || FromGridID == INDEX_NONE)
+        {
+            continue;
+        }
+
+        FPuzzleHint Hint;
+        Hint.bValid = true;
+        Hint.FromGridID = FromGridID;
+        Hint.ToGridID = GridID;
+        Hint.PieceID = TargetPiece;
+        Hint.PiecesFixed = Occupancy[GridID] >= 0 && Solution.Pieces[FromGridID] == Occupancy[GridID] ? 2 : 1;
+        Hint.BoardVersion = (int64)Snapshot.GetVersion();
+        return Hint;
+    }
+    return FPuzzleHint();
+}
+
+FPuzzleHint FPuzzleHintEngine::FindCompatibilityHint(const FPuzzleEdgeCompatibility& Compatibility, const FPuzzleBoardSnapshot& Snapshot,
+    const std::atomic<bool>& bCancelled)
+{
+    TArray<int32> Occupancy;
+    Snapshot.CopyOccupancy(Occupancy);
+    if (Occupancy.Num() != Compatibility.GetNumPieces())
+    {
+        return FPuzzleHint();
+    }
+
+    TArray<int32> PieceCells;
+    PieceCells.Init(INDEX_NONE, Occupancy.Num());
+    for (int32 GridID = 0; GridID < Occupancy.Num(); GridID++)
+    {
+        if (PieceCells.IsValidIndex(Occupancy[GridID]))
+        {
+            PieceCells[Occupancy[GridID]] = GridID;
+        }
+    }
+
+    FPuzzleHint Hint;
+    float BestConfidence = 0.0f;
+    for (int32 GridID = 0; GridID < Occupancy.Num(); GridID++)
+    {
+        if ((GridID % PuzzleHint::CompatibilityCheckInterval) == 0 && bCancelled.load(std::memory_order_relaxed))
+        {
+            return FPuzzleHint();
+        }
+
+        int32 PieceID = INDEX_NONE;
+        float Score = 0.0f;
+        float Confidence = 0.0f;
+        if (!Compatibility.FindBestPieceForCell(Occupancy, GridID, PieceID, Score, Confidence) || Confidence <= BestConfidence)
+        {
+            continue;
+        }
+
+        // Dolu hücrede mevcut parça zaten en az öneri kadar uyuyorsa dokunulmaz
+        float CurrentScore = 0.0f;
+        if (Occupancy[GridID] >= 0 && Compatibility.ScorePieceForCell(Occupancy, GridID, Occupancy[GridID], CurrentScore) && CurrentScore <= Score)
+        {
+            continue;
+        }
+
+        BestConfidence = Confidence;
+        Hint.bValid = true;
+        Hint.FromGridID = PieceCells[PieceID];
+        Hint.ToGridID = GridID;
+        Hint.PieceID = PieceID;
+    }
+
+    Hint.BoardVersion = (int64)Snapshot.GetVersion();
+    return Hint;
+}
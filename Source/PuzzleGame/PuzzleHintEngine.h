@@ -0,0 +1,98 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PuzzleBoardSnapshot.h"
+#include "Tasks/Task.h"
+#include "PuzzleHintEngine.generated.h"
+
+class FPuzzleSlidingSolver;
+class FPuzzleEdgeSolver;
+class FPuzzleEdgeCompatibility;
+
+// Önerilen tek hamle - SwapPiecesAtGridIDs(FromGridID, ToGridID)
+USTRUCT(BlueprintType)
+struct PUZZLEGAME_API FPuzzleHint
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Hint")
+    bool bValid = false;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Hint")
+    int32 FromGridID = -1;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Hint")
+    int32 ToGridID = -1;
+
+    // Önerilen parça - FromGridID -1 ise parça tray'de, ToGridID'ye yerleştirilir
+    UPROPERTY(BlueprintReadOnly, Category = "Hint")
+    int32 PieceID = -1;
+
+    // Hamlenin doğru yerine oturttuğu parça sayısı (2: permütasyondaki 2-döngü)
+    UPROPERTY(BlueprintReadOnly, Category = "Hint")
+    int32 PiecesFixed = 0;
+
+    // Çözüme kalan en az hamle, bilinmiyorsa -1 (sliding modu)
+    UPROPERTY(BlueprintReadOnly, Category = "Hint")
+    int32 MovesRemaining = -1;
+
+    // İpucunun hesaplandığı board snapshot versiyonu
+    UPROPERTY(BlueprintReadOnly, Category = "Hint")
+    int64 BoardVersion = 0;
+};
+
+/**
+ * Computes move hints on a worker task from a pinned board snapshot and hands the result
+ * back to the game thread. Starting a new search cancels the previous one; a cancelled
+ * search stops at its next check and never delivers its result. Cancelled searches keep
+ * running until that check, so every launched task is tracked until it completes and
+ * Cancel(true) waits for all of them, not just the newest.
+ */
+class PUZZLEGAME_API FPuzzleHintEngine
+{
+public:
+    using FOnHintReady = TFunction<void(const FPuzzleHint&)>;
+    using FSearchFunction = TFunction<FPuzzleHint(const FPuzzleBoardSnapshot&, const std::atomic<bool>&)>;
+
+    ~FPuzzleHintEngine();
+
+    // Önceki aramayı iptal edip yenisini başlatır - game thread, O(1)
+    // SearchFunction verilmezse FindBestHint kullanılır
+    void Start(FPuzzleBoardSnapshotRef&& Snapshot, FOnHintReady OnReady, FSearchFunction SearchFunction = nullptr);
+
+    // bWait: iptal edilenler dahil tüm aramaların snapshot pin'leri bırakılana kadar bekle (kapanış)
+    void Cancel(bool bWait = false);
+
+    bool IsRunning() const { return Search.IsValid() && !Search->bDelivered; }
+
+    // Saf arama - herhangi bir thread'de çalışır
+    static FPuzzleHint FindBestHint(const FPuzzleBoardSnapshot& Snapshot, const std::atomic<bool>& bCancelled);
+
+    // Sliding modu: boş hücre tek, optimal çözümün ilk hamlesi (MaxNodes 0: sınırsız)
+    static FPuzzleHint FindSlidingHint(const FPuzzleSlidingSolver& Solver, const FPuzzleBoardSnapshot& Snapshot,
+        const std::atomic<bool>& bCancelled, uint64 MaxNodes);
+
+    // Edge-matching modu: tüm kenarları eşleşen parçalar yerinde tutularak çözülür, çözümden sapan ilk hücre
+    static FPuzzleHint FindEdgeMatchingHint(const FPuzzleEdgeSolver& Solver, const FPuzzleBoardSnapshot& Snapshot,
+        const std::atomic<bool>& bCancelled, uint64 MaxNodes);
+
+    // Çözümü bilmeden: resim kenarı uyumuna göre en emin olunan "bu hücreye hangi parça" önerisi
+    // Adaylar dolu komşuların top-K listelerinden gelir; dolu hücre için mevcut parçadan iyi olmalı
+    static FPuzzleHint FindCompatibilityHint(const FPuzzleEdgeCompatibility& Compatibility, const FPuzzleBoardSnapshot& Snapshot,
+        const std::atomic<bool>& bCancelled);
+
+private:
+    struct FSearchState
+    {
+        std::atomic<bool> bCancelled{ false };
+        bool bDelivered = false;
+        FOnHintReady OnReady;
+    };
+
+    TSharedPtr<FSearchState, ESPMode::ThreadSafe> Search;
+
+    // Bitmemiş tüm aramalar - iptal edilenler de snapshot pin'i tutar
+    TArray<UE::Tasks::FTask> InFlightTasks;
+};
@@ -0,0 +1,313 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "PuzzleImageImport.h"
+#include "IImageWrapper.h"
+#include "IImageWrapperModule.h"
+#include "Misc/FileHelper.h"
+#include "HAL/FileManager.h"
+#include "Async/ParallelFor.h"
+
+namespace PuzzleImageImport
+{
+    static bool IsCancelled(const std::atomic<bool>* bCancelled)
+    {
+        return bCancelled && bCancelled->load(std::memory_order_relaxed);
+    }
+
+    static EParallelForFlags GetParallelFlags(bool bParallel)
+    {
+        return bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread;
+    }
+
+    // Hücre (Col, Row) alanını her yandan Margin hücre payıyla TileSize x TileSize'a bilinear örnekler - kaynak piksel merkezleri hizalı
+    // Resim dışına taşan pay kenar pikselini tekrarlar (sınır kenarları düz, görünmez)
+    static void SliceTile(const FColor* Pixels, int32 Width, int32 Height, int32 GridWidth, int32 GridHeight,
+        int32 PieceID, int32 TileSize, float Margin, FColor* OutPixels)
+    {
+        const int32 Col = PieceID % GridWidth;
+        const int32 Row = PieceID / GridWidth;
+        const float CellWidth = (float)Width / GridWidth;
+        const float CellHeight = (float)Height / GridHeight;
+        const float StepX = CellWidth * (1.0f + 2.0f * Margin) / TileSize;
+        const float StepY = CellHeight * (1.0f + 2.0f * Margin) / TileSize;
+        const float OriginX = (Col - Margin) * CellWidth;
+        const float OriginY = (Row - Margin) * CellHeight;
+
+        for (int32 Y = 0; Y < TileSize; Y++)
+        {
+            const float SourceY = FMath::Clamp(OriginY + (Y + 0.5f) * StepY - 0.5f, 0.0f, (float)(Height - 1));
+            const int32 Y0 = (int32)SourceY;
+            const int32 Y1 = FMath::Min(Y0 + 1, Height - 1);
+            const float FracY = SourceY - Y0;
+            const FColor* Row0 = Pixels + (int64)Y0 * Width;
+            const FColor* Row1 = Pixels + (int64)Y1 * Width;
+
+            for (int32 X = 0; X < TileSize; X++)
+            {
+                const float SourceX = FMath::Clamp(OriginX + (X + 0.5f) * StepX - 0.5f, 0.0f, (float)(Width - 1));
+                const int32 X0 = (int32)SourceX;
+                const int32 X1 = FMath::Min(X0 + 1, Width - 1);
+                const float FracX = SourceX - X0;
+
+                const float W00 = (1.0f - FracX) * (1.0f - FracY);
+                const float W10 = FracX * (1.0f - FracY);
+                const float W01 = (1.0f - FracX) * FracY;
+                const float W11 = FracX * FracY;
+                const FColor& C00 = Row0[X0];
+                const FColor& C10 = Row0[X1];
+                const FColor& C01 = Row1[X0];
+                const FColor& C11 = Row1[X1];
+
+                FColor& Out = OutPixels[Y * TileSize + X];
+                Out.B = (uint8)(C00.B * W00 + C10.B * W10 + C01.B * W01 + C11.B * W11 + 0.5f);
+                Out.G = (uint8)(C00.G * W00 + C10.G * W10 + C01.G * W01 + C11.G * W11 + 0.5f);
+                Out.R = (uint8)(C00.R * W00 + C10.R * W10 + C01.R * W01 + C11.R * W11 + 0.5f);
+                Out.A = (uint8)(C00.A * W00 + C10.A * W10 + C01.A * W01 + C11.A * W11 + 0.5f);
+            }
+        }
+    }
+}
+
+int64 FPuzzleImageMipChain::GetMipOffset(int32 Size, int32 Mip)
+{
+    int64 Offset = 0;
+    for (int32 Level = 0; Level < Mip; Level++)
+    {
+        const int64 LevelSize = FMath::Max(Size >> Level, 1);
+        Offset += LevelSize * LevelSize;
+    }
+    return Offset;
+}
+
+bool FPuzzleImageImport::ChooseDownscale(int64 FileBytes, int32 Width, int32 Height, const FPuzzleImageImportSettings& Settings,
+    int32& OutDownscale, int32& OutTileSize, int32& OutThumbnailSize, int64& OutPeakBytes)
+{
+    const int64 NumPieces = (int64)Settings.GridWidth * Settings.GridHeight;
+    const int64 DecodedBytes = (int64)Width * Height * sizeof(FColor);
+
+    // Dosya ve wrapper'ın sıkıştırılmış kopyası çözülmüş resimle aynı anda bellekte - küçültme bunu azaltmaz
+    const int64 DecodeBytes = FileBytes * 2 + DecodedBytes;
+    if (NumPieces <= 0 || DecodeBytes > Settings.MemoryBudgetBytes)
+    {
+        return false;
+    }
+
+    const int32 MaxTileSize = FMath::RoundDownToPowerOfTwo(FMath::Max(Settings.MaxTileSize, 1));
+    for (int32 Downscale = 1; Width / Downscale >= Settings.GridWidth && Height / Downscale >= Settings.GridHeight; Downscale *= 2)
+    {
+        const int32 ImageWidth = Width / Downscale;
+        const int32 ImageHeight = Height / Downscale;
+        const int32 CellSize = FMath::Min(ImageWidth / Settings.GridWidth, ImageHeight / Settings.GridHeight);
+        const int32 PaddedSize = FMath::FloorToInt32(CellSize * (1.0f + 2.0f * Settings.TileMargin));
+        const int32 TileSize = FMath::Min<int32>(MaxTileSize, FMath::RoundDownToPowerOfTwo(PaddedSize));
+        const int32 ThumbnailSize = FMath::Min<int32>(TileSize, FMath::RoundDownToPowerOfTwo(FMath::Max(Settings.ThumbnailSize, 1)));
+
+        // Katsayı 1'de de küçültme adımı kopyalar - çözülmüş resim ham tampon olarak kalır
+        const int64 ImageBytes = (int64)ImageWidth * ImageHeight * sizeof(FColor);
+        const int64 TileBytes = NumPieces * (FPuzzleImageMipChain::GetChainPixelCount(TileSize) +
+            FPuzzleImageMipChain::GetChainPixelCount(ThumbnailSize)) * sizeof(FColor);
+        const int64 PeakBytes = FMath::Max3(DecodeBytes, DecodedBytes + ImageBytes, ImageBytes + TileBytes);
+
+        if (PeakBytes <= Settings.MemoryBudgetBytes)
+        {
+            OutDownscale = Downscale;
+            OutTileSize = TileSize;
+            OutThumbnailSize = ThumbnailSize;
+            OutPeakBytes = PeakBytes;
+            return true;
+        }
+    }
+    return false;
+}
+
+void FPuzzleImageImport::Downscale(const FColor* Pixels, int32 Width, int32 Height, int32 Factor,
+    TArray<FColor>& OutPixels, int32& OutWidth, int32& OutHeight, bool bParallel)
+{
+    OutWidth = Width / Factor;
+    OutHeight = Height / Factor;
+    OutPixels.SetNumUninitialized(OutWidth * OutHeight);
+
+    if (Factor == 1)
+    {
+        FMemory::Memcpy(OutPixels.GetData(), Pixels, OutPixels.Num() * sizeof(FColor));
+        return;
+    }
+
+    const int32 Area = Factor * Factor;
+    ParallelFor(OutHeight, [&](int32 Y)
+    {
+        for (int32 X = 0; X < OutWidth; X++)
+        {
+            uint32 B = 0, G = 0, R = 0, A = 0;
+            for (int32 BlockY = 0; BlockY < Factor; BlockY++)
+            {
+                const FColor* Source = Pixels + (int64)(Y * Factor + BlockY) * Width + X * Factor;
+                for (int32 BlockX = 0; BlockX < Factor; BlockX++)
+                {
+                    B += Source[BlockX].B;
+                    G += Source[BlockX].G;
+                    R += Source[BlockX].R;
+                    A += Source[BlockX].A;
+                }
+            }
+            OutPixels[Y * OutWidth + X] = FColor((uint8)((R + Area / 2) / Area), (uint8)((G + Area / 2) / Area),
+                (uint8)((B + Area / 2) / Area), (uint8)((A + Area / 2) / Area));
+        }
+    }, PuzzleImageImport::GetParallelFlags(bParallel));
+}
+
+void FPuzzleImageImport::BuildMips(FPuzzleImageMipChain& Chain)
+{
+    for (int32 Mip = 1; Mip < Chain.GetNumMips(); Mip++)
+    {
+        const int32 SourceSize = Chain.GetMipSize(Mip - 1);
+        const int32 MipSize = Chain.GetMipSize(Mip);
+        const FColor* Source = Chain.GetMipData(Mip - 1);
+        FColor* Dest = Chain.Pixels.GetData() + FPuzzleImageMipChain::GetMipOffset(Chain.Size, Mip);
+
+        for (int32 Y = 0; Y < MipSize; Y++)
+        {
+            const FColor* Row0 = Source + (Y * 2) * SourceSize;
+            const FColor* Row1 = Row0 + SourceSize;
+            for (int32 X = 0; X < MipSize; X++)
+            {
+                const FColor& C00 = Row0[X * 2];
+                const FColor& C10 = Row0[X * 2 + 1];
+                const FColor& C01 = Row1[X * 2];
+                const FColor& C11 = Row1[X * 2 + 1];
+                Dest[Y * MipSize + X] = FColor(
+                    (uint8)((C00.R + C10.R + C01.R + C11.R + 2) >> 2),
+                    (uint8)((C00.G + C10.G + C01.G + C11.G + 2) >> 2),
+                    (uint8)((C00.B + C10.B + C01.B + C11.B + 2) >> 2),
+                    (uint8)((C00.A + C10.A + C01.A + C11.A + 2) >> 2));
+            }
+        }
+    }
+}
+
+bool FPuzzleImageImport::Import(const FString& FilePath, IImageWrapperModule& ImageWrapperModule,
+    const FPuzzleImageImportSettings& Settings, FPuzzleImageImportResult& OutResult, const std::atomic<bool>* bCancelled)
+{
+    using namespace PuzzleImageImport;
+
+    OutResult = FPuzzleImageImportResult();
+    FPuzzleImageImportStats& Stats = OutResult.Stats;
+    const int32 NumPieces = Settings.GridWidth * Settings.GridHeight;
+    if (NumPieces <= 0)
+    {
+        OutResult.Error = TEXT("Invalid grid size");
+        return false;
+    }
+
+    // Dosya okunmadan önce boyutu bütçeyle karşılaştırılır
+    Stats.FileBytes = IFileManager::Get().FileSize(*FilePath);
+    if (Stats.FileBytes <= 0)
+    {
+        OutResult.Error = FString::Printf(TEXT("Cannot read %s"), *FilePath);
+        return false;
+    }
+    if (Stats.FileBytes * 2 > Settings.MemoryBudgetBytes)
+    {
+        OutResult.Error = FString::Printf(TEXT("File is %.1f MB, over the import budget"), Stats.FileBytes / (1024.0 * 1024.0));
+        return false;
+    }
+
+    double StartTime = FPlatformTime::Seconds();
+    TArray64<uint8> FileData;
+    if (!FFileHelper::LoadFileToArray(FileData, *FilePath))
+    {
+        OutResult.Error = FString::Printf(TEXT("Cannot read %s"), *FilePath);
+        return false;
+    }
+    Stats.ReadSeconds = FPlatformTime::Seconds() - StartTime;
+
+    const EImageFormat Format = ImageWrapperModule.DetectImageFormat(FileData.GetData(), FileData.Num());
+    if (Format != EImageFormat::PNG && Format != EImageFormat::JPEG)
+    {
+        OutResult.Error = TEXT("Only PNG and JPEG images are supported");
+        return false;
+    }
+
+    StartTime = FPlatformTime::Seconds();
+    TSharedPtr<IImageWrapper> ImageWrapper = ImageWrapperModule.CreateImageWrapper(Format);
+    if (!ImageWrapper.IsValid() || !ImageWrapper->SetCompressed(FileData.GetData(), FileData.Num()))
+    {
+        OutResult.Error = TEXT("Image header could not be parsed");
+        return false;
+    }
+
+    // Başlık çözülen boyutu verir - sıkıştırma açılmadan bütçe kontrol edilir
+    const int64 WrapperWidth = ImageWrapper->GetWidth();
+    const int64 WrapperHeight = ImageWrapper->GetHeight();
+    if (WrapperWidth <= 0 || WrapperHeight <= 0 || WrapperWidth > MAX_int32 / 4 || WrapperHeight > MAX_int32 / 4)
+    {
+        OutResult.Error = TEXT("Invalid image dimensions");
+        return false;
+    }
+    Stats.DecodedWidth = (int32)WrapperWidth;
+    Stats.DecodedHeight = (int32)WrapperHeight;
+
+    int32 TileSize = 0;
+    int32 ThumbnailSize = 0;
+    if (!ChooseDownscale(Stats.FileBytes, Stats.DecodedWidth, Stats.DecodedHeight, Settings,
+        Stats.Downscale, TileSize, ThumbnailSize, Stats.PeakBytes))
+    {
+        OutResult.Error = FString::Printf(TEXT("%dx%d image does not fit the import budget for a %dx%d grid"),
+            Stats.DecodedWidth, Stats.DecodedHeight, Settings.GridWidth, Settings.GridHeight);
+        return false;
+    }
+
+    TArray64<uint8> RawData;
+    if (!ImageWrapper->GetRaw(ERGBFormat::BGRA, 8, RawData) || RawData.Num() != WrapperWidth * WrapperHeight * (int64)sizeof(FColor))
+    {
+        OutResult.Error = TEXT("Image could not be decoded");
+        return false;
+    }
+    ImageWrapper.Reset();
+    FileData.Empty();
+    Stats.DecodeSeconds = FPlatformTime::Seconds() - StartTime;
+
+    if (IsCancelled(bCancelled))
+    {
+        return false;
+    }
+
+    // BGRA8 bayt düzeni FColor ile aynı
+    StartTime = FPlatformTime::Seconds();
+    Downscale((const FColor*)RawData.GetData(), Stats.DecodedWidth, Stats.DecodedHeight, Stats.Downscale,
+        OutResult.ImagePixels, OutResult.ImageWidth, OutResult.ImageHeight, Settings.bParallel);
+    RawData.Empty();
+    Stats.DownscaleSeconds = FPlatformTime::Seconds() - StartTime;
+
+    if (IsCancelled(bCancelled))
+    {
+        return false;
+    }
+
+    StartTime = FPlatformTime::Seconds();
+    OutResult.Tiles.SetNum(NumPieces);
+    OutResult.Thumbnails.SetNum(NumPieces);
+    const int32 ThumbnailMip = FMath::FloorLog2(TileSize) - FMath::FloorLog2(ThumbnailSize);
+    ParallelFor(NumPieces, [&](int32 PieceID)
+    {
+        if (IsCancelled(bCancelled))
+        {
+            return;
+        }
+
+        FPuzzleImageMipChain& Tile = OutResult.Tiles[PieceID];
+        Tile.Size = TileSize;
+        Tile.Pixels.SetNumUninitialized(FPuzzleImageMipChain::GetChainPixelCount(TileSize));
+        SliceTile(OutResult.ImagePixels.GetData(), OutResult.ImageWidth, OutResult.ImageHeight,
+            Settings.GridWidth, Settings.GridHeight, PieceID, TileSize, Settings.TileMargin, Tile.Pixels.GetData());
+        BuildMips(Tile);
+
+        // Küçük resim zincirin kuyruğu - ayrı texture olarak yüklenir, tepsi büyük mip'leri tutmaz
+        FPuzzleImageMipChain& Thumbnail = OutResult.Thumbnails[PieceID];
+        Thumbnail.Size = ThumbnailSize;
+        Thumbnail.Pixels.Append(Tile.GetMipData(ThumbnailMip), FPuzzleImageMipChain::GetChainPixelCount(ThumbnailSize));
+    }, GetParallelFlags(Settings.bParallel));
+    Stats.SliceSeconds = FPlatformTime::Seconds() - StartTime;
+
+    return !IsCancelled(bCancelled);
+}
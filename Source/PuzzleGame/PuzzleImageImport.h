@@ -0,0 +1,107 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+class IImageWrapperModule;
+
+struct FPuzzleImageImportSettings
+{
+    int32 GridWidth = 0;
+    int32 GridHeight = 0;
+
+    // Parça texture'ı kenarı - 2'nin kuvvetine yuvarlanır, hücre bundan küçükse hücreye iner
+    int32 MaxTileSize = 512;
+
+    // Tepsi küçük resminin mip 0 kenarı
+    int32 ThumbnailSize = 64;
+
+    // Dilim her yandan hücre kenarının bu oranı kadar geniş kesilir - çıkıntılı parçalar komşu pikselleri örnekler
+    // Küçük resim dilimin mip'i olduğu için payı da içerir
+    float TileMargin = 0.0f;
+
+    // Pipeline'ın herhangi bir anda tuttuğu CPU belleği üst sınırı
+    int64 MemoryBudgetBytes = 256ll * 1024 * 1024;
+
+    // Kapalıysa dilimleme tek thread'de - benchmark karşılaştırması için
+    bool bParallel = true;
+};
+
+// Kare, 2'nin kuvveti kenarlı BGRA8 texture - tüm mip'ler mip 0'dan başlayarak ardışık, PF_B8G8R8A8 düzeninde
+struct FPuzzleImageMipChain
+{
+    int32 Size = 0;
+    TArray<FColor> Pixels;
+
+    int32 GetNumMips() const { return Size > 0 ? FMath::FloorLog2(Size) + 1 : 0; }
+    int32 GetMipSize(int32 Mip) const { return FMath::Max(Size >> Mip, 1); }
+    const FColor* GetMipData(int32 Mip) const { return Pixels.GetData() + GetMipOffset(Size, Mip); }
+
+    static int64 GetMipOffset(int32 Size, int32 Mip);
+    static int64 GetChainPixelCount(int32 Size) { return GetMipOffset(Size, FMath::FloorLog2(Size) + 1); }
+};
+
+struct FPuzzleImageImportStats
+{
+    int64 FileBytes = 0;
+    int32 DecodedWidth = 0;
+    int32 DecodedHeight = 0;
+    int32 Downscale = 1;
+
+    // Aşamaların tahmini en yüksek CPU belleği
+    int64 PeakBytes = 0;
+
+    double ReadSeconds = 0.0;
+    double DecodeSeconds = 0.0;
+    double DownscaleSeconds = 0.0;
+    double SliceSeconds = 0.0;
+};
+
+struct FPuzzleImageImportResult
+{
+    // Bütçeye göre küçültülmüş tam resim, satır satır - board kaynağı ve kenar uyumu için
+    int32 ImageWidth = 0;
+    int32 ImageHeight = 0;
+    TArray<FColor> ImagePixels;
+
+    // PieceID = Row * GridWidth + Col sırasıyla
+    TArray<FPuzzleImageMipChain> Tiles;
+    TArray<FPuzzleImageMipChain> Thumbnails;
+
+    FPuzzleImageImportStats Stats;
+    FString Error;
+};
+
+/**
+ * Runtime puzzle image import: reads a PNG or JPEG, decodes it to BGRA8 and cuts it into
+ * GridWidth x GridHeight square tiles with full mip chains plus small tray thumbnails, laid
+ * out exactly as PF_B8G8R8A8 mip data so the game thread only copies them into textures.
+ *
+ * The pipeline's peak memory is max(file + compressed copy + decoded image, decoded + downscaled
+ * image, downscaled image + all tiles and thumbnails). Before decompressing, the image is
+ * box-downscaled by the smallest power of two that keeps this estimate inside the budget;
+ * the import fails if even the decoded image alone does not fit. Touches no UObjects and is
+ * meant to run on a worker thread; tiles are sliced and mipped with ParallelFor.
+ */
+class PUZZLEGAME_API FPuzzleImageImport
+{
+public:
+    // ImageWrapperModule game thread'de yüklenmiş olmalı
+    // İptal edilirse veya başarısız olursa false, OutResult.Error nedeni tutar
+    static bool Import(const FString& FilePath, IImageWrapperModule& ImageWrapperModule,
+        const FPuzzleImageImportSettings& Settings, FPuzzleImageImportResult& OutResult,
+        const std::atomic<bool>* bCancelled = nullptr);
+
+    // Küçültme katsayısı ve tahmini tepe bellek - bütçeye hiç sığmıyorsa false
+    static bool ChooseDownscale(int64 FileBytes, int32 Width, int32 Height, const FPuzzleImageImportSettings& Settings,
+        int32& OutDownscale, int32& OutTileSize, int32& OutThumbnailSize, int64& OutPeakBytes);
+
+    // Factor x Factor bloklarının ortalaması - kenardaki artık pikseller atılır
+    static void Downscale(const FColor* Pixels, int32 Width, int32 Height, int32 Factor,
+        TArray<FColor>& OutPixels, int32& OutWidth, int32& OutHeight, bool bParallel = true);
+
+    // Mip 0 dolu zincirin geri kalanını 2x2 ortalamayla doldurur
+    static void BuildMips(FPuzzleImageMipChain& Chain);
+};
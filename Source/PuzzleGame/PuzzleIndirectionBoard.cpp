@@ -0,0 +1,94 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "PuzzleIndirectionBoard.h"
+#include "Engine/StaticMesh.h"
+#include "UObject/ConstructorHelpers.h"
+
+APuzzleIndirectionBoard::APuzzleIndirectionBoard()
+{
+    PrimaryActorTick.bCanEverTick = false;
+
+    BoardQuad = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("BoardQuad"));
+    RootComponent = BoardQuad;
+
+    // Board sadece görsel - picking parça collision'larıyla yapılır
+    BoardQuad->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    BoardQuad->SetCastShadow(false);
+    BoardQuad->SetReceivesDecals(false);
+
+    static ConstructorHelpers::FObjectFinder<UStaticMesh> PlaneMeshFinder(TEXT("/Engine/BasicShapes/Plane"));
+    if (PlaneMeshFinder.Succeeded())
+    {
+        BoardQuad->SetStaticMesh(PlaneMeshFinder.Object);
+    }
+
+    BoardMaterialInstance = nullptr;
+    Width = 0;
+}
+
+bool APuzzleIndirectionBoard::InitializeBoard(int32 InWidth, int32 InHeight, const FVector2D& CellAreaMin, const FVector2D& CellAreaMax,
+    UMaterialInterface* BoardMaterial, UTexture* SourceImage)
+{
+    ClearBoard();
+
+    // 16 bit sütun/satır, 0xFFFF boş hücre için ayrılmış
+    if (!BoardMaterial || InWidth >= FPuzzleIndirectionTexel::Empty || InHeight >= FPuzzleIndirectionTexel::Empty)
+    {
+        return false;
+    }
+
+    const FPuzzleIndirectionTexel EmptyTexel = { FPuzzleIndirectionTexel::Empty, FPuzzleIndirectionTexel::Empty };
+    if (!CellTexture.Initialize(InWidth, InHeight, PF_G16R16, EmptyTexel))
+    {
+        return false;
+    }
+    Width = InWidth;
+
+    BoardMaterialInstance = UMaterialInstanceDynamic::Create(BoardMaterial, this);
+    BoardMaterialInstance->SetTextureParameterValue(TEXT("CellTexture"), CellTexture.GetTexture());
+    if (SourceImage)
+    {
+        BoardMaterialInstance->SetTextureParameterValue(TEXT("SourceImage"), SourceImage);
+    }
+    BoardMaterialInstance->SetVectorParameterValue(TEXT("BoardSize"), FLinearColor(InWidth, InHeight, 0.0f, 0.0f));
+    BoardQuad->SetMaterial(0, BoardMaterialInstance);
+
+    // Engine plane 100x100 birim, parçaların hemen altında dur
+    const FVector2D Center = (CellAreaMin + CellAreaMax) * 0.5f;
+    const FVector2D Size = CellAreaMax - CellAreaMin;
+    SetActorLocation(FVector(Center.X, Center.Y, -5.0f));
+    SetActorScale3D(FVector(Size.X / 100.0f, Size.Y / 100.0f, 1.0f));
+    BoardQuad->SetVisibility(true);
+
+    CellTexture.Flush();
+    return true;
+}
+
+void APuzzleIndirectionBoard::ClearBoard()
+{
+    CellTexture.Reset();
+    BoardMaterialInstance = nullptr;
+    Width = 0;
+    BoardQuad->SetVisibility(false);
+}
+
+void APuzzleIndirectionBoard::SetCell(int32 GridID, int32 PieceID)
+{
+    if (Width <= 0)
+    {
+        return;
+    }
+
+    FPuzzleIndirectionTexel Texel = { FPuzzleIndirectionTexel::Empty, FPuzzleIndirectionTexel::Empty };
+    if (PieceID >= 0)
+    {
+        Texel.SourceCol = (uint16)(PieceID % Width);
+        Texel.SourceRow = (uint16)(PieceID / Width);
+    }
+    CellTexture.SetTexel(GridID, Texel);
+}
+
+int32 APuzzleIndirectionBoard::FlushCells()
+{
+    return CellTexture.Flush();
+}
@@ -0,0 +1,61 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "Components/StaticMeshComponent.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "PuzzleCellTexture.h"
+#include "PuzzleIndirectionBoard.generated.h"
+
+// Hücredeki parçanın çözülmüş resimdeki sütun/satırı (PF_G16R16: R=sütun, G=satır)
+struct FPuzzleIndirectionTexel
+{
+    uint16 SourceCol;
+    uint16 SourceRow;
+
+    // Boş hücre
+    static constexpr uint16 Empty = 0xFFFF;
+};
+
+/**
+ * Alternate renderer for pure-grid boards: one quad for the whole board. Its material
+ * reads the cell -> source cell indirection texture and samples the puzzle image there,
+ * so draw cost does not depend on board size and a swap rewrites two texels.
+ *
+ * Material parameters: CellTexture (indirection), SourceImage, BoardSize (width, height).
+ */
+UCLASS()
+class PUZZLEGAME_API APuzzleIndirectionBoard : public AActor
+{
+    GENERATED_BODY()
+
+public:
+    APuzzleIndirectionBoard();
+
+    bool InitializeBoard(int32 InWidth, int32 InHeight, const FVector2D& CellAreaMin, const FVector2D& CellAreaMax,
+        UMaterialInterface* BoardMaterial, UTexture* SourceImage);
+
+    void ClearBoard();
+
+    // Sadece CPU kopyasını günceller, FlushCells ile toplu gönderilir
+    void SetCell(int32 GridID, int32 PieceID);
+
+    // Bekleyen texel'leri tek bölge güncellemesiyle gönder
+    int32 FlushCells();
+
+    bool IsInitialized() const { return CellTexture.IsValid(); }
+
+protected:
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+    UStaticMeshComponent* BoardQuad;
+
+    UPROPERTY()
+    UMaterialInstanceDynamic* BoardMaterialInstance;
+
+private:
+    int32 Width;
+
+    TPuzzleCellTexture<FPuzzleIndirectionTexel> CellTexture;
+};
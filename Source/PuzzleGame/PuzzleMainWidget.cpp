@@ -124,38 +124,66 @@ void UPuzzleMainWidget::PopulatePieceList()
     // Simple approach: Clear all and recreate
     PieceListBox->ClearChildren();
     
-    // Create widget for each available piece
-    for (int32 PieceID : AvailablePieces)
+    // Widget'lar frame bütçesine bölünerek oluşturulur - önceki yarım kalan tray işini iptal et
+    FPuzzleWorkScheduler& Scheduler = CachedGameMode->GetWorkScheduler();
+    Scheduler.CancelByName(TEXT("PieceTray"));
+    
+    TWeakObjectPtr<UPuzzleMainWidget> WeakThis(this);
+    TSharedRef<int32> NextIndex = MakeShared<int32>(0);
+    Scheduler.Enqueue(TEXT("PieceTray"), EPuzzleWorkPriority::Normal,
+        [WeakThis, NextIndex, Pieces = MoveTemp(AvailablePieces)]()
     {
+        UPuzzleMainWidget* Widget = WeakThis.Get();
+        if (!Widget || !Widget->PieceListBox || !Widget->CachedGameMode)
+        {
+            return true;
+        }
+        
         // Try to get a valid player controller
-        APlayerController* PC = GetOwningPlayer();
+        APlayerController* PC = Widget->GetOwningPlayer();
         if (!PC)
         {
-            PC = GetWorld()->GetFirstPlayerController();
+            PC = Widget->GetWorld()->GetFirstPlayerController();
         }
         
         if (!PC)
         {
-            continue;
+            return true;
         }
         
-        UUserWidget* NewWidget = CreateWidget<UUserWidget>(PC, PuzzlePieceWidgetClass);
-        UPuzzlePieceWidget* PieceWidget = Cast<UPuzzlePieceWidget>(NewWidget);
+        const int32 EndIndex = FMath::Min(*NextIndex + FMath::Max(Widget->PieceWidgetsPerStep, 1), Pieces.Num());
+        for (int32 i = *NextIndex; i < EndIndex; i++)
+        {
+            Widget->AddPieceWidget(PC, Pieces[i]);
+        }
+        *NextIndex = EndIndex;
+        return EndIndex >= Pieces.Num();
+    });
+}
+
+void UPuzzleMainWidget::AddPieceWidget(APlayerController* PC, int32 PieceID)
+{
+    UUserWidget* NewWidget = CreateWidget<UUserWidget>(PC, PuzzlePieceWidgetClass);
+    UPuzzlePieceWidget* PieceWidget = Cast<UPuzzlePieceWidget>(NewWidget);
+    
+    if (PieceWidget)
+    {
+        PieceWidget->SetPieceID(PieceID);
+        PieceWidget->OnPieceClicked.AddDynamic(this, &UPuzzleMainWidget::OnPieceClicked);
         
-        if (PieceWidget)
+        // Set material if GameMode has materials configured
+        const TArray<UMaterialInterface*>& Materials = CachedGameMode->GetPieceMaterials();
+        if (Materials.IsValidIndex(PieceID))
         {
-            PieceWidget->SetPieceID(PieceID);
-            PieceWidget->OnPieceClicked.AddDynamic(this, &UPuzzleMainWidget::OnPieceClicked);
-            
-            // Set material if GameMode has materials configured
-            const TArray<UMaterialInterface*>& Materials = CachedGameMode->GetPieceMaterials();
-            if (Materials.IsValidIndex(PieceID))
-            {
-                PieceWidget->SetPieceMaterial(Materials[PieceID]);
-            }
-            
-            PieceListBox->AddChild(PieceWidget);
+            PieceWidget->SetPieceMaterial(Materials[PieceID]);
         }
+
+        if (UTexture2D* Thumbnail = CachedGameMode->GetPieceThumbnail(PieceID))
+        {
+            PieceWidget->SetPieceThumbnail(Thumbnail);
+        }
+        
+        PieceListBox->AddChild(PieceWidget);
     }
 }
 
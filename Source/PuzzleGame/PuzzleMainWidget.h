@@ -65,10 +65,17 @@ protected:
     UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "UI")
     TSubclassOf<UUserWidget> GameCompleteWidgetClass;
     
+    // Tray yeniden kurulurken work scheduler adımı başına oluşturulan widget sayısı
+    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "UI")
+    int32 PieceWidgetsPerStep = 16;
+    
 private:
     UFUNCTION()
     void OnPieceClicked(int32 PieceID);
     
+    // Tek bir tray widget'ı oluşturur
+    void AddPieceWidget(APlayerController* PC, int32 PieceID);
+    
     UPROPERTY()
     APuzzleGameMode* CachedGameMode;
     
@@ -0,0 +1,513 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "PuzzlePatternDatabase.h"
+#include "PuzzleGame.h"
+#include "Async/MappedFileHandle.h"
+#include "Async/ParallelFor.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+
+namespace PuzzlePatterns
+{
+    // Tablolar sayfa sınırında başlar - map edilen bölge doğrudan kullanılır
+    constexpr int64 TableAlignment = 4096;
+
+    // BFS katmanında worker başına ardışık rank bloğu
+    constexpr int64 RanksPerBlock = 16 * 1024;
+
+    constexpr uint8 Unreached = 0xFF;
+    constexpr int32 MaxDepth = 254;
+
+    // Boşluğun sıfır maliyetle dolaşabildiği bölge: pattern dışı hücrelerde taşma
+    uint32 FloodRegion(uint32 Seed, uint32 Free, int32 Width, uint32 NotFirstCol, uint32 NotLastCol)
+    {
+        uint32 Region = Seed;
+        for (;;)
+        {
+            const uint32 Grown = (Region | ((Region << 1) & NotFirstCol) | ((Region >> 1) & NotLastCol) |
+                (Region << Width) | (Region >> Width)) & Free;
+            if (Grown == Region)
+            {
+                return Region;
+            }
+            Region = Grown;
+        }
+    }
+
+    void UnrankPlacement(int64 Rank, int32 NumTiles, const int64* Factors, uint8* OutCells)
+    {
+        uint32 Used = 0;
+        for (int32 Slot = 0; Slot < NumTiles; Slot++)
+        {
+            int32 Digit = (int32)(Rank / Factors[Slot]);
+            Rank %= Factors[Slot];
+
+            // Digit'inci kullanılmamış hücre
+            int32 Cell = 0;
+            for (;; Cell++)
+            {
+                if (!(Used & (1u << Cell)) && Digit-- == 0)
+                {
+                    break;
+                }
+            }
+            OutCells[Slot] = (uint8)Cell;
+            Used |= 1u << Cell;
+        }
+    }
+}
+
+FPuzzlePatternDatabase::~FPuzzlePatternDatabase()
+{
+    // Bölge handle'dan önce kapanmalı
+    MappedRegion.Reset();
+    MappedFile.Reset();
+}
+
+FString FPuzzlePatternDatabase::GetDefaultPath(int32 Width, int32 Height)
+{
+    // Pak içinden map edilemez - DefaultGame.ini Content/PatternDatabases'ı non-UFS olarak paketler
+    return FPaths::ProjectContentDir() / TEXT("PatternDatabases") / FString::Printf(TEXT("Sliding%dx%d.ppdb"), Width, Height);
+}
+
+void FPuzzlePatternDatabase::GetDefaultPartition(int32 Width, int32 Height, int32 BlankTile, TArray<TArray<int32>>& OutPatterns)
+{
+    OutPatterns.Reset();
+
+    // Hedef hücre blokları - boşluk taşı bulunduğu gruptan çıkarılır
+    if (Width == 4 && Height == 4)
+    {
+        OutPatterns = { { 0, 1, 4, 5, 8, 12 }, { 2, 3, 6, 7, 10, 11 }, { 9, 13, 14, 15 } };
+    }
+    else if (Width == 5 && Height == 5)
+    {
+        OutPatterns = { { 0, 1, 2, 5, 6, 7 }, { 3, 4, 8, 9, 13, 14 }, { 10, 11, 15, 16, 20, 21 }, { 12, 17, 18, 19, 22, 23, 24 } };
+    }
+
+    bool bFits = OutPatterns.Num() > 0;
+    for (TArray<int32>& Pattern : OutPatterns)
+    {
+        Pattern.Remove(BlankTile);
+        bFits &= Pattern.Num() <= MaxPatternTiles;
+    }
+    if (bFits)
+    {
+        return;
+    }
+
+    // Diğer boyutlar: satır sırasıyla gruplar, sığmayan taşlar heuristic'e girmez
+    OutPatterns.Reset();
+    for (int32 Tile = 0; Tile < Width * Height; Tile++)
+    {
+        if (Tile == BlankTile)
+        {
+            continue;
+        }
+        if (OutPatterns.Num() == 0 || OutPatterns.Last().Num() == MaxPatternTiles)
+        {
+            if (OutPatterns.Num() == MaxPatterns)
+            {
+                break;
+            }
+            OutPatterns.AddDefaulted();
+        }
+        OutPatterns.Last().Add(Tile);
+    }
+}
+
+void FPuzzlePatternDatabase::ComputeFactors(int32 NumCells, int32 NumTiles, int64* OutFactors, int64& OutTableSize)
+{
+    for (int32 Slot = 0; Slot < NumTiles; Slot++)
+    {
+        int64 Factor = 1;
+        for (int32 Next = Slot + 1; Next < NumTiles; Next++)
+        {
+            Factor *= NumCells - Next;
+        }
+        OutFactors[Slot] = Factor;
+    }
+    OutTableSize = NumTiles > 0 ? NumCells * OutFactors[0] : 0;
+}
+
+int64 FPuzzlePatternDatabase::RankPlacement(const uint8* Cells, int32 NumTiles, const int64* Factors)
+{
+    int64 Rank = 0;
+    uint32 Used = 0;
+    for (int32 Slot = 0; Slot < NumTiles; Slot++)
+    {
+        const uint32 Cell = Cells[Slot];
+        const int32 Digit = (int32)Cell - (int32)FMath::CountBits(Used & ((1u << Cell) - 1));
+        Rank += Digit * Factors[Slot];
+        Used |= 1u << Cell;
+    }
+    return Rank;
+}
+
+uint8 FPuzzlePatternDatabase::Lookup(int32 PatternIndex, const uint8* TilePositions) const
+{
+    const FPattern& Pattern = Patterns[PatternIndex];
+    uint8 Cells[MaxPatternTiles];
+    for (int32 Slot = 0; Slot < Pattern.NumTiles; Slot++)
+    {
+        Cells[Slot] = TilePositions[Pattern.Tiles[Slot]];
+    }
+    return Pattern.Table[RankPlacement(Cells, Pattern.NumTiles, Pattern.Factors)];
+}
+
+bool FPuzzlePatternDatabase::IsCompatible(int32 InWidth, int32 InHeight, int32 InBlankTile) const
+{
+    return Width == InWidth && Height == InHeight && BlankTile == InBlankTile;
+}
+
+bool FPuzzlePatternDatabase::BuildTable(int32 Width, int32 Height, int32 BlankTile, TArrayView<const int32> PatternTiles, TArray<uint8>& OutTable)
+{
+    const int32 NumCells = Width * Height;
+    const int32 NumTiles = PatternTiles.Num();
+    if (NumCells > 32 || NumTiles <= 0 || NumTiles > MaxPatternTiles || BlankTile < 0 || BlankTile >= NumCells)
+    {
+        return false;
+    }
+
+    uint8 GoalCells[MaxPatternTiles];
+    uint32 GoalOccupied = 0;
+    for (int32 Slot = 0; Slot < NumTiles; Slot++)
+    {
+        const int32 Tile = PatternTiles[Slot];
+        if (Tile < 0 || Tile >= NumCells || Tile == BlankTile || (GoalOccupied & (1u << Tile)))
+        {
+            return false;
+        }
+        GoalCells[Slot] = (uint8)Tile;
+        GoalOccupied |= 1u << Tile;
+    }
+
+    int64 Factors[MaxPatternTiles];
+    int64 TableSize = 0;
+    ComputeFactors(NumCells, NumTiles, Factors, TableSize);
+    if (TableSize > MAX_int32)
+    {
+        return false;
+    }
+
+    const uint32 AllCells = NumCells == 32 ? ~0u : (1u << NumCells) - 1;
+    uint32 NotFirstCol = 0;
+    uint32 NotLastCol = 0;
+    for (int32 Cell = 0; Cell < NumCells; Cell++)
+    {
+        NotFirstCol |= (Cell % Width != 0 ? 1u : 0u) << Cell;
+        NotLastCol |= (Cell % Width != Width - 1 ? 1u : 0u) << Cell;
+    }
+
+    // Rank başına boşluğun bulunabildiği hücre maskeleri: görülmüş, bu katman, sonraki katman
+    TArray<uint32> Visited;
+    TArray<uint32> Current;
+    TArray<uint32> Next;
+    Visited.SetNumZeroed((int32)TableSize);
+    Current.SetNumZeroed((int32)TableSize);
+    Next.SetNumZeroed((int32)TableSize);
+    OutTable.Init(PuzzlePatterns::Unreached, (int32)TableSize);
+
+    const int64 RootRank = RankPlacement(GoalCells, NumTiles, Factors);
+    const uint32 RootRegion = PuzzlePatterns::FloodRegion(1u << BlankTile, AllCells & ~GoalOccupied, Width, NotFirstCol, NotLastCol);
+    Visited[RootRank] = RootRegion;
+    Current[RootRank] = RootRegion;
+    OutTable[RootRank] = 0;
+
+    const int32 NumBlocks = (int32)FMath::DivideAndRoundUp(TableSize, PuzzlePatterns::RanksPerBlock);
+    int64 TotalStates = 1;
+
+    for (int32 Depth = 0; Depth < PuzzlePatterns::MaxDepth; Depth++)
+    {
+        std::atomic<int64> LayerStates{ 0 };
+
+        ParallelFor(NumBlocks, [&](int32 Block)
+        {
+            const int64 FirstRank = Block * PuzzlePatterns::RanksPerBlock;
+            const int64 LastRank = FMath::Min(FirstRank + PuzzlePatterns::RanksPerBlock, TableSize);
+            int64 LocalStates = 0;
+
+            for (int64 Rank = FirstRank; Rank < LastRank; Rank++)
+            {
+                uint32 Pending = Current[Rank];
+                if (Pending == 0)
+                {
+                    continue;
+                }
+
+                uint8 Cells[MaxPatternTiles];
+                PuzzlePatterns::UnrankPlacement(Rank, NumTiles, Factors, Cells);
+
+                int8 CellSlots[32];
+                uint32 Occupied = 0;
+                for (int32 Slot = 0; Slot < NumTiles; Slot++)
+                {
+                    Occupied |= 1u << Cells[Slot];
+                    CellSlots[Cells[Slot]] = (int8)Slot;
+                }
+                const uint32 Free = AllCells & ~Occupied;
+
+                while (Pending != 0)
+                {
+                    const uint32 Region = PuzzlePatterns::FloodRegion(1u << FMath::CountTrailingZeros(Pending), Free, Width, NotFirstCol, NotLastCol);
+                    Pending &= ~Region;
+
+                    // Bölgedeki boşluk komşu pattern taşını kendine çeker - tek maliyetli hamle
+                    for (uint32 Remaining = Region; Remaining != 0; Remaining &= Remaining - 1)
+                    {
+                        const int32 BlankCell = (int32)FMath::CountTrailingZeros(Remaining);
+                        const int32 Col = BlankCell % Width;
+                        const int32 Row = BlankCell / Width;
+                        const int32 Candidates[] = {
+                            Row > 0 ? BlankCell - Width : -1,
+                            Col > 0 ? BlankCell - 1 : -1,
+                            Col < Width - 1 ? BlankCell + 1 : -1,
+                            Row < Height - 1 ? BlankCell + Width : -1 };
+
+                        for (const int32 TileCell : Candidates)
+                        {
+                            if (TileCell < 0 || !(Occupied & (1u << TileCell)))
+                            {
+                                continue;
+                            }
+
+                            const int32 Slot = CellSlots[TileCell];
+                            Cells[Slot] = (uint8)BlankCell;
+                            const int64 NewRank = RankPlacement(Cells, NumTiles, Factors);
+                            Cells[Slot] = (uint8)TileCell;
+
+                            const uint32 NewFree = Free ^ (1u << BlankCell) ^ (1u << TileCell);
+                            const uint32 NewRegion = PuzzlePatterns::FloodRegion(1u << TileCell, NewFree, Width, NotFirstCol, NotLastCol);
+
+                            // Bölgeler tek atomik OR ile işaretlenir - bit görülmüşse bölgenin tamamı görülmüş
+                            const uint32 Previous = (uint32)FPlatformAtomics::InterlockedOr((volatile int32*)&Visited[NewRank], (int32)NewRegion);
+                            if (Previous & (1u << TileCell))
+                            {
+                                continue;
+                            }
+
+                            FPlatformAtomics::InterlockedOr((volatile int32*)&Next[NewRank], (int32)NewRegion);
+                            FPlatformAtomics::InterlockedCompareExchange((volatile int8*)&OutTable[NewRank], (int8)(Depth + 1), (int8)PuzzlePatterns::Unreached);
+                            LocalStates++;
+                        }
+                    }
+                }
+            }
+
+            LayerStates.fetch_add(LocalStates, std::memory_order_relaxed);
+        });
+
+        const int64 NewStates = LayerStates.load();
+        if (NewStates == 0)
+        {
+            break;
+        }
+
+        TotalStates += NewStates;
+        UE_LOG(LogPuzzleGame, Verbose, TEXT("Pattern BFS depth %d: %lld new regions"), Depth + 1, NewStates);
+
+        Swap(Current, Next);
+        FMemory::Memzero(Next.GetData(), Next.Num() * sizeof(uint32));
+    }
+
+    UE_LOG(LogPuzzleGame, Display, TEXT("Pattern of %d tiles: %lld placements, %lld blank regions expanded"),
+        NumTiles, TableSize, TotalStates);
+    return true;
+}
+
+bool FPuzzlePatternDatabase::BuildToFile(int32 Width, int32 Height, int32 BlankTile, const TArray<TArray<int32>>& InPatterns, const FString& FilePath)
+{
+    if (InPatterns.Num() == 0 || InPatterns.Num() > MaxPatterns)
+    {
+        return false;
+    }
+
+    FPuzzlePatternDatabaseHeader Header;
+    FMemory::Memzero(Header);
+    Header.Version = FileVersion;
+    Header.Width = Width;
+    Header.Height = Height;
+    Header.BlankTile = BlankTile;
+    Header.NumPatterns = InPatterns.Num();
+
+    int64 Offset = Align((int64)sizeof(FPuzzlePatternDatabaseHeader), PuzzlePatterns::TableAlignment);
+    for (int32 PatternIndex = 0; PatternIndex < InPatterns.Num(); PatternIndex++)
+    {
+        const TArray<int32>& Tiles = InPatterns[PatternIndex];
+        if (Tiles.Num() == 0 || Tiles.Num() > MaxPatternTiles)
+        {
+            return false;
+        }
+
+        Header.PatternSizes[PatternIndex] = Tiles.Num();
+        for (int32 Slot = 0; Slot < Tiles.Num(); Slot++)
+        {
+            Header.PatternTiles[PatternIndex][Slot] = (uint8)Tiles[Slot];
+        }
+
+        int64 Factors[MaxPatternTiles];
+        ComputeFactors(Width * Height, Tiles.Num(), Factors, Header.TableSizes[PatternIndex]);
+        Header.TableOffsets[PatternIndex] = Offset;
+        Offset = Align(Offset + Header.TableSizes[PatternIndex], PuzzlePatterns::TableAlignment);
+    }
+
+    TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*FilePath));
+    if (!Writer)
+    {
+        UE_LOG(LogPuzzleGame, Error, TEXT("Could not open %s for writing"), *FilePath);
+        return false;
+    }
+
+    // Magic en son yazılır - yarıda kalan dosya yüklenmez
+    Writer->Serialize(&Header, sizeof(Header));
+
+    TArray<uint8> Padding;
+    for (int32 PatternIndex = 0; PatternIndex < InPatterns.Num(); PatternIndex++)
+    {
+        const double StartTime = FPlatformTime::Seconds();
+
+        TArray<uint8> Table;
+        if (!BuildTable(Width, Height, BlankTile, InPatterns[PatternIndex], Table))
+        {
+            UE_LOG(LogPuzzleGame, Error, TEXT("Invalid pattern %d for %dx%d board"), PatternIndex, Width, Height);
+            return false;
+        }
+
+        Padding.SetNumZeroed((int32)(Header.TableOffsets[PatternIndex] - Writer->Tell()));
+        Writer->Serialize(Padding.GetData(), Padding.Num());
+        Writer->Serialize(Table.GetData(), Table.Num());
+
+        UE_LOG(LogPuzzleGame, Display, TEXT("Pattern %d/%d built in %.1fs"),
+            PatternIndex + 1, InPatterns.Num(), FPlatformTime::Seconds() - StartTime);
+    }
+
+    Header.Magic = FileMagic;
+    Writer->Seek(0);
+    Writer->Serialize(&Header, sizeof(Header));
+
+    const bool bSucceeded = Writer->Close() && !Writer->IsError();
+    if (!bSucceeded)
+    {
+        UE_LOG(LogPuzzleGame, Error, TEXT("Failed to write pattern database %s"), *FilePath);
+    }
+    return bSucceeded;
+}
+
+TSharedPtr<const FPuzzlePatternDatabase, ESPMode::ThreadSafe> FPuzzlePatternDatabase::LoadFromFile(const FString& FilePath)
+{
+    TSharedPtr<FPuzzlePatternDatabase, ESPMode::ThreadSafe> Database = MakeShareable(new FPuzzlePatternDatabase());
+
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    FOpenMappedResult MappedResult = PlatformFile.OpenMappedEx(*FilePath);
+    if (MappedResult.HasValue())
+    {
+        Database->MappedFile = MappedResult.StealValue();
+        Database->MappedRegion.Reset(Database->MappedFile->MapRegion(0, Database->MappedFile->GetFileSize()));
+    }
+
+    const uint8* Data = nullptr;
+    int64 DataSize = 0;
+    if (Database->MappedRegion)
+    {
+        Data = Database->MappedRegion->GetMappedPtr();
+        DataSize = Database->MappedRegion->GetMappedSize();
+    }
+    else if (FFileHelper::LoadFileToArray(Database->OwnedData, *FilePath, FILEREAD_Silent))
+    {
+        Data = Database->OwnedData.GetData();
+        DataSize = Database->OwnedData.Num();
+    }
+    else
+    {
+        return nullptr;
+    }
+
+    if (DataSize < (int64)sizeof(FPuzzlePatternDatabaseHeader))
+    {
+        return nullptr;
+    }
+
+    FPuzzlePatternDatabaseHeader Header;
+    FMemory::Memcpy(&Header, Data, sizeof(Header));
+
+    const int32 NumCells = Header.Width * Header.Height;
+    if (Header.Magic != FileMagic || Header.Version != FileVersion || Header.Width <= 0 || Header.Height <= 0 ||
+        NumCells > 32 || Header.NumPatterns <= 0 || Header.NumPatterns > MaxPatterns)
+    {
+        UE_LOG(LogPuzzleGame, Warning, TEXT("Pattern database %s has an unsupported header"), *FilePath);
+        return nullptr;
+    }
+
+    if (Header.BlankTile < 0 || Header.BlankTile >= NumCells)
+    {
+        UE_LOG(LogPuzzleGame, Warning, TEXT("Pattern database %s has an invalid blank tile"), *FilePath);
+        return nullptr;
+    }
+
+    Database->Width = Header.Width;
+    Database->Height = Header.Height;
+    Database->BlankTile = Header.BlankTile;
+    Database->NumPatterns = Header.NumPatterns;
+
+    // Heuristik toplamının kabul edilebilir olması için pattern'ler ayrık olmalı ve boşluğu içermemeli
+    uint32 UsedTiles = 1u << Header.BlankTile;
+    for (int32 PatternIndex = 0; PatternIndex < Header.NumPatterns; PatternIndex++)
+    {
+        FPattern& Pattern = Database->Patterns[PatternIndex];
+        Pattern.NumTiles = Header.PatternSizes[PatternIndex];
+        if (Pattern.NumTiles <= 0 || Pattern.NumTiles > MaxPatternTiles)
+        {
+            return nullptr;
+        }
+
+        for (int32 Slot = 0; Slot < Pattern.NumTiles; Slot++)
+        {
+            Pattern.Tiles[Slot] = Header.PatternTiles[PatternIndex][Slot];
+            if (Pattern.Tiles[Slot] >= NumCells || (UsedTiles & (1u << Pattern.Tiles[Slot])))
+            {
+                UE_LOG(LogPuzzleGame, Warning, TEXT("Pattern database %s has overlapping partitions"), *FilePath);
+                return nullptr;
+            }
+            UsedTiles |= 1u << Pattern.Tiles[Slot];
+        }
+
+        ComputeFactors(NumCells, Pattern.NumTiles, Pattern.Factors, Pattern.TableSize);
+
+        const int64 TableOffset = Header.TableOffsets[PatternIndex];
+        if (Pattern.TableSize != Header.TableSizes[PatternIndex] || TableOffset < 0 || TableOffset + Pattern.TableSize > DataSize)
+        {
+            UE_LOG(LogPuzzleGame, Warning, TEXT("Pattern database %s is truncated"), *FilePath);
+            return nullptr;
+        }
+        Pattern.Table = Data + TableOffset;
+    }
+
+    return Database;
+}
+
+TSharedPtr<const FPuzzlePatternDatabase, ESPMode::ThreadSafe> FPuzzlePatternDatabase::FindOrLoad(int32 Width, int32 Height)
+{
+    static FCriticalSection CacheLock;
+    static TMap<FIntPoint, TWeakPtr<const FPuzzlePatternDatabase, ESPMode::ThreadSafe>> Cache;
+
+    FScopeLock Lock(&CacheLock);
+
+    const FIntPoint Key(Width, Height);
+    if (TSharedPtr<const FPuzzlePatternDatabase, ESPMode::ThreadSafe> Existing = Cache.FindRef(Key).Pin())
+    {
+        return Existing;
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+    const FString FilePath = GetDefaultPath(Width, Height);
+    TSharedPtr<const FPuzzlePatternDatabase, ESPMode::ThreadSafe> Database = LoadFromFile(FilePath);
+    if (Database.IsValid())
+    {
+        Cache.Add(Key, Database);
+        UE_LOG(LogPuzzleGame, Log, TEXT("Mapped pattern database %s (%d patterns) in %.2fms"),
+            *FilePath, Database->GetNumPatterns(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+    }
+    return Database;
+}
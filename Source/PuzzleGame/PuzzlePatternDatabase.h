@@ -0,0 +1,101 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+// Dosyanın başındaki sabit boyutlu başlık - tablolar sayfa hizalı offset'lerde, olduğu gibi okunur
+struct FPuzzlePatternDatabaseHeader
+{
+    static constexpr int32 MaxPatterns = 4;
+    static constexpr int32 MaxPatternTiles = 6;
+
+    uint32 Magic;
+    uint32 Version;
+    int32 Width;
+    int32 Height;
+    int32 BlankTile;
+    int32 NumPatterns;
+    int32 PatternSizes[MaxPatterns];
+    uint8 PatternTiles[MaxPatterns][8];
+    int64 TableOffsets[MaxPatterns];
+    int64 TableSizes[MaxPatterns];
+};
+
+/**
+ * Additive pattern databases for the sliding-tile solver. The non-blank tiles are split
+ * into disjoint patterns; each table stores, for every placement of its pattern's tiles,
+ * the minimum number of moves of those tiles needed to reach their goal cells. Only moves
+ * of pattern tiles are counted, so the per-pattern values can be summed admissibly.
+ *
+ * A placement is packed into a dense rank of the k-permutation of its cells (16P6 = 5.8M
+ * entries for a 4x4 six-tile pattern, 25P6 = 127.5M for 5x5), one byte per entry.
+ * Tables are built offline by a level-synchronous parallel BFS and written to a versioned
+ * file. At runtime the file is memory-mapped read-only and used in place, so loading does
+ * no parsing and the OS shares the pages between game processes.
+ */
+class PUZZLEGAME_API FPuzzlePatternDatabase
+{
+public:
+    static constexpr uint32 FileMagic = 0x42445050; // "PPDB"
+    static constexpr uint32 FileVersion = 1;
+    static constexpr int32 MaxPatterns = FPuzzlePatternDatabaseHeader::MaxPatterns;
+    static constexpr int32 MaxPatternTiles = FPuzzlePatternDatabaseHeader::MaxPatternTiles;
+
+    ~FPuzzlePatternDatabase();
+
+    // Board boyutu başına tek kopya - aynı dosyayı tekrar map etmez
+    static TSharedPtr<const FPuzzlePatternDatabase, ESPMode::ThreadSafe> FindOrLoad(int32 Width, int32 Height);
+
+    static TSharedPtr<const FPuzzlePatternDatabase, ESPMode::ThreadSafe> LoadFromFile(const FString& FilePath);
+
+    static FString GetDefaultPath(int32 Width, int32 Height);
+
+    // 4x4: 6-6-3, 5x5: 6-6-6-6, diğerleri satır sırasıyla 6'lık gruplar
+    static void GetDefaultPartition(int32 Width, int32 Height, int32 BlankTile, TArray<TArray<int32>>& OutPatterns);
+
+    // Tüm tabloları üretip dosyaya yazar - çevrimdışı, büyük board'larda GB'larca bellek ister
+    static bool BuildToFile(int32 Width, int32 Height, int32 BlankTile, const TArray<TArray<int32>>& Patterns, const FString& FilePath);
+
+    // Tek pattern tablosu: Table[Rank(hücreler)] = pattern taşlarının en az hamlesi
+    static bool BuildTable(int32 Width, int32 Height, int32 BlankTile, TArrayView<const int32> PatternTiles, TArray<uint8>& OutTable);
+
+    bool IsCompatible(int32 InWidth, int32 InHeight, int32 InBlankTile) const;
+
+    int32 GetNumPatterns() const { return NumPatterns; }
+    int32 GetPatternSize(int32 PatternIndex) const { return Patterns[PatternIndex].NumTiles; }
+    int32 GetPatternTile(int32 PatternIndex, int32 Slot) const { return Patterns[PatternIndex].Tiles[Slot]; }
+
+    // TilePositions[Tile] = taşın hücresi
+    uint8 Lookup(int32 PatternIndex, const uint8* TilePositions) const;
+
+    // k-permütasyonun sıralı indeksi; Factors[i] = P(N - 1 - i, k - 1 - i)
+    static int64 RankPlacement(const uint8* Cells, int32 NumTiles, const int64* Factors);
+    static void ComputeFactors(int32 NumCells, int32 NumTiles, int64* OutFactors, int64& OutTableSize);
+
+private:
+    FPuzzlePatternDatabase() = default;
+
+    struct FPattern
+    {
+        int32 NumTiles = 0;
+        uint8 Tiles[MaxPatternTiles];
+        int64 Factors[MaxPatternTiles];
+        const uint8* Table = nullptr;
+        int64 TableSize = 0;
+    };
+
+    int32 Width = 0;
+    int32 Height = 0;
+    int32 BlankTile = 0;
+    int32 NumPatterns = 0;
+    FPattern Patterns[MaxPatterns];
+
+    // Map edilemeyen platformlarda dosya belleğe okunur
+    TUniquePtr<IMappedFileHandle> MappedFile;
+    TUniquePtr<IMappedFileRegion> MappedRegion;
+    TArray<uint8> OwnedData;
+};
@@ -0,0 +1,59 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "PuzzlePatternDatabaseCommandlet.h"
+#include "PuzzlePatternDatabase.h"
+#include "PuzzleGame.h"
+#include "HAL/PlatformTime.h"
+
+UPuzzlePatternDatabaseCommandlet::UPuzzlePatternDatabaseCommandlet()
+{
+    // Rendering veya client/server gerektirmez
+    IsClient = false;
+    IsServer = false;
+    IsEditor = false;
+    LogToConsole = true;
+    ShowErrorCount = true;
+}
+
+int32 UPuzzlePatternDatabaseCommandlet::Main(const FString& Params)
+{
+    int32 Width = 4;
+    int32 Height = 4;
+    FParse::Value(*Params, TEXT("Width="), Width);
+    FParse::Value(*Params, TEXT("Height="), Height);
+
+    if (Width < 2 || Height < 2 || Width > 5 || Height > 5)
+    {
+        UE_LOG(LogPuzzleGame, Error, TEXT("Pattern databases are supported for 2x2 to 5x5 boards, got %dx%d"), Width, Height);
+        return 1;
+    }
+
+    FString OutputPath;
+    if (!FParse::Value(*Params, TEXT("Output="), OutputPath))
+    {
+        OutputPath = FPuzzlePatternDatabase::GetDefaultPath(Width, Height);
+    }
+
+    // Oyundaki gibi son taş boşluktur
+    const int32 BlankTile = Width * Height - 1;
+    TArray<TArray<int32>> Patterns;
+    FPuzzlePatternDatabase::GetDefaultPartition(Width, Height, BlankTile, Patterns);
+
+    FString PartitionText;
+    for (const TArray<int32>& Pattern : Patterns)
+    {
+        PartitionText += FString::Printf(TEXT("%s%d"), PartitionText.IsEmpty() ? TEXT("") : TEXT("-"), Pattern.Num());
+    }
+    UE_LOG(LogPuzzleGame, Display, TEXT("Building %s pattern database for %dx%d on %d workers"),
+        *PartitionText, Width, Height, FPlatformMisc::NumberOfWorkerThreadsToSpawn());
+
+    const double StartTime = FPlatformTime::Seconds();
+    if (!FPuzzlePatternDatabase::BuildToFile(Width, Height, BlankTile, Patterns, OutputPath))
+    {
+        return 1;
+    }
+
+    UE_LOG(LogPuzzleGame, Display, TEXT("Pattern database written to %s in %.1f s"),
+        *OutputPath, FPlatformTime::Seconds() - StartTime);
+    return 0;
+}
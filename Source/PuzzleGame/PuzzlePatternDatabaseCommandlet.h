@@ -0,0 +1,25 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "PuzzlePatternDatabaseCommandlet.generated.h"
+
+/**
+ * Offline builder for the sliding-tile pattern databases. Builds the default additive
+ * partition for the board size (blank is the last tile, as in the game) and writes the
+ * versioned file that the game memory-maps at startup.
+ *
+ * Usage: UnrealEditor-Cmd PuzzleGame.uproject -run=PuzzlePatternDatabase [-Width=4] [-Height=4] [-Output=<file>] -nullrhi
+ */
+UCLASS()
+class PUZZLEGAME_API UPuzzlePatternDatabaseCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UPuzzlePatternDatabaseCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
@@ -26,10 +26,14 @@ APuzzlePiece::APuzzlePiece()
     PieceID = -1;
     CorrectPosition = FVector::ZeroVector;
     bIsInCorrectPosition = false;
+    bFirePlacementEvents = true;
     bIsSelected = false;
     PositionTolerance = 100.0f;
     MoveSpeed = 1000.0f;
     bIsMoving = false;
+    bBoardRendered = false;
+    DefaultPieceMesh = nullptr;
+    bHasDefaultMesh = false;
 
     // Default scale (1,1,1) garantisi
     SetActorScale3D(FVector(1.0f, 1.0f, 1.0f));
@@ -83,6 +87,11 @@ bool APuzzlePiece::CheckIfInCorrectPosition()
     bool bWasPreviouslyCorrect = bIsInCorrectPosition;
     bIsInCorrectPosition = Distance <= PositionTolerance;
 
+    if (!bFirePlacementEvents)
+    {
+        return bIsInCorrectPosition;
+    }
+
     // Durum değişti mi kontrol et
     if (bIsInCorrectPosition && !bWasPreviouslyCorrect)
     {
@@ -147,6 +156,22 @@ void APuzzlePiece::SetSelected(bool bSelected)
         {
             OnPieceDeselected();
         }
+
+        UpdateMeshVisibility();
+    }
+}
+
+void APuzzlePiece::SetBoardRendered(bool bRendered)
+{
+    bBoardRendered = bRendered;
+    UpdateMeshVisibility();
+}
+
+void APuzzlePiece::UpdateMeshVisibility()
+{
+    if (PieceMesh)
+    {
+        PieceMesh->SetVisibility(!bBoardRendered || bIsSelected);
     }
 }
 
@@ -174,3 +199,64 @@ void APuzzlePiece::SetPieceMaterial(UMaterialInterface* NewMaterial)
         PieceMesh->SetMaterial(0, NewMaterial);
     }
 }
+
+void APuzzlePiece::SetEdgeColours(FLinearColor North, FLinearColor East, FLinearColor South, FLinearColor West)
+{
+    if (!PieceMesh)
+    {
+        return;
+    }
+
+    // Mevcut materyal zaten dinamikse yeniden kullanılır
+    if (UMaterialInstanceDynamic* EdgeMaterial = PieceMesh->CreateAndSetMaterialInstanceDynamic(0))
+    {
+        EdgeMaterial->SetVectorParameterValue(TEXT("EdgeColorNorth"), North);
+        EdgeMaterial->SetVectorParameterValue(TEXT("EdgeColorEast"), East);
+        EdgeMaterial->SetVectorParameterValue(TEXT("EdgeColorSouth"), South);
+        EdgeMaterial->SetVectorParameterValue(TEXT("EdgeColorWest"), West);
+    }
+}
+
+bool APuzzlePiece::HasEdgeColourParameters(const UMaterialInterface* Material)
+{
+    if (!Material)
+    {
+        return false;
+    }
+
+    FLinearColor ExistingColour;
+    for (const TCHAR* ParameterName : { TEXT("EdgeColorNorth"), TEXT("EdgeColorEast"), TEXT("EdgeColorSouth"), TEXT("EdgeColorWest") })
+    {
+        if (!Material->GetVectorParameterValue(FHashedMaterialParameterInfo(ParameterName), ExistingColour))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void APuzzlePiece::SetShapeMesh(UStaticMesh* ShapeMesh)
+{
+    if (!PieceMesh)
+    {
+        return;
+    }
+
+    if (!bHasDefaultMesh)
+    {
+        DefaultPieceMesh = PieceMesh->GetStaticMesh();
+        DefaultMeshTransform = PieceMesh->GetRelativeTransform();
+        bHasDefaultMesh = true;
+    }
+
+    if (!ShapeMesh)
+    {
+        PieceMesh->SetStaticMesh(DefaultPieceMesh);
+        PieceMesh->SetRelativeTransform(DefaultMeshTransform);
+        return;
+    }
+
+    // Şekil mesh'i hücre boyutunda kurulur - Blueprint mesh'inin ölçeği/dönüşü uygulanmaz
+    PieceMesh->SetStaticMesh(ShapeMesh);
+    PieceMesh->SetRelativeTransform(FTransform(DefaultMeshTransform.GetLocation()));
+}
@@ -49,6 +49,10 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Puzzle")
     float PositionTolerance;
 
+    // OnCorrectPlacement/OnIncorrectPlacement Blueprint event'lerini tetikle
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Puzzle")
+    bool bFirePlacementEvents;
+
 public:
     virtual void Tick(float DeltaTime) override;
 
@@ -74,6 +78,14 @@ public:
     UFUNCTION(BlueprintPure, Category = "Puzzle")
     bool IsInCorrectPosition() const { return bIsInCorrectPosition; }
 
+    UFUNCTION(BlueprintPure, Category = "Puzzle")
+    bool IsSelected() const { return bIsSelected; }
+
+    UFUNCTION(BlueprintPure, Category = "Puzzle")
+    bool IsMoving() const { return bIsMoving; }
+
+    UStaticMeshComponent* GetPieceMesh() const { return PieceMesh; }
+
     // Setter fonksiyonları
     UFUNCTION(BlueprintCallable, Category = "Puzzle")
     void SetPieceID(int32 NewID) { PieceID = NewID; }
@@ -81,6 +93,14 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Puzzle")
     void SetCorrectPosition(FVector NewPosition) { CorrectPosition = NewPosition; }
 
+    // Kapalıysa doğru/yanlış yerleşim event'leri sadece game mode'un toplu delta'sıyla gelir
+    UFUNCTION(BlueprintCallable, Category = "Puzzle")
+    void SetPlacementEventsEnabled(bool bEnabled) { bFirePlacementEvents = bEnabled; }
+
+    // Board tek quad olarak çiziliyorsa mesh sadece sürüklenirken görünür
+    UFUNCTION(BlueprintCallable, Category = "Puzzle")
+    void SetBoardRendered(bool bRendered);
+
     // Blueprint'te override edilebilir event'ler
     UFUNCTION(BlueprintImplementableEvent, Category = "Puzzle")
     void OnCorrectPlacement();
@@ -102,6 +122,17 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Puzzle")
     void SetPieceMaterial(UMaterialInterface* NewMaterial);
 
+    // Edge-matching modu: kenar renkleri materyalin EdgeColorNorth/East/South/West parametrelerine yazılır
+    // Materyal InitializePuzzle'da HasEdgeColourParameters ile bir kez doğrulanır
+    UFUNCTION(BlueprintCallable, Category = "Puzzle")
+    void SetEdgeColours(FLinearColor North, FLinearColor East, FLinearColor South, FLinearColor West);
+
+    // Dört EdgeColor vektör parametresi de var mı - M_PieceN materyalleri bunları tanımlamaz
+    static bool HasEdgeColourParameters(const UMaterialInterface* Material);
+
+    // Prosedürel jigsaw mesh'i - nullptr Blueprint'teki varsayılan mesh'e döner
+    void SetShapeMesh(UStaticMesh* ShapeMesh);
+
 protected:
     // Overlap event'leri
     UFUNCTION()
@@ -114,4 +145,15 @@ private:
     FVector TargetLocation;
     bool bIsMoving;
     float MoveSpeed;
+
+    bool bBoardRendered;
+
+    // İlk SetShapeMesh çağrısında saklanan Blueprint mesh'i ve göreli transform'u
+    UPROPERTY()
+    UStaticMesh* DefaultPieceMesh;
+
+    FTransform DefaultMeshTransform;
+    bool bHasDefaultMesh;
+
+    void UpdateMeshVisibility();
 };
\ No newline at end of file
@@ -0,0 +1,407 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "PuzzlePieceShape.h"
+#include "MeshDescription.h"
+#include "StaticMeshAttributes.h"
+
+namespace PuzzleShape
+{
+    enum ESide : int32
+    {
+        North = 0,
+        East = 1,
+        South = 2,
+        West = 3
+    };
+
+    // Kenar boyunca (U) ve dışa doğru (W) birim hücre koordinatlarında çıkıntı ölçüleri
+    struct FTabProfile
+    {
+        float Offset;
+        float NeckHalfWidth;
+        float HeadHalfWidth;
+        float Height;
+    };
+
+    // Varyant geometrisi sabit seed'den - aynı kod her board'da aynı mesh
+    FTabProfile GetTabProfile(int32 Variant)
+    {
+        FRandomStream Stream(0x51A9E + Variant * 7919);
+        FTabProfile Profile;
+        Profile.Offset = Variant == 0 ? 0.0f : Stream.FRandRange(-0.06f, 0.06f);
+        Profile.NeckHalfWidth = Stream.FRandRange(0.07f, 0.09f);
+        Profile.HeadHalfWidth = Stream.FRandRange(0.12f, 0.15f);
+        Profile.Height = Stream.FRandRange(0.2f, 0.25f);
+        return Profile;
+    }
+
+    FORCEINLINE FVector2f EvaluateCubic(const FVector2f& P0, const FVector2f& P1, const FVector2f& P2, const FVector2f& P3, float T)
+    {
+        const float S = 1.0f - T;
+        return P0 * (S * S * S) + P1 * (3.0f * S * S * T) + P2 * (3.0f * S * T * T) + P3 * (T * T * T);
+    }
+
+    FORCEINLINE float Cross(const FVector2f& A, const FVector2f& B)
+    {
+        return A.X * B.Y - A.Y * B.X;
+    }
+
+    // Kenarlar dahil - kenara değen köşe kulağı geçersiz kılar
+    FORCEINLINE bool IsInTriangle(const FVector2f& P, const FVector2f& A, const FVector2f& B, const FVector2f& C)
+    {
+        return Cross(B - A, P - A) >= 0.0f && Cross(C - B, P - B) >= 0.0f && Cross(A - C, P - C) >= 0.0f;
+    }
+
+    // Kenarın başlangıç köşesi ve çıkıntı noktaları - bitiş köşesi sonraki kenarın başlangıcı
+    void AppendSide(int32 Side, uint8 Code, int32 CurveSegments, TArray<FVector2f>& OutOutline)
+    {
+        static const FVector2f Corners[4] = { { -0.5f, -0.5f }, { 0.5f, -0.5f }, { 0.5f, 0.5f }, { -0.5f, 0.5f } };
+        const FVector2f Start = Corners[Side];
+        const FVector2f Direction = Corners[(Side + 1) & 3] - Start;
+        const FVector2f Outward(Direction.Y, -Direction.X);
+
+        OutOutline.Add(Start);
+        if (Code == 0)
+        {
+            return;
+        }
+
+        // Kanonik yön yatay kenarda +X, dikeyde +Y - güney ve batı ters gezilir, ofset aynalanır
+        const FTabProfile Profile = GetTabProfile((Code - 1) >> 1);
+        const float Sign = ((Code - 1) & 1) ? 1.0f : -1.0f;
+        const float Center = 0.5f + (Side >= South ? -Profile.Offset : Profile.Offset);
+        const float Neck = Profile.NeckHalfWidth;
+        const float Head = Profile.HeadHalfWidth;
+        const float H = Profile.Height;
+
+        // Boyun içe kıvrılır, baş boyundan geniş - merkez etrafında simetrik üç kübik eğri
+        const FVector2f Curves[3][4] =
+        {
+            { { Center - Neck, 0.0f }, { Center - Neck + 0.01f, 0.35f * H }, { Center - Head, 0.35f * H }, { Center - Head, 0.7f * H } },
+            { { Center - Head, 0.7f * H }, { Center - Head, 1.05f * H }, { Center + Head, 1.05f * H }, { Center + Head, 0.7f * H } },
+            { { Center + Head, 0.7f * H }, { Center + Head, 0.35f * H }, { Center + Neck - 0.01f, 0.35f * H }, { Center + Neck, 0.0f } },
+        };
+
+        auto ToCell = [&](const FVector2f& UW)
+        {
+            return Start + Direction * UW.X + Outward * (UW.Y * Sign);
+        };
+
+        OutOutline.Add(ToCell(Curves[0][0]));
+        for (const FVector2f* Curve : Curves)
+        {
+            for (int32 Segment = 1; Segment <= CurveSegments; Segment++)
+            {
+                OutOutline.Add(ToCell(EvaluateCubic(Curve[0], Curve[1], Curve[2], Curve[3], (float)Segment / CurveSegments)));
+            }
+        }
+    }
+}
+
+const FName FPuzzlePieceShapeSet::MaterialSlotName(TEXT("PieceSurface"));
+
+TSharedRef<const FPuzzlePieceShapeSet, ESPMode::ThreadSafe> FPuzzlePieceShapeSet::Generate(int32 Width, int32 Height, int32 NumVariants, int32 Seed)
+{
+    NumVariants = FMath::Clamp(NumVariants, 1, MaxVariants);
+    FRandomStream Stream(Seed);
+
+    // Hücrenin doğu ve güney kenarı - kod doğu/güney tarafından görülen hali, komşu çıkıntı yönünü çevirir
+    TArray<uint8> EastCodes;
+    TArray<uint8> SouthCodes;
+    EastCodes.SetNumUninitialized(Width * Height);
+    SouthCodes.SetNumUninitialized(Width * Height);
+    auto RandomCode = [&Stream, NumVariants]()
+    {
+        return (uint8)(1 + (Stream.RandRange(0, NumVariants - 1) << 1) + Stream.RandRange(0, 1));
+    };
+    for (int32 GridID = 0; GridID < Width * Height; GridID++)
+    {
+        EastCodes[GridID] = (GridID % Width) < Width - 1 ? RandomCode() : 0;
+        SouthCodes[GridID] = (GridID / Width) < Height - 1 ? RandomCode() : 0;
+    }
+
+    auto Opposite = [](uint8 Code)
+    {
+        return Code == 0 ? Code : (uint8)(((Code - 1) ^ 1) + 1);
+    };
+
+    TArray<uint32> Signatures;
+    Signatures.SetNumUninitialized(Width * Height);
+    for (int32 GridID = 0; GridID < Width * Height; GridID++)
+    {
+        const int32 Col = GridID % Width;
+        const int32 Row = GridID / Width;
+        const uint8 North = Row > 0 ? Opposite(SouthCodes[GridID - Width]) : 0;
+        const uint8 West = Col > 0 ? Opposite(EastCodes[GridID - 1]) : 0;
+        Signatures[GridID] = (uint32)North | ((uint32)EastCodes[GridID] << 8) | ((uint32)SouthCodes[GridID] << 16) | ((uint32)West << 24);
+    }
+
+    return MakeShared<const FPuzzlePieceShapeSet, ESPMode::ThreadSafe>(Width, Height, MoveTemp(Signatures));
+}
+
+FPuzzlePieceShapeSet::FPuzzlePieceShapeSet(int32 InWidth, int32 InHeight, TArray<uint32> InSignatures)
+    : Width(InWidth)
+    , Height(InHeight)
+    , Signatures(MoveTemp(InSignatures))
+{
+    check(Signatures.Num() == Width * Height);
+}
+
+void FPuzzlePieceShapeSet::GetUniqueSignatures(TArray<uint32>& OutSignatures) const
+{
+    OutSignatures.Reset();
+    TSet<uint32> Seen;
+    for (const uint32 Signature : Signatures)
+    {
+        bool bAlreadySeen = false;
+        Seen.Add(Signature, &bAlreadySeen);
+        if (!bAlreadySeen)
+        {
+            OutSignatures.Add(Signature);
+        }
+    }
+}
+
+void FPuzzlePieceShapeSet::BuildOutline(uint32 Signature, int32 CurveSegments, TArray<FVector2f>& OutOutline)
+{
+    CurveSegments = FMath::Max(CurveSegments, 1);
+    OutOutline.Reset();
+    for (int32 Side = 0; Side < 4; Side++)
+    {
+        PuzzleShape::AppendSide(Side, GetSideCode(Signature, Side), CurveSegments, OutOutline);
+    }
+}
+
+bool FPuzzlePieceShapeSet::Triangulate(TArrayView<const FVector2f> Polygon, TArray<int32>& OutTriangles)
+{
+    using namespace PuzzleShape;
+
+    const int32 NumPoints = Polygon.Num();
+    OutTriangles.Reset();
+    if (NumPoints < 3)
+    {
+        return false;
+    }
+    OutTriangles.Reserve((NumPoints - 2) * 3);
+
+    // Halka olarak bağlı kalan köşeler
+    TArray<int32> Prev;
+    TArray<int32> Next;
+    Prev.SetNumUninitialized(NumPoints);
+    Next.SetNumUninitialized(NumPoints);
+    for (int32 Index = 0; Index < NumPoints; Index++)
+    {
+        Prev[Index] = Index == 0 ? NumPoints - 1 : Index - 1;
+        Next[Index] = Index == NumPoints - 1 ? 0 : Index + 1;
+    }
+
+    auto IsEar = [&](int32 Vertex)
+    {
+        const int32 A = Prev[Vertex];
+        const int32 C = Next[Vertex];
+        const FVector2f& PA = Polygon[A];
+        const FVector2f& PB = Polygon[Vertex];
+        const FVector2f& PC = Polygon[C];
+
+        // Dışbükey köşe değilse kulak olamaz
+        if (Cross(PB - PA, PC - PB) <= 0.0f)
+        {
+            return false;
+        }
+
+        for (int32 Other = Next[C]; Other != A; Other = Next[Other])
+        {
+            if (IsInTriangle(Polygon[Other], PA, PB, PC))
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    int32 Remaining = NumPoints;
+    int32 Vertex = 0;
+    int32 Misses = 0;
+    while (Remaining > 3)
+    {
+        if (IsEar(Vertex))
+        {
+            const int32 A = Prev[Vertex];
+            const int32 C = Next[Vertex];
+            OutTriangles.Append({ A, Vertex, C });
+            Next[A] = C;
+            Prev[C] = A;
+            Remaining--;
+            Misses = 0;
+
+            // Kesilen kulağın önceki komşusu yeni kulak adayıdır
+            Vertex = A;
+        }
+        else
+        {
+            Vertex = Next[Vertex];
+
+            // Tam tur kulaksız - çokgen basit değil
+            if (++Misses > Remaining)
+            {
+                OutTriangles.Reset();
+                return false;
+            }
+        }
+    }
+
+    OutTriangles.Append({ Prev[Vertex], Vertex, Next[Vertex] });
+    return true;
+}
+
+bool FPuzzlePieceShapeSet::BuildMeshDescription(uint32 Signature, float Size, float Thickness, int32 CurveSegments, FMeshDescription& OutMesh)
+{
+    TArray<FVector2f> Outline;
+    BuildOutline(Signature, CurveSegments, Outline);
+    return BuildPrism(Outline, Size, Thickness, true, OutMesh);
+}
+
+void FPuzzlePieceShapeSet::BuildCellOutline(EPuzzleGridTopology Topology, TArray<FVector2f>& OutOutline)
+{
+    OutOutline.Reset();
+    if (Topology == EPuzzleGridTopology::Hex)
+    {
+        // Sivri tepeli: köşeler 30 + 60k derecede, köşe yarıçapı 1 / sqrt(3) - düz kenarlar arası 1
+        const float Radius = FPuzzleHexTopology::GetCellHalfExtent(1.0f).Y;
+        for (int32 Corner = 0; Corner < 6; Corner++)
+        {
+            const float Angle = FMath::DegreesToRadians(30.0f + 60.0f * Corner);
+            OutOutline.Add(FVector2f(FMath::Cos(Angle), FMath::Sin(Angle)) * Radius);
+        }
+    }
+    else if (Topology == EPuzzleGridTopology::Triangle)
+    {
+        // Yukarı bakan: tepe düşük satır yönünde (-Y), taban ağırlık merkezinin h/3 altında
+        const float RowHeight = FPuzzleTriangleTopology::RowScale;
+        OutOutline.Add(FVector2f(0.0f, -RowHeight * 2.0f / 3.0f));
+        OutOutline.Add(FVector2f(0.5f, RowHeight / 3.0f));
+        OutOutline.Add(FVector2f(-0.5f, RowHeight / 3.0f));
+    }
+    else
+    {
+        OutOutline.Add(FVector2f(-0.5f, -0.5f));
+        OutOutline.Add(FVector2f(0.5f, -0.5f));
+        OutOutline.Add(FVector2f(0.5f, 0.5f));
+        OutOutline.Add(FVector2f(-0.5f, 0.5f));
+    }
+}
+
+bool FPuzzlePieceShapeSet::BuildCellMeshDescription(EPuzzleGridTopology Topology, float Size, float Thickness, FMeshDescription& OutMesh)
+{
+    TArray<FVector2f> Outline;
+    BuildCellOutline(Topology, Outline);
+    return BuildPrism(Outline, Size, Thickness, false, OutMesh);
+}
+
+bool FPuzzlePieceShapeSet::BuildPrism(TArrayView<const FVector2f> Outline, float Size, float Thickness, bool bSmoothSides, FMeshDescription& OutMesh)
+{
+    TArray<int32> Triangles;
+    if (!Triangulate(Outline, Triangles))
+    {
+        return false;
+    }
+
+    const int32 NumPoints = Outline.Num();
+    const float HalfThickness = Thickness * 0.5f;
+
+    FStaticMeshAttributes Attributes(OutMesh);
+    Attributes.Register();
+    TVertexAttributesRef<FVector3f> Positions = Attributes.GetVertexPositions();
+    TVertexInstanceAttributesRef<FVector3f> Normals = Attributes.GetVertexInstanceNormals();
+    TVertexInstanceAttributesRef<FVector2f> UVs = Attributes.GetVertexInstanceUVs();
+    UVs.SetNumChannels(1);
+
+    OutMesh.ReserveNewVertices(NumPoints * 2);
+    OutMesh.ReserveNewVertexInstances(NumPoints * 4);
+    OutMesh.ReserveNewTriangles(Triangles.Num() / 3 * 2 + NumPoints * 2);
+    const FPolygonGroupID PolygonGroup = OutMesh.CreatePolygonGroup();
+    Attributes.GetPolygonGroupMaterialSlotNames()[PolygonGroup] = MaterialSlotName;
+
+    TArray<FVertexID> TopVertices;
+    TArray<FVertexID> BottomVertices;
+    TopVertices.SetNumUninitialized(NumPoints);
+    BottomVertices.SetNumUninitialized(NumPoints);
+    for (int32 Index = 0; Index < NumPoints; Index++)
+    {
+        const FVector2f Point = Outline[Index] * Size;
+        TopVertices[Index] = OutMesh.CreateVertex();
+        Positions[TopVertices[Index]] = FVector3f(Point.X, Point.Y, HalfThickness);
+        BottomVertices[Index] = OutMesh.CreateVertex();
+        Positions[BottomVertices[Index]] = FVector3f(Point.X, Point.Y, -HalfThickness);
+    }
+
+    auto AddInstance = [&](FVertexID Vertex, const FVector3f& Normal, int32 PointIndex)
+    {
+        const FVertexInstanceID Instance = OutMesh.CreateVertexInstance(Vertex);
+        Normals[Instance] = Normal;
+        UVs.Set(Instance, 0, (Outline[PointIndex] + FVector2f(0.5f + TileMargin, 0.5f + TileMargin)) / (1.0f + 2.0f * TileMargin));
+        return Instance;
+    };
+
+    // UE'de ön yüz normali (P2 - P0) ^ (P1 - P0) - pozitif alanlı üçgenler üst yüzde ters çevrilir
+    TArray<FVertexInstanceID> TopInstances;
+    TArray<FVertexInstanceID> BottomInstances;
+    TopInstances.SetNumUninitialized(NumPoints);
+    BottomInstances.SetNumUninitialized(NumPoints);
+    for (int32 Index = 0; Index < NumPoints; Index++)
+    {
+        TopInstances[Index] = AddInstance(TopVertices[Index], FVector3f::UnitZ(), Index);
+        BottomInstances[Index] = AddInstance(BottomVertices[Index], -FVector3f::UnitZ(), Index);
+    }
+    for (int32 Index = 0; Index < Triangles.Num(); Index += 3)
+    {
+        const int32 A = Triangles[Index];
+        const int32 B = Triangles[Index + 1];
+        const int32 C = Triangles[Index + 2];
+        OutMesh.CreateTriangle(PolygonGroup, { TopInstances[A], TopInstances[C], TopInstances[B] });
+        OutMesh.CreateTriangle(PolygonGroup, { BottomInstances[A], BottomInstances[B], BottomInstances[C] });
+    }
+
+    // Yan yüzler: eğriler yumuşak görünsün diye nokta normali iki komşu kenarın ortalaması
+    TArray<FVector3f> SideNormals;
+    SideNormals.SetNumUninitialized(NumPoints);
+    for (int32 Index = 0; Index < NumPoints; Index++)
+    {
+        const FVector2f Incoming = Outline[Index] - Outline[Index == 0 ? NumPoints - 1 : Index - 1];
+        const FVector2f Outgoing = Outline[Index == NumPoints - 1 ? 0 : Index + 1] - Outline[Index];
+        const FVector2f Normal = FVector2f(Incoming.Y, -Incoming.X).GetSafeNormal() + FVector2f(Outgoing.Y, -Outgoing.X).GetSafeNormal();
+        SideNormals[Index] = FVector3f(Normal.GetSafeNormal(), 0.0f);
+    }
+
+    TArray<FVertexInstanceID> SideTop;
+    TArray<FVertexInstanceID> SideBottom;
+    SideTop.SetNumUninitialized(NumPoints);
+    SideBottom.SetNumUninitialized(NumPoints);
+    for (int32 Index = 0; Index < NumPoints; Index++)
+    {
+        SideTop[Index] = AddInstance(TopVertices[Index], SideNormals[Index], Index);
+        SideBottom[Index] = AddInstance(BottomVertices[Index], SideNormals[Index], Index);
+    }
+    for (int32 Index = 0; Index < NumPoints; Index++)
+    {
+        const int32 NextIndex = Index == NumPoints - 1 ? 0 : Index + 1;
+        if (bSmoothSides)
+        {
+            OutMesh.CreateTriangle(PolygonGroup, { SideTop[Index], SideBottom[NextIndex], SideBottom[Index] });
+            OutMesh.CreateTriangle(PolygonGroup, { SideTop[Index], SideTop[NextIndex], SideBottom[NextIndex] });
+            continue;
+        }
+
+        // Keskin köşe: her kenar kendi normaliyle ayrı instance'lar kullanır
+        const FVector2f Edge = Outline[NextIndex] - Outline[Index];
+        const FVector3f EdgeNormal(FVector2f(Edge.Y, -Edge.X).GetSafeNormal(), 0.0f);
+        const FVertexInstanceID EdgeTop = AddInstance(TopVertices[Index], EdgeNormal, Index);
+        const FVertexInstanceID EdgeBottom = AddInstance(BottomVertices[Index], EdgeNormal, Index);
+        const FVertexInstanceID NextTop = AddInstance(TopVertices[NextIndex], EdgeNormal, NextIndex);
+        const FVertexInstanceID NextBottom = AddInstance(BottomVertices[NextIndex], EdgeNormal, NextIndex);
+        OutMesh.CreateTriangle(PolygonGroup, { EdgeTop, NextBottom, EdgeBottom });
+        OutMesh.CreateTriangle(PolygonGroup, { EdgeTop, NextTop, NextBottom });
+    }
+
+    return true;
+}
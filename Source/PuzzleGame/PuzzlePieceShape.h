@@ -0,0 +1,76 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PuzzleGridTopology.h"
+
+struct FMeshDescription;
+
+/**
+ * Classic tab/blank jigsaw outlines for a square board. Every inner edge gets a variant and a
+ * direction from the board seed; a piece's shape signature packs its four side codes, one byte
+ * per side in FPuzzleEdgeSet order (north, east, south, west). Code 0 is a flat border side,
+ * otherwise 1 + (Variant << 1) + (TabOut ? 1 : 0).
+ *
+ * Variant geometry does not depend on the seed, so one signature always yields the same mesh
+ * and meshes can be cached by signature across boards. Fewer variants mean more pieces share
+ * a mesh. Outline, triangulation and mesh description building touch no UObjects and are safe
+ * on worker threads.
+ *
+ * Hex and triangle boards have no tabs; their pieces use a flat prism of the cell outline
+ * (BuildCellMeshDescription), and down-facing triangles are the up-facing mesh turned by the
+ * topology's cell yaw.
+ */
+class PUZZLEGAME_API FPuzzlePieceShapeSet
+{
+public:
+    static constexpr int32 MaxVariants = 8;
+
+    // Çıkıntı hücre dışına en fazla bu kadar taşar - UV0 bu payla genişletilmiş kareyi [0, 1]'e eşler
+    static constexpr float TileMargin = 0.25f;
+
+    // Mesh'in tek polygon group'unun materyal slot adı
+    static const FName MaterialSlotName;
+
+    static TSharedRef<const FPuzzlePieceShapeSet, ESPMode::ThreadSafe> Generate(int32 Width, int32 Height, int32 NumVariants, int32 Seed);
+
+    FPuzzlePieceShapeSet(int32 InWidth, int32 InHeight, TArray<uint32> InSignatures);
+
+    int32 GetWidth() const { return Width; }
+    int32 GetHeight() const { return Height; }
+    int32 GetNumPieces() const { return Signatures.Num(); }
+    uint32 GetSignature(int32 PieceID) const { return Signatures[PieceID]; }
+
+    // Tekil imzalar, ilk görülme sırasıyla
+    void GetUniqueSignatures(TArray<uint32>& OutSignatures) const;
+
+    static uint8 GetSideCode(uint32 Signature, int32 Side)
+    {
+        return (uint8)(Signature >> (Side * 8));
+    }
+
+    // Birim hücre ([-0.5, 0.5], X sütun, Y satır yönü) etrafında saat yönü tersine kapalı çokgen
+    static void BuildOutline(uint32 Signature, int32 CurveSegments, TArray<FVector2f>& OutOutline);
+
+    // Basit çokgen için ear clipping - OutTriangles çokgenle aynı yönde (pozitif alan) üçgen indeksleri
+    static bool Triangulate(TArrayView<const FVector2f> Polygon, TArray<int32>& OutTriangles);
+
+    // Size ölçeğinde, Thickness kalınlığında ortalanmış parça - UV0 TileMargin paylı kareyi [0, 1]'e eşler,
+    // çıkıntılar komşu hücrenin pikselini örnekler (resim dilimleri aynı payla kesilir)
+    static bool BuildMeshDescription(uint32 Signature, float Size, float Thickness, int32 CurveSegments, FMeshDescription& OutMesh);
+
+    // Kare olmayan topolojinin hücre çokgeni, ağırlık merkezi etrafında - üçgende yukarı bakan hücre
+    static void BuildCellOutline(EPuzzleGridTopology Topology, TArray<FVector2f>& OutOutline);
+
+    // Çıkıntısız hücre prizması - kenarlar keskin gölgelenir
+    static bool BuildCellMeshDescription(EPuzzleGridTopology Topology, float Size, float Thickness, FMeshDescription& OutMesh);
+
+private:
+    // Kapalı çokgenden ortalanmış prizma - bSmoothSides: yan normaller komşu kenarların ortalaması (eğriler için)
+    static bool BuildPrism(TArrayView<const FVector2f> Outline, float Size, float Thickness, bool bSmoothSides, FMeshDescription& OutMesh);
+
+    int32 Width;
+    int32 Height;
+    TArray<uint32> Signatures;
+};
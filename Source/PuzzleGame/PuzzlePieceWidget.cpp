@@ -23,6 +23,14 @@ void UPuzzlePieceWidget::SetPieceMaterial(UMaterialInterface* Material)
     OnMaterialSet();
 }
 
+void UPuzzlePieceWidget::SetPieceThumbnail(UTexture2D* Thumbnail)
+{
+    PieceThumbnail = Thumbnail;
+
+    // Görünüm materyalle aynı Blueprint event'inde güncellenir
+    OnMaterialSet();
+}
+
 void UPuzzlePieceWidget::NativeConstruct()
 {
     Super::NativeConstruct();
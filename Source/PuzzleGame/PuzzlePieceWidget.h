@@ -6,6 +6,8 @@
 #include "Blueprint/UserWidget.h"
 #include "PuzzlePieceWidget.generated.h"
 
+class UTexture2D;
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPieceClicked, int32, PieceID);
 
 /**
@@ -36,6 +38,13 @@ public:
     // Get the material for this piece
     UFUNCTION(BlueprintPure, Category = "Puzzle")
     UMaterialInterface* GetPieceMaterial() const { return PieceMaterial; }
+
+    // İçe aktarılmış resimden mip'li küçük resim - varsa tepsi materyal yerine bunu çizebilir
+    UFUNCTION(BlueprintCallable, Category = "Puzzle")
+    void SetPieceThumbnail(UTexture2D* Thumbnail);
+
+    UFUNCTION(BlueprintPure, Category = "Puzzle")
+    UTexture2D* GetPieceThumbnail() const { return PieceThumbnail; }
     
     // Blueprint event to update button appearance
     UFUNCTION(BlueprintImplementableEvent, Category = "Puzzle")
@@ -71,4 +80,7 @@ private:
     
     UPROPERTY()
     UMaterialInterface* PieceMaterial;
+
+    UPROPERTY()
+    UTexture2D* PieceThumbnail;
 };
\ No newline at end of file
@@ -35,6 +35,10 @@ APuzzlePlayerController::APuzzlePlayerController()
     DragHeight = 50.0f;
     DragSmoothness = 20.0f; // Increased for more responsive dragging
 
+    // Selection settings
+    BoxSelectMinSize = 20.0f;
+    SelectionBox = nullptr;
+
     // Trace settings
     TraceDistance = 10000.0f;
     TraceChannel = ECC_Visibility; // Changed from WorldStatic to Visibility for better detection
@@ -42,7 +46,9 @@ APuzzlePlayerController::APuzzlePlayerController()
     // Internal state
     bIsDragging = false;
     bMousePressed = false;
+    bIsGroupDrag = false;
     CachedGameMode = nullptr;
+    BoxSelectStart = FVector::ZeroVector;
 
     CurrentMousePosition = FVector2D::ZeroVector;
     MouseWorldPosition = FVector::ZeroVector;
@@ -140,18 +146,45 @@ void APuzzlePlayerController::Tick(float DeltaTime)
     Super::Tick(DeltaTime);
 
     // Update mouse position every frame
+    const FVector2D PreviousMousePosition = CurrentMousePosition;
     UpdateMousePosition();
 
+    // Any input, interaction or UI animation keeps the game out of idle throttling
+    if (CachedGameMode)
+    {
+        float TouchX = 0.0f;
+        float TouchY = 0.0f;
+        bool bTouchPressed = false;
+        GetInputTouchState(ETouchIndex::Touch1, TouchX, TouchY, bTouchPressed);
+
+        const bool bWidgetAnimating = MainWidget && MainWidget->IsAnyAnimationPlaying();
+        if (bTouchPressed || bWidgetAnimating || bMousePressed ||
+            CurrentInteractionState != EMouseInteractionState::None ||
+            !PreviousMousePosition.Equals(CurrentMousePosition, 0.5f))
+        {
+            CachedGameMode->NotifyPlayerActivity();
+        }
+    }
+
     // Handle drag updates if dragging
     if (bIsDragging)
     {
         HandleDragUpdate();
     }
+    else if (CurrentInteractionState == EMouseInteractionState::BoxSelecting)
+    {
+        UpdateBoxSelection();
+    }
 }
 
 void APuzzlePlayerController::OnLeftClickPressed(const FInputActionValue& Value)
 {
     bMousePressed = true;
+
+    if (CachedGameMode)
+    {
+        CachedGameMode->NotifyPlayerActivity();
+    }
     
 
     if (CurrentInteractionState == EMouseInteractionState::None)
@@ -159,13 +192,66 @@ void APuzzlePlayerController::OnLeftClickPressed(const FInputActionValue& Value)
         // Check if we clicked a puzzle piece
         APuzzlePiece* ClickedPiece = GetPuzzlePieceUnderMouse();
 
+        // Frozen pieces have no actor - lifting one restores it
+        bool bLiftedFrozenPiece = false;
+        if (!ClickedPiece && CachedGameMode)
+        {
+            ClickedPiece = CachedGameMode->LiftFrozenPieceAt(GetMouseWorldLocation());
+            bLiftedFrozenPiece = ClickedPiece != nullptr;
+        }
+
+        // Sliding mode: a click slides the tile into the blank, pieces are never dragged
+        if (CachedGameMode && CachedGameMode->IsSlidingTileMode())
+        {
+            if (ClickedPiece)
+            {
+                CachedGameMode->StopSlidingAutoSolve();
+                CachedGameMode->SlideTile(CachedGameMode->GetGridIDOfPiece(ClickedPiece->GetPieceID()));
+            }
+            return;
+        }
+
         if (ClickedPiece)
         {
-            // Start dragging the piece
-            StartDragPiece(ClickedPiece);
+            PruneSelection();
+
+            if (IsMultiSelectModifierDown())
+            {
+                // Shift-click toggles the piece in the selection
+                if (SelectedPieces.Contains(ClickedPiece))
+                {
+                    RemovePieceFromSelection(ClickedPiece);
+                }
+                else
+                {
+                    AddPieceToSelection(ClickedPiece);
+                }
+            }
+            else if (SelectedPieces.Num() > 1 && SelectedPieces.Contains(ClickedPiece))
+            {
+                // Dragging a selected piece moves the whole selection
+                StartDragGroup(ClickedPiece);
+            }
+            else
+            {
+                ClearSelection();
+
+                // A lifted frozen piece leaves its cluster on its own, the rest stays frozen
+                // Pieces in a correctly assembled cluster move together
+                if (!bLiftedFrozenPiece && CachedGameMode && CachedGameMode->GetClusterPieces(ClickedPiece).Num() > 1)
+                {
+                    StartDragGroup(ClickedPiece);
+                }
+                else
+                {
+                    // Start dragging the piece
+                    StartDragPiece(ClickedPiece);
+                }
+            }
         }
         else
         {
+            StartBoxSelection();
         }
     }
 }
@@ -178,19 +264,43 @@ void APuzzlePlayerController::OnLeftClickReleased(const FInputActionValue& Value
     {
         EndDrag();
     }
+    else if (CurrentInteractionState == EMouseInteractionState::BoxSelecting)
+    {
+        EndBoxSelection();
+    }
 }
 
 void APuzzlePlayerController::OnRightClickPressed(const FInputActionValue& Value)
 {
+    if (CachedGameMode)
+    {
+        CachedGameMode->NotifyPlayerActivity();
+    }
+
     // Right click to deselect or cancel drag
-    if (CurrentInteractionState != EMouseInteractionState::None)
+    if (CurrentInteractionState == EMouseInteractionState::BoxSelecting)
+    {
+        CurrentInteractionState = EMouseInteractionState::None;
+        if (IsValid(SelectionBox))
+        {
+            SelectionBox->HideBox();
+        }
+    }
+    else if (CurrentInteractionState != EMouseInteractionState::None)
     {
         EndDrag();
     }
+
+    ClearSelection();
 }
 
 void APuzzlePlayerController::OnToggleUI(const FInputActionValue& Value)
 {
+    if (CachedGameMode)
+    {
+        CachedGameMode->NotifyPlayerActivity();
+    }
+
     ToggleMainWidget();
 }
 
@@ -266,6 +376,14 @@ void APuzzlePlayerController::StartDragPiece(APuzzlePiece* Piece)
     // Set piece as selected
     SelectedPiece->SetSelected(true);
 
+    // The dragged actor is drawn, so its cell on the board renderer shows empty until the drop
+    const int32 PieceGridID = CachedGameMode ? CachedGameMode->GetGridIDOfPiece(Piece->GetPieceID()) : -1;
+    if (PieceGridID >= 0)
+    {
+        DragHiddenGridIDs = { PieceGridID };
+        CachedGameMode->HideCellsOnBoard(DragHiddenGridIDs);
+    }
+
     // For UI spawned pieces, always use zero offset
     if (CurrentInteractionState == EMouseInteractionState::DraggingFromUI)
     {
@@ -303,6 +421,12 @@ void APuzzlePlayerController::EndDrag()
         return;
     }
 
+    if (bIsGroupDrag)
+    {
+        EndGroupDrag();
+        return;
+    }
+
     // Get the drop location
     FVector DropLocation = GetMouseWorldLocation();
     
@@ -315,7 +439,14 @@ void APuzzlePlayerController::EndDrag()
         TargetPiece = Cast<APuzzlePiece>(HitResult.GetActor());
     }
     
-    if (TargetPiece && TargetPiece != SelectedPiece)
+    if (CachedGameMode && CachedGameMode->IsFreePlacementMode())
+    {
+        // Free placement: the piece stays where it was dropped and only snaps to its true neighbours
+        // UI spawned pieces carry the invalid drag start location and are not counted as moves
+        const bool bIsNewPieceFromUI = DragStartLocation.Z < -9000.0f;
+        CachedGameMode->ReleaseFreePieces({ SelectedPiece }, !bIsNewPieceFromUI);
+    }
+    else if (TargetPiece && TargetPiece != SelectedPiece)
     {
         // Swap pieces using the new grid occupancy system
         
@@ -353,10 +484,8 @@ void APuzzlePlayerController::EndDrag()
             
             if (TargetGridID >= 0 && TargetGridID != StartGridID)
             {
-                // Check if target position is occupied
-                APuzzlePiece* OccupyingPiece = CachedGameMode->GetPieceAtGridID(TargetGridID);
-                
-                if (OccupyingPiece)
+                // Check if target position is occupied (the occupant may be streamed out)
+                if (CachedGameMode->IsGridCellOccupied(TargetGridID))
                 {
                     // Target is occupied - swap with it
                     CachedGameMode->SwapPiecesAtGridIDs(StartGridID, TargetGridID);
@@ -387,6 +516,9 @@ void APuzzlePlayerController::EndDrag()
                 // Dropped at same position - just snap back
                 FVector GridPosition = CachedGameMode->GetGridPositionFromID(TargetGridID);
                 SelectedPiece->MovePieceToLocation(GridPosition, false);
+
+                // A lifted frozen piece put back on its cell freezes again
+                CachedGameMode->SettleLiftedCells({ TargetGridID });
             }
         }
     }
@@ -395,6 +527,7 @@ void APuzzlePlayerController::EndDrag()
     SelectedPiece->SetSelected(false);
     OnPieceDeselected(SelectedPiece);
     OnDragEnded(SelectedPiece);
+    RestoreDragHiddenCells();
 
     SelectedPiece = nullptr;
     CurrentInteractionState = EMouseInteractionState::None;
@@ -427,10 +560,11 @@ void APuzzlePlayerController::UpdateDragPosition()
     TargetLocation.Z = DragHeight; // Keep at drag height
 
     // Direct set location during drag - no interpolation for immediate response
+    // Group members are attached to the grabbed piece, so this single update moves them all
     SelectedPiece->SetActorLocation(TargetLocation);
     
-    // Draw snap preview
-    if (CachedGameMode)
+    // Draw snap preview - free placement has no cells to snap to
+    if (CachedGameMode && !CachedGameMode->IsFreePlacementMode())
     {
         int32 GridID = CachedGameMode->GetGridIDFromPosition(TargetLocation);
         if (GridID >= 0)
@@ -465,6 +599,15 @@ bool APuzzlePlayerController::TraceUnderMouse(FHitResult& HitResult)
         QueryParams.AddIgnoredActor(SelectedPiece);
     }
 
+    // Group drag: ignore every dragged piece
+    if (bIsDragging && bIsGroupDrag)
+    {
+        for (APuzzlePiece* Piece : GroupDragPieces)
+        {
+            QueryParams.AddIgnoredActor(Piece);
+        }
+    }
+
     bool bHit = GetWorld()->LineTraceSingleByChannel(
         HitResult,
         Start,
@@ -676,6 +819,315 @@ void APuzzlePlayerController::HandleDragUpdate()
     }
 }
 
+void APuzzlePlayerController::StartDragGroup(APuzzlePiece* GrabbedPiece)
+{
+    if (!GrabbedPiece || !CachedGameMode || CurrentInteractionState != EMouseInteractionState::None)
+    {
+        return;
+    }
+
+    // Group = grabbed piece + selection, each expanded to its whole cluster.
+    // Cells come from the board so members in streamed-out chunks move too.
+    GroupDragPieces.Reset();
+    GroupStartGridIDs.Reset();
+    TArray<APuzzlePiece*> Seeds = GetSelectedPieces();
+    Seeds.AddUnique(GrabbedPiece);
+    for (APuzzlePiece* Seed : Seeds)
+    {
+        const int32 SeedGridID = CachedGameMode->GetGridIDOfPiece(Seed->GetPieceID());
+        if (SeedGridID >= 0)
+        {
+            for (int32 MemberGridID : CachedGameMode->GetClusterGridIDs(SeedGridID))
+            {
+                GroupStartGridIDs.AddUnique(MemberGridID);
+            }
+        }
+    }
+
+    // Frozen members get their actors back so the cluster moves as one piece
+    CachedGameMode->LiftFrozenCells(GroupStartGridIDs);
+    DragHiddenGridIDs = GroupStartGridIDs;
+    CachedGameMode->HideCellsOnBoard(DragHiddenGridIDs);
+
+    for (APuzzlePiece* Seed : Seeds)
+    {
+        for (APuzzlePiece* Member : CachedGameMode->GetClusterPieces(Seed))
+        {
+            GroupDragPieces.AddUnique(Member);
+        }
+    }
+
+    SelectedPiece = GrabbedPiece;
+    bIsDragging = true;
+    bIsGroupDrag = true;
+    CurrentInteractionState = EMouseInteractionState::DraggingPiece;
+
+    DragStartLocation = GrabbedPiece->GetActorLocation();
+    DragOffset = DragStartLocation - GetMouseWorldLocation();
+
+    // Attach members to the grabbed piece for one batched transform update
+    for (APuzzlePiece* Member : GroupDragPieces)
+    {
+        Member->SetSelected(true);
+
+        if (Member != GrabbedPiece)
+        {
+            Member->AttachToActor(GrabbedPiece, FAttachmentTransformRules::KeepWorldTransform);
+        }
+    }
+
+    OnDragStarted(SelectedPiece);
+
+    FInputModeGameOnly GameOnlyMode;
+    SetInputMode(GameOnlyMode);
+    bShowMouseCursor = true;
+}
+
+void APuzzlePlayerController::EndGroupDrag()
+{
+    bool bCommitted = false;
+
+    // Detach before committing so every piece snaps to its own cell
+    for (APuzzlePiece* Member : GroupDragPieces)
+    {
+        if (IsValid(Member) && Member != SelectedPiece)
+        {
+            Member->DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+        }
+    }
+
+    if (CachedGameMode && CachedGameMode->IsFreePlacementMode())
+    {
+        // Every dragged group is released where it lies and snapped to its neighbours
+        CachedGameMode->ReleaseFreePieces(GroupDragPieces, true);
+    }
+    else if (CachedGameMode)
+    {
+        const int32 Width = CachedGameMode->GetPuzzleWidth();
+        const int32 StartGridID = CachedGameMode->GetGridIDFromPosition(DragStartLocation);
+        const int32 DropGridID = CachedGameMode->GetGridIDFromPosition(SelectedPiece->GetActorLocation());
+
+        if (Width > 0 && StartGridID >= 0 && DropGridID >= 0 && StartGridID != DropGridID)
+        {
+            const int32 DeltaCol = DropGridID % Width - StartGridID % Width;
+            const int32 DeltaRow = DropGridID / Width - StartGridID / Width;
+
+            // Whole group commits as one move: one occupancy pass, one completion check, one stats broadcast
+            bCommitted = CachedGameMode->MovePieceGroup(GroupStartGridIDs, DeltaCol, DeltaRow);
+            if (bCommitted)
+            {
+                CachedGameMode->IncrementMoveCount();
+            }
+        }
+
+        if (!bCommitted)
+        {
+            // Lifted frozen members settle back into the batch
+            CachedGameMode->SettleLiftedCells(GroupStartGridIDs);
+
+            // Rejected (out of bounds or no movement) - snap everything back
+            for (APuzzlePiece* Member : GroupDragPieces)
+            {
+                const int32 StartCell = IsValid(Member) ? CachedGameMode->GetGridIDOfPiece(Member->GetPieceID()) : -1;
+                if (StartCell >= 0)
+                {
+                    Member->MovePieceToLocation(CachedGameMode->GetGridPositionFromID(StartCell), false);
+                }
+            }
+        }
+    }
+
+    OnDragEnded(SelectedPiece);
+    RestoreDragHiddenCells();
+
+    // Keep the explicit selection so it can be dragged again, release cluster-only members
+    for (APuzzlePiece* Member : GroupDragPieces)
+    {
+        if (IsValid(Member) && !SelectedPieces.Contains(Member))
+        {
+            Member->SetSelected(false);
+        }
+    }
+
+    SelectedPiece = nullptr;
+    CurrentInteractionState = EMouseInteractionState::None;
+    bIsDragging = false;
+    bIsGroupDrag = false;
+    DragOffset = FVector::ZeroVector;
+    GroupDragPieces.Reset();
+    GroupStartGridIDs.Reset();
+
+    if (MainWidget && MainWidget->IsInViewport())
+    {
+        FInputModeGameAndUI InputMode;
+        InputMode.SetWidgetToFocus(nullptr);
+        InputMode.SetLockMouseToViewportBehavior(EMouseLockMode::DoNotLock);
+        InputMode.SetHideCursorDuringCapture(false);
+        SetInputMode(InputMode);
+    }
+}
+
+void APuzzlePlayerController::RestoreDragHiddenCells()
+{
+    if (CachedGameMode && DragHiddenGridIDs.Num() > 0)
+    {
+        CachedGameMode->RestoreCellsOnBoard(DragHiddenGridIDs);
+    }
+    DragHiddenGridIDs.Reset();
+}
+
+void APuzzlePlayerController::AddPieceToSelection(APuzzlePiece* Piece)
+{
+    if (!Piece || SelectedPieces.Contains(Piece))
+    {
+        return;
+    }
+
+    SelectedPieces.Add(Piece);
+    Piece->SetSelected(true);
+    OnPieceSelected(Piece);
+    OnSelectionChanged(SelectedPieces.Num());
+}
+
+void APuzzlePlayerController::RemovePieceFromSelection(APuzzlePiece* Piece)
+{
+    if (!Piece || SelectedPieces.Remove(TWeakObjectPtr<APuzzlePiece>(Piece)) == 0)
+    {
+        return;
+    }
+
+    Piece->SetSelected(false);
+    OnPieceDeselected(Piece);
+    OnSelectionChanged(SelectedPieces.Num());
+}
+
+void APuzzlePlayerController::ClearSelection()
+{
+    if (SelectedPieces.Num() == 0)
+    {
+        return;
+    }
+
+    for (APuzzlePiece* Piece : GetSelectedPieces())
+    {
+        Piece->SetSelected(false);
+        OnPieceDeselected(Piece);
+    }
+
+    SelectedPieces.Reset();
+    OnSelectionChanged(0);
+}
+
+TArray<APuzzlePiece*> APuzzlePlayerController::GetSelectedPieces() const
+{
+    TArray<APuzzlePiece*> Pieces;
+    Pieces.Reserve(SelectedPieces.Num());
+    for (const TWeakObjectPtr<APuzzlePiece>& WeakPiece : SelectedPieces)
+    {
+        APuzzlePiece* Piece = WeakPiece.Get();
+        if (IsValid(Piece) && !Piece->IsHidden() && Piece->IsSelected())
+        {
+            Pieces.Add(Piece);
+        }
+    }
+    return Pieces;
+}
+
+void APuzzlePlayerController::PruneSelection()
+{
+    const int32 PreviousCount = SelectedPieces.Num();
+    SelectedPieces.RemoveAll([](const TWeakObjectPtr<APuzzlePiece>& WeakPiece)
+    {
+        const APuzzlePiece* Piece = WeakPiece.Get();
+        return !IsValid(Piece) || Piece->IsHidden() || !Piece->IsSelected();
+    });
+
+    if (SelectedPieces.Num() != PreviousCount)
+    {
+        OnSelectionChanged(SelectedPieces.Num());
+    }
+}
+
+bool APuzzlePlayerController::IsMultiSelectModifierDown() const
+{
+    return IsInputKeyDown(EKeys::LeftShift) || IsInputKeyDown(EKeys::RightShift);
+}
+
+void APuzzlePlayerController::StartBoxSelection()
+{
+    BoxSelectStart = GetMouseWorldLocation();
+    CurrentInteractionState = EMouseInteractionState::BoxSelecting;
+
+    if (!IsValid(SelectionBox))
+    {
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.Owner = this;
+        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        SelectionBox = GetWorld()->SpawnActor<APuzzleSelectionBox>(APuzzleSelectionBox::StaticClass(), FTransform::Identity, SpawnParams);
+    }
+}
+
+void APuzzlePlayerController::UpdateBoxSelection()
+{
+    // Show the selection rectangle on the board plane
+    if (IsValid(SelectionBox))
+    {
+        SelectionBox->ShowBox(BoxSelectStart, GetMouseWorldLocation());
+    }
+}
+
+void APuzzlePlayerController::EndBoxSelection()
+{
+    CurrentInteractionState = EMouseInteractionState::None;
+    if (IsValid(SelectionBox))
+    {
+        SelectionBox->HideBox();
+    }
+
+    const FVector Current = GetMouseWorldLocation();
+    const bool bAdditive = IsMultiSelectModifierDown();
+
+    // A plain click on empty space clears the selection
+    if (FVector::Dist2D(BoxSelectStart, Current) < BoxSelectMinSize)
+    {
+        if (!bAdditive)
+        {
+            ClearSelection();
+        }
+        return;
+    }
+
+    if (!bAdditive)
+    {
+        ClearSelection();
+    }
+
+    if (!CachedGameMode)
+    {
+        return;
+    }
+
+    const FBox2D SelectionArea(
+        FVector2D(FMath::Min(BoxSelectStart.X, Current.X), FMath::Min(BoxSelectStart.Y, Current.Y)),
+        FVector2D(FMath::Max(BoxSelectStart.X, Current.X), FMath::Max(BoxSelectStart.Y, Current.Y)));
+
+    // Batch add - a single selection event for the whole box
+    const int32 PreviousCount = SelectedPieces.Num();
+    for (APuzzlePiece* Piece : CachedGameMode->GetPuzzlePieces())
+    {
+        if (IsValid(Piece) && SelectionArea.IsInside(FVector2D(Piece->GetActorLocation())) && !SelectedPieces.Contains(Piece))
+        {
+            SelectedPieces.Add(Piece);
+            Piece->SetSelected(true);
+        }
+    }
+
+    if (SelectedPieces.Num() != PreviousCount)
+    {
+        OnSelectionChanged(SelectedPieces.Num());
+    }
+}
+
 APuzzleGameMode* APuzzlePlayerController::GetPuzzleGameMode()
 {
     if (!CachedGameMode)
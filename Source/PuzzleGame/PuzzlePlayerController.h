@@ -6,6 +6,7 @@
 #include "GameFramework/PlayerController.h"
 #include "PuzzlePiece.h"
 #include "PuzzleGameMode.h"
+#include "PuzzleSelectionBox.h"
 #include "Engine/Engine.h"
 #include "Blueprint/UserWidget.h"
 #include "EnhancedInputComponent.h"
@@ -20,7 +21,8 @@ enum class EMouseInteractionState : uint8
     None            UMETA(DisplayName = "None"),
     DraggingFromUI  UMETA(DisplayName = "Dragging From UI"),
     DraggingPiece   UMETA(DisplayName = "Dragging 3D Piece"),
-    Hovering        UMETA(DisplayName = "Hovering")
+    Hovering        UMETA(DisplayName = "Hovering"),
+    BoxSelecting    UMETA(DisplayName = "Box Selecting")
 };
 
 UCLASS()
@@ -44,6 +46,15 @@ protected:
     UPROPERTY(BlueprintReadOnly, Category = "Puzzle")
     APuzzlePiece* SelectedPiece;
 
+    // Multi selection (shift-click / box select)
+    // Weak - selected pieces can be destroyed or returned to the pool, see PruneSelection
+    UPROPERTY()
+    TArray<TWeakObjectPtr<APuzzlePiece>> SelectedPieces;
+
+    // Pieces moved by the current group drag (selection and/or clusters)
+    UPROPERTY(BlueprintReadOnly, Category = "Puzzle")
+    TArray<APuzzlePiece*> GroupDragPieces;
+
     // Enhanced Input System
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Enhanced Input")
     class UInputMappingContext* DefaultMappingContext;
@@ -81,6 +92,14 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Drag Settings")
     float DragSmoothness;
 
+    // Selection settings
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Selection")
+    float BoxSelectMinSize;
+
+    // Rectangle shown on the board while box selecting, spawned on first use
+    UPROPERTY(BlueprintReadOnly, Category = "Selection")
+    APuzzleSelectionBox* SelectionBox;
+
     // Line trace settings
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trace Settings")
     float TraceDistance;
@@ -115,6 +134,24 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Drag Drop")
     void UpdateDragPosition();
 
+    // Group drag - selected pieces and their clusters follow the grabbed one
+    UFUNCTION(BlueprintCallable, Category = "Drag Drop")
+    void StartDragGroup(APuzzlePiece* GrabbedPiece);
+
+    // Selection functions
+    UFUNCTION(BlueprintCallable, Category = "Selection")
+    void AddPieceToSelection(APuzzlePiece* Piece);
+
+    UFUNCTION(BlueprintCallable, Category = "Selection")
+    void RemovePieceFromSelection(APuzzlePiece* Piece);
+
+    UFUNCTION(BlueprintCallable, Category = "Selection")
+    void ClearSelection();
+
+    // Only pieces that are still alive, visible and selected
+    UFUNCTION(BlueprintPure, Category = "Selection")
+    TArray<APuzzlePiece*> GetSelectedPieces() const;
+
     // Line trace functions
     UFUNCTION(BlueprintCallable, Category = "Trace")
     bool TraceUnderMouse(FHitResult& HitResult);
@@ -158,12 +195,28 @@ public:
     UFUNCTION(BlueprintImplementableEvent, Category = "Events")
     void OnDragEnded(APuzzlePiece* Piece);
 
+    UFUNCTION(BlueprintImplementableEvent, Category = "Events")
+    void OnSelectionChanged(int32 NumSelected);
+
 protected:
     // Internal helper functions
     void UpdateMousePosition();
     void HandlePieceSelection();
     void HandleDragUpdate();
     APuzzleGameMode* GetPuzzleGameMode();
+
+    // Multi selection helpers
+    bool IsMultiSelectModifierDown() const;
+    void StartBoxSelection();
+    void UpdateBoxSelection();
+    void EndBoxSelection();
+    void EndGroupDrag();
+
+    // Rewrites the dragged cells on the board renderer from the current occupancy
+    void RestoreDragHiddenCells();
+
+    // Drops selection entries whose actor was destroyed, pooled or deselected by the game mode
+    void PruneSelection();
     
 public:
     // Debug commands
@@ -180,6 +233,16 @@ private:
     bool bIsDragging;
     bool bMousePressed;
 
+    // Group drag state
+    bool bIsGroupDrag;
+    TArray<int32> GroupStartGridIDs;
+
+    // Cells blanked on the board renderer while their pieces are dragged
+    TArray<int32> DragHiddenGridIDs;
+
+    // Box selection start on the Z=0 plane
+    FVector BoxSelectStart;
+
     // Reference caching
     APuzzleGameMode* CachedGameMode;
 };
\ No newline at end of file
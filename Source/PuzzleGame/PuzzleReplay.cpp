@@ -0,0 +1,309 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "PuzzleReplay.h"
+#include "PuzzleBoardTransaction.h"
+#include "PuzzleGame.h"
+#include "Misc/FileHelper.h"
+#include "JsonObjectConverter.h"
+
+template<typename BoardType>
+TPuzzleReplaySimulator<BoardType>::TPuzzleReplaySimulator(int32 InWidth, int32 InHeight)
+    : Width(InWidth)
+    , Height(InHeight)
+{
+    Board.Init(Width, Height);
+    SpawnedPieces.Init(false, Width * Height);
+}
+
+template<typename BoardType>
+void TPuzzleReplaySimulator<BoardType>::OccupyCell(int32 GridID, int32 PieceID)
+{
+    // Parçanın eski hücresini boşalt
+    const int32 OldCell = Board.FindPiece(PieceID);
+    if (OldCell >= 0 && OldCell != GridID)
+    {
+        Board.Set(OldCell, -1);
+    }
+
+    // Hedef hücredeki parça board dışında kalır (UpdateGridOccupancy ile aynı)
+    Board.Set(GridID, PieceID);
+}
+
+template<typename BoardType>
+bool TPuzzleReplaySimulator<BoardType>::ApplyMove(const FPuzzleReplayMove& Move, FString& OutError)
+{
+    switch (Move.Type)
+    {
+    case EPuzzleReplayMoveType::Spawn:
+    {
+        if (!IsValidPiece(Move.PieceID))
+        {
+            OutError = FString::Printf(TEXT("Spawn of invalid piece %d"), Move.PieceID);
+            return false;
+        }
+        if (SpawnedPieces[Move.PieceID])
+        {
+            OutError = FString::Printf(TEXT("Piece %d spawned twice"), Move.PieceID);
+            return false;
+        }
+        if (!IsValidCell(Move.ToGridID))
+        {
+            OutError = FString::Printf(TEXT("Spawn into invalid cell %d"), Move.ToGridID);
+            return false;
+        }
+
+        SpawnedPieces[Move.PieceID] = true;
+        OccupyCell(Move.ToGridID, Move.PieceID);
+        return true;
+    }
+
+    case EPuzzleReplayMoveType::Occupy:
+    {
+        if (!IsValidPiece(Move.PieceID) || !SpawnedPieces[Move.PieceID])
+        {
+            OutError = FString::Printf(TEXT("Move of unspawned piece %d"), Move.PieceID);
+            return false;
+        }
+        if (!IsValidCell(Move.ToGridID))
+        {
+            OutError = FString::Printf(TEXT("Move into invalid cell %d"), Move.ToGridID);
+            return false;
+        }
+
+        // Controller sadece boş hücreler için UpdateGridOccupancy çağırır
+        const int32 Occupant = Board.Get(Move.ToGridID);
+        if (Occupant >= 0 && Occupant != Move.PieceID)
+        {
+            OutError = FString::Printf(TEXT("Move into occupied cell %d"), Move.ToGridID);
+            return false;
+        }
+
+        OccupyCell(Move.ToGridID, Move.PieceID);
+        return true;
+    }
+
+    case EPuzzleReplayMoveType::Swap:
+    {
+        if (!IsValidCell(Move.FromGridID) || !IsValidCell(Move.ToGridID))
+        {
+            OutError = FString::Printf(TEXT("Swap between invalid cells %d and %d"), Move.FromGridID, Move.ToGridID);
+            return false;
+        }
+
+        const int32 Piece1 = Board.Get(Move.FromGridID);
+        const int32 Piece2 = Board.Get(Move.ToGridID);
+
+        // SwapPiecesAtGridIDs iki boş hücrede hiçbir şey yapmaz
+        if (Piece1 < 0 && Piece2 < 0)
+        {
+            OutError = FString::Printf(TEXT("Swap between empty cells %d and %d"), Move.FromGridID, Move.ToGridID);
+            return false;
+        }
+
+        Board.Swap(Move.FromGridID, Move.ToGridID);
+        return true;
+    }
+
+    case EPuzzleReplayMoveType::Group:
+    {
+        // Grup hamleleri seyrek - kural kontrolü TArray kopyası üzerinde
+        Board.CopyTo(ScratchOccupancy);
+
+        FPuzzleBoardTransaction Transaction;
+        if (!FPuzzleBoardTransaction::BuildGroupTranslation(Width, Height, ScratchOccupancy, Move.GroupGridIDs,
+            Move.DeltaCol, Move.DeltaRow, Transaction))
+        {
+            OutError = FString::Printf(TEXT("Illegal group move of %d cells by (%d, %d)"),
+                Move.GroupGridIDs.Num(), Move.DeltaCol, Move.DeltaRow);
+            return false;
+        }
+
+        for (const FPuzzleCellWrite& Write : Transaction.CellWrites)
+        {
+            Board.Set(Write.GridID, Write.PieceID);
+        }
+        return true;
+    }
+
+    case EPuzzleReplayMoveType::Pause:
+    case EPuzzleReplayMoveType::Resume:
+        // Board'u değiştirmez, sayım kuralları validator'da
+        return true;
+    }
+
+    OutError = TEXT("Unknown move type");
+    return false;
+}
+
+template class TPuzzleReplaySimulator<FPuzzleGenericBoard>;
+
+FPuzzleReplayVerdict FPuzzleReplayValidator::Validate(const FPuzzleReplayRecord& Record)
+{
+    FPuzzleReplayVerdict Verdict;
+
+    if (Record.Version != FPuzzleReplayRecord::CurrentVersion)
+    {
+        Verdict.Reason = FString::Printf(TEXT("Unsupported replay version %d"), Record.Version);
+        return Verdict;
+    }
+
+    if (Record.PuzzleWidth <= 0 || Record.PuzzleHeight <= 0 ||
+        (int64)Record.PuzzleWidth * (int64)Record.PuzzleHeight > MaxCells)
+    {
+        Verdict.Reason = FString::Printf(TEXT("Invalid board size %dx%d"), Record.PuzzleWidth, Record.PuzzleHeight);
+        return Verdict;
+    }
+
+    int32 CountedMoves = 0;
+    float LastTime = 0.0f;
+
+    // 6x6'ya kadar board'lar bit-paketli simülatörde oynatılır
+    const bool bSimulated = DispatchPuzzleBoard(Record.PuzzleWidth, Record.PuzzleHeight, [&](auto EmptyBoard) -> bool
+    {
+        TPuzzleReplaySimulator<decltype(EmptyBoard)> Simulator(Record.PuzzleWidth, Record.PuzzleHeight);
+
+        int32 LastSpawnedPiece = -1;
+        bool bSpawnSettled = true;
+        bool bPaused = false;
+
+        for (int32 MoveIndex = 0; MoveIndex < Record.Moves.Num(); MoveIndex++)
+        {
+            const FPuzzleReplayMove& Move = Record.Moves[MoveIndex];
+            Verdict.FailedMoveIndex = MoveIndex;
+
+            if (!FMath::IsFinite(Move.Time) || Move.Time < LastTime)
+            {
+                Verdict.Reason = FString::Printf(TEXT("Non-monotonic timestamp %.3f"), Move.Time);
+                return false;
+            }
+            LastTime = Move.Time;
+
+            // Duraklatılmışken tamamlanan board devam edilince sayılan hamleyle bitirilir
+            if (Simulator.IsComplete() && Move.Type != EPuzzleReplayMoveType::Resume)
+            {
+                Verdict.Reason = TEXT("Moves recorded after the puzzle was complete");
+                return false;
+            }
+
+            if (Move.Type == EPuzzleReplayMoveType::Pause || Move.Type == EPuzzleReplayMoveType::Resume)
+            {
+                const bool bPause = Move.Type == EPuzzleReplayMoveType::Pause;
+                if (Move.bCounted || bPaused == bPause)
+                {
+                    Verdict.Reason = bPause ? TEXT("Unexpected pause") : TEXT("Resume without a pause");
+                    return false;
+                }
+                bPaused = bPause;
+            }
+            else if (Move.Type == EPuzzleReplayMoveType::Spawn)
+            {
+                if (Move.bCounted)
+                {
+                    Verdict.Reason = TEXT("Spawn counted as a move");
+                    return false;
+                }
+            }
+            else if (Move.bCounted)
+            {
+                if (bPaused)
+                {
+                    Verdict.Reason = TEXT("Move counted while the game was paused");
+                    return false;
+                }
+                CountedMoves++;
+                bSpawnSettled = true;
+            }
+            else if (bPaused)
+            {
+                // PauseGame'den sonra IncrementMoveCount hamle saymaz - board yine de değişir
+                bSpawnSettled = true;
+            }
+            else
+            {
+                // Sayılmayan hamle sadece yeni spawn edilen parçanın ilk bırakılması olabilir
+                const bool bInvolvesSpawned = Move.Type == EPuzzleReplayMoveType::Occupy
+                    ? Move.PieceID == LastSpawnedPiece
+                    : Simulator.GetOccupant(Move.FromGridID) == LastSpawnedPiece ||
+                      Simulator.GetOccupant(Move.ToGridID) == LastSpawnedPiece;
+
+                if (bSpawnSettled || !bInvolvesSpawned)
+                {
+                    Verdict.Reason = TEXT("Uncounted move that is not an initial placement");
+                    return false;
+                }
+                bSpawnSettled = true;
+            }
+
+            FString Error;
+            if (!Simulator.ApplyMove(Move, Error))
+            {
+                Verdict.Reason = Error;
+                return false;
+            }
+
+            if (Move.Type == EPuzzleReplayMoveType::Spawn)
+            {
+                LastSpawnedPiece = Move.PieceID;
+                bSpawnSettled = false;
+            }
+
+            Verdict.SimulatedMoves++;
+        }
+
+        Verdict.FailedMoveIndex = -1;
+
+        if (!Simulator.IsComplete())
+        {
+            Verdict.Reason = TEXT("Final board state is not complete");
+            return false;
+        }
+
+        return true;
+    });
+
+    if (!bSimulated)
+    {
+        return Verdict;
+    }
+
+    if (CountedMoves != Record.ClaimedTotalMoves)
+    {
+        Verdict.Reason = FString::Printf(TEXT("Claimed %d moves but log contains %d"), Record.ClaimedTotalMoves, CountedMoves);
+        return Verdict;
+    }
+
+    // GameTime tam saniyelerle ilerler, tamamlanma anında timer durur
+    const float ExpectedGameTime = FMath::FloorToFloat(LastTime);
+    if (!FMath::IsFinite(Record.ClaimedGameTime) ||
+        FMath::Frac(Record.ClaimedGameTime) != 0.0f ||
+        FMath::Abs(Record.ClaimedGameTime - ExpectedGameTime) > GameTimeToleranceSeconds)
+    {
+        Verdict.Reason = FString::Printf(TEXT("Claimed game time %.2f does not match log (%.2f)"), Record.ClaimedGameTime, ExpectedGameTime);
+        return Verdict;
+    }
+
+    Verdict.bValid = true;
+    return Verdict;
+}
+
+bool FPuzzleReplayValidator::SaveRecordToFile(const FPuzzleReplayRecord& Record, const FString& FilePath)
+{
+    FString JsonString;
+    if (!FJsonObjectConverter::UStructToJsonObjectString(Record, JsonString))
+    {
+        return false;
+    }
+
+    return FFileHelper::SaveStringToFile(JsonString, *FilePath);
+}
+
+bool FPuzzleReplayValidator::LoadRecordFromFile(const FString& FilePath, FPuzzleReplayRecord& OutRecord)
+{
+    FString JsonString;
+    if (!FFileHelper::LoadFileToString(JsonString, *FilePath))
+    {
+        return false;
+    }
+
+    return FJsonObjectConverter::JsonObjectStringToUStruct(JsonString, &OutRecord);
+}
@@ -0,0 +1,180 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PuzzleSmallBoard.h"
+#include "PuzzleReplay.generated.h"
+
+// Replay log'undaki bir board işleminin tipi
+UENUM(BlueprintType)
+enum class EPuzzleReplayMoveType : uint8
+{
+    Spawn   UMETA(DisplayName = "Spawn"),   // SpawnPuzzlePiece - tray'den ilk yerleştirme
+    Occupy  UMETA(DisplayName = "Occupy"),  // UpdateGridOccupancy - boş hücreye taşıma
+    Swap    UMETA(DisplayName = "Swap"),    // SwapPiecesAtGridIDs
+    Group   UMETA(DisplayName = "Group"),   // MovePieceGroup - tek hamlelik toplu taşıma
+    Pause   UMETA(DisplayName = "Pause"),   // PauseGame - devam edene kadar hamleler sayılmaz
+    Resume  UMETA(DisplayName = "Resume")   // ResumeGame
+};
+
+// Tek bir kayıtlı board işlemi
+USTRUCT(BlueprintType)
+struct PUZZLEGAME_API FPuzzleReplayMove
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    EPuzzleReplayMoveType Type = EPuzzleReplayMoveType::Spawn;
+
+    // Spawn/Occupy için taşınan parça, Swap için kullanılmaz
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    int32 PieceID = -1;
+
+    // Swap için ilk hücre, diğer tiplerde -1
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    int32 FromGridID = -1;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    int32 ToGridID = -1;
+
+    // Group için taşınan hücreler ve öteleme
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    TArray<int32> GroupGridIDs;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    int32 DeltaCol = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    int32 DeltaRow = 0;
+
+    // Hamlenin IncrementMoveCount ile sayılıp sayılmadığı
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    bool bCounted = false;
+
+    // StartGame'den itibaren geçen oyun süresi (saniye)
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    float Time = 0.0f;
+
+    // Spawn ve duraklatma kayıtları IncrementMoveCount ile sayılamaz
+    bool IsCountable() const
+    {
+        return Type != EPuzzleReplayMoveType::Spawn && Type != EPuzzleReplayMoveType::Pause && Type != EPuzzleReplayMoveType::Resume;
+    }
+};
+
+// Leaderboard'a gönderilen tam oturum kaydı
+USTRUCT(BlueprintType)
+struct PUZZLEGAME_API FPuzzleReplayRecord
+{
+    GENERATED_BODY()
+
+    static constexpr int32 CurrentVersion = 1;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    int32 Version = CurrentVersion;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    int32 PuzzleWidth = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    int32 PuzzleHeight = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    TArray<FPuzzleReplayMove> Moves;
+
+    // Oyuncunun bildirdiği sonuçlar - validator bunları yeniden hesaplar
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    int32 ClaimedTotalMoves = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Replay")
+    float ClaimedGameTime = 0.0f;
+
+    void Reset(int32 InWidth, int32 InHeight)
+    {
+        Version = CurrentVersion;
+        PuzzleWidth = InWidth;
+        PuzzleHeight = InHeight;
+        Moves.Reset();
+        ClaimedTotalMoves = 0;
+        ClaimedGameTime = 0.0f;
+    }
+};
+
+// Tek bir replay doğrulamasının sonucu
+struct PUZZLEGAME_API FPuzzleReplayVerdict
+{
+    bool bValid = false;
+
+    // Hatanın oluştuğu hamle indeksi (-1: hamleye bağlı değil)
+    int32 FailedMoveIndex = -1;
+
+    FString Reason;
+
+    int32 SimulatedMoves = 0;
+};
+
+/**
+ * Headless board simulation that mirrors the occupancy rules of
+ * APuzzleGameMode::SpawnPuzzlePiece, UpdateGridOccupancy, SwapPiecesAtGridIDs and MovePieceGroup.
+ * Has no UObject or world dependency, so it is safe to run on worker threads.
+ *
+ * BoardType is a TPuzzleSmallBoard specialization or FPuzzleGenericBoard (see
+ * DispatchPuzzleBoard); members are defined and instantiated in PuzzleReplay.cpp.
+ */
+template<typename BoardType>
+class TPuzzleReplaySimulator
+{
+public:
+    TPuzzleReplaySimulator(int32 InWidth, int32 InHeight);
+
+    // Tek bir işlemi uygular, kural dışıysa false döner
+    bool ApplyMove(const FPuzzleReplayMove& Move, FString& OutError);
+
+    bool IsComplete() const { return Board.IsSolved(); }
+
+    int32 GetNumCells() const { return Board.GetNumCells(); }
+
+    // Geçersiz hücre için -1
+    int32 GetOccupant(int32 GridID) const { return IsValidCell(GridID) ? Board.Get(GridID) : -1; }
+
+private:
+    bool IsValidCell(int32 GridID) const { return GridID >= 0 && GridID < Board.GetNumCells(); }
+    bool IsValidPiece(int32 PieceID) const { return PieceID >= 0 && PieceID < Board.GetNumCells(); }
+
+    // UpdateGridOccupancy ile aynı semantik
+    void OccupyCell(int32 GridID, int32 PieceID);
+
+    int32 Width;
+    int32 Height;
+
+    // GridID -> PieceID (-1 boş); board dışındaki parçaların hücresi yoktur
+    BoardType Board;
+
+    TBitArray<> SpawnedPieces;
+
+    // Grup hamlesi için TArray kopyası
+    TArray<int32> ScratchOccupancy;
+};
+
+using FPuzzleReplaySimulator = TPuzzleReplaySimulator<FPuzzleGenericBoard>;
+
+/**
+ * Re-simulates a recorded session and checks that every move is legal, that the final
+ * board is complete and that the claimed TotalMoves/GameTime match the log. Moves made
+ * between Pause and Resume entries are legal but must be uncounted, as in the game.
+ */
+class PUZZLEGAME_API FPuzzleReplayValidator
+{
+public:
+    // Timer 1 saniyelik tick'lerle ilerlediği için kabul edilen sapma
+    static constexpr float GameTimeToleranceSeconds = 1.0f;
+
+    // Kötü niyetli kayıtlara karşı üst sınır
+    static constexpr int32 MaxCells = 16 * 1024 * 1024;
+
+    static FPuzzleReplayVerdict Validate(const FPuzzleReplayRecord& Record);
+
+    static bool SaveRecordToFile(const FPuzzleReplayRecord& Record, const FString& FilePath);
+    static bool LoadRecordFromFile(const FString& FilePath, FPuzzleReplayRecord& OutRecord);
+};
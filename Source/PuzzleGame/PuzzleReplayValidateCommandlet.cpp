@@ -0,0 +1,112 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "PuzzleReplayValidateCommandlet.h"
+#include "PuzzleReplay.h"
+#include "PuzzleGame.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Async/ParallelFor.h"
+
+UPuzzleReplayValidateCommandlet::UPuzzleReplayValidateCommandlet()
+{
+    // Rendering veya client/server gerektirmez
+    IsClient = false;
+    IsServer = false;
+    IsEditor = false;
+    LogToConsole = true;
+    ShowErrorCount = true;
+}
+
+int32 UPuzzleReplayValidateCommandlet::Main(const FString& Params)
+{
+    // Fixture modunda dosya adı beklenen sonucu taşır
+    const bool bFixtures = FParse::Param(*Params, TEXT("Fixtures"));
+
+    FString ReplayDir;
+    if (!FParse::Value(*Params, TEXT("ReplayDir="), ReplayDir))
+    {
+        ReplayDir = bFixtures
+            ? FPaths::ProjectDir() / TEXT("Tests") / TEXT("ReplayFixtures")
+            : FPaths::ProjectSavedDir() / TEXT("Replays");
+    }
+
+    FString OutputPath;
+    if (!FParse::Value(*Params, TEXT("Output="), OutputPath))
+    {
+        OutputPath = ReplayDir / TEXT("ValidationResults.csv");
+    }
+
+    TArray<FString> ReplayFiles;
+    IFileManager::Get().FindFiles(ReplayFiles, *(ReplayDir / TEXT("*.json")), true, false);
+    ReplayFiles.Sort();
+
+    if (ReplayFiles.Num() == 0)
+    {
+        UE_LOG(LogPuzzleGame, Warning, TEXT("No replays found in %s"), *ReplayDir);
+        return 1;
+    }
+
+    TArray<FPuzzleReplayVerdict> Verdicts;
+    Verdicts.SetNum(ReplayFiles.Num());
+
+    const double StartTime = FPlatformTime::Seconds();
+
+    // Her replay bağımsız - tüm çekirdeklere dağıt
+    ParallelFor(ReplayFiles.Num(), [&ReplayDir, &ReplayFiles, &Verdicts](int32 Index)
+    {
+        FPuzzleReplayRecord Record;
+        if (!FPuzzleReplayValidator::LoadRecordFromFile(ReplayDir / ReplayFiles[Index], Record))
+        {
+            Verdicts[Index].Reason = TEXT("Could not parse replay file");
+            return;
+        }
+
+        Verdicts[Index] = FPuzzleReplayValidator::Validate(Record);
+    });
+
+    const double ElapsedSeconds = FMath::Max(FPlatformTime::Seconds() - StartTime, SMALL_NUMBER);
+
+    int32 ValidRuns = 0;
+    int32 FixtureMismatches = 0;
+    int64 TotalSimulatedMoves = 0;
+
+    FString Report = TEXT("File,Valid,FailedMoveIndex,SimulatedMoves,Reason\n");
+    for (int32 Index = 0; Index < ReplayFiles.Num(); Index++)
+    {
+        const FPuzzleReplayVerdict& Verdict = Verdicts[Index];
+        if (Verdict.bValid)
+        {
+            ValidRuns++;
+        }
+        TotalSimulatedMoves += Verdict.SimulatedMoves;
+
+        Report += FString::Printf(TEXT("%s,%s,%d,%d,\"%s\"\n"),
+            *ReplayFiles[Index],
+            Verdict.bValid ? TEXT("true") : TEXT("false"),
+            Verdict.FailedMoveIndex,
+            Verdict.SimulatedMoves,
+            *Verdict.Reason.Replace(TEXT("\""), TEXT("'")));
+
+        UE_LOG(LogPuzzleGame, Display, TEXT("%s: %s %s"), *ReplayFiles[Index],
+            Verdict.bValid ? TEXT("VALID") : TEXT("REJECTED"), *Verdict.Reason);
+
+        if (bFixtures && Verdict.bValid != ReplayFiles[Index].StartsWith(TEXT("Valid_")))
+        {
+            UE_LOG(LogPuzzleGame, Error, TEXT("Fixture %s got the wrong verdict"), *ReplayFiles[Index]);
+            FixtureMismatches++;
+        }
+    }
+
+    FFileHelper::SaveStringToFile(Report, *OutputPath);
+
+    UE_LOG(LogPuzzleGame, Display, TEXT("Validated %d runs (%d valid, %d rejected) in %.3f s"),
+        ReplayFiles.Num(), ValidRuns, ReplayFiles.Num() - ValidRuns, ElapsedSeconds);
+    UE_LOG(LogPuzzleGame, Display, TEXT("Throughput: %.1f runs/s, %.1f moves/s on %d workers"),
+        ReplayFiles.Num() / ElapsedSeconds, TotalSimulatedMoves / ElapsedSeconds,
+        FPlatformMisc::NumberOfWorkerThreadsToSpawn());
+    UE_LOG(LogPuzzleGame, Display, TEXT("Verdicts written to %s"), *OutputPath);
+
+    return FixtureMismatches > 0 ? 1 : 0;
+}
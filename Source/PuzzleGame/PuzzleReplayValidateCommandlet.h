@@ -0,0 +1,27 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "PuzzleReplayValidateCommandlet.generated.h"
+
+/**
+ * Headless leaderboard validator. Re-simulates every replay in a directory in parallel
+ * and writes a per-run verdict plus throughput stats.
+ *
+ * Usage: UnrealEditor-Cmd PuzzleGame.uproject -run=PuzzleReplayValidate -ReplayDir=<dir> [-Output=<csv>] -nullrhi
+ *
+ * With -Fixtures the directory defaults to Tests/ReplayFixtures and every file must get the
+ * verdict its name promises (Valid_* accepted, Reject_* rejected); any mismatch fails the run.
+ */
+UCLASS()
+class PUZZLEGAME_API UPuzzleReplayValidateCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UPuzzleReplayValidateCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
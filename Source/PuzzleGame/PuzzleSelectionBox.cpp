@@ -0,0 +1,72 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "PuzzleSelectionBox.h"
+#include "Engine/StaticMesh.h"
+#include "UObject/ConstructorHelpers.h"
+
+APuzzleSelectionBox::APuzzleSelectionBox()
+{
+    PrimaryActorTick.bCanEverTick = false;
+
+    BoxQuad = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("BoxQuad"));
+    RootComponent = BoxQuad;
+
+    // Kutu tıklamaları ve parça trace'lerini engellememeli
+    BoxQuad->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    BoxQuad->SetCastShadow(false);
+    BoxQuad->SetReceivesDecals(false);
+    BoxQuad->SetVisibility(false);
+
+    static ConstructorHelpers::FObjectFinder<UStaticMesh> PlaneMeshFinder(TEXT("/Engine/BasicShapes/Plane"));
+    if (PlaneMeshFinder.Succeeded())
+    {
+        BoxQuad->SetStaticMesh(PlaneMeshFinder.Object);
+    }
+
+    static ConstructorHelpers::FObjectFinder<UMaterialInterface> BoxMaterialFinder(TEXT("/Engine/EngineMaterials/Widget3DPassThrough_Translucent"));
+    BoxMaterial = BoxMaterialFinder.Succeeded() ? BoxMaterialFinder.Object : nullptr;
+
+    TextureParameterName = TEXT("SlateUI");
+    BoxColor = FColor(0, 255, 255, 64);
+    BoxHeight = 60.0f;
+    BoxMaterialInstance = nullptr;
+}
+
+bool APuzzleSelectionBox::InitializeMaterial()
+{
+    if (BoxMaterialInstance)
+    {
+        return true;
+    }
+    if (!BoxMaterial || !ColorTexture.Initialize(1, 1, PF_B8G8R8A8, BoxColor))
+    {
+        return false;
+    }
+
+    BoxMaterialInstance = UMaterialInstanceDynamic::Create(BoxMaterial, this);
+    BoxMaterialInstance->SetTextureParameterValue(TextureParameterName, ColorTexture.GetTexture());
+    BoxQuad->SetMaterial(0, BoxMaterialInstance);
+
+    ColorTexture.Flush();
+    return true;
+}
+
+void APuzzleSelectionBox::ShowBox(const FVector& CornerA, const FVector& CornerB)
+{
+    if (!InitializeMaterial())
+    {
+        return;
+    }
+
+    // Engine plane 100x100 birim - sıfır boyutlu ölçek görünmez ama geçerli kalır
+    const FVector Center = (CornerA + CornerB) * 0.5f;
+    SetActorLocation(FVector(Center.X, Center.Y, BoxHeight));
+    SetActorScale3D(FVector(FMath::Max(FMath::Abs(CornerB.X - CornerA.X), 1.0f) / 100.0f,
+        FMath::Max(FMath::Abs(CornerB.Y - CornerA.Y), 1.0f) / 100.0f, 1.0f));
+    BoxQuad->SetVisibility(true);
+}
+
+void APuzzleSelectionBox::HideBox()
+{
+    BoxQuad->SetVisibility(false);
+}
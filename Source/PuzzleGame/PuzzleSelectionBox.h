@@ -0,0 +1,57 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "Components/StaticMeshComponent.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "PuzzleCellTexture.h"
+#include "PuzzleSelectionBox.generated.h"
+
+/**
+ * Translucent rectangle drawn over the board while a box selection is dragged.
+ * One plane scaled to the box corners; its colour is a single texel, so moving
+ * the mouse only changes the actor transform.
+ */
+UCLASS()
+class PUZZLEGAME_API APuzzleSelectionBox : public AActor
+{
+    GENERATED_BODY()
+
+public:
+    APuzzleSelectionBox();
+
+    // İki köşe arasındaki dikdörtgeni board düzleminde göster
+    void ShowBox(const FVector& CornerA, const FVector& CornerB);
+
+    void HideBox();
+
+protected:
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+    UStaticMeshComponent* BoxQuad;
+
+    // Varsayılan engine'in widget pass-through materyali, texture parametresi SlateUI
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Selection")
+    UMaterialInterface* BoxMaterial;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Selection")
+    FName TextureParameterName;
+
+    // Alfa kutunun saydamlığı
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Selection")
+    FColor BoxColor;
+
+    // Parçaların üstünde kalacak yükseklik
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Selection")
+    float BoxHeight;
+
+    UPROPERTY()
+    UMaterialInstanceDynamic* BoxMaterialInstance;
+
+private:
+    // Renk texture'ı ilk gösterimde kurulur
+    bool InitializeMaterial();
+
+    TPuzzleCellTexture<FColor> ColorTexture;
+};
@@ -0,0 +1,283 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "PuzzleShuffleGenerator.h"
+#include "Async/ParallelFor.h"
+#include "Algo/UpperBound.h"
+
+namespace PuzzleShuffle
+{
+    // Blok sayısı en fazla bu kadar - kova kimliği uint16'ya sığar
+    constexpr int32 MaxBlocks = 4096;
+    constexpr int32 MinBlockSize = 64 * 1024;
+
+    // Farklı aşamalar aynı seed'den bağımsız akışlar alır
+    enum ESalt : int32
+    {
+        ScatterSalt = 0x5C47,
+        BucketSalt = 0xB0C7,
+        CycleSalt = 0xC1C1
+    };
+
+    int32 StreamSeed(int32 Seed, int32 Salt, int32 Index)
+    {
+        return (int32)HashCombine(HashCombine(GetTypeHash(Seed), GetTypeHash(Salt)), GetTypeHash(Index));
+    }
+
+    void FisherYates(int32* Values, int32 Num, FRandomStream& Stream)
+    {
+        for (int32 i = Num - 1; i > 0; i--)
+        {
+            Swap(Values[i], Values[Stream.RandHelper(i + 1)]);
+        }
+    }
+}
+
+void FPuzzleShuffleGenerator::ParallelShuffle(TArray<int32>& Values, int32 Seed)
+{
+    using namespace PuzzleShuffle;
+
+    const int32 Num = Values.Num();
+    const int32 BlockSize = FMath::Max(MinBlockSize, FMath::DivideAndRoundUp(Num, MaxBlocks));
+    const int32 NumBlocks = FMath::DivideAndRoundUp(Num, BlockSize);
+
+    if (NumBlocks <= 1)
+    {
+        FRandomStream Stream(StreamSeed(Seed, BucketSalt, 0));
+        FisherYates(Values.GetData(), Num, Stream);
+        return;
+    }
+
+    // 1) Her eleman rastgele bir kovaya - blok başına ayrı akış
+    const int32 NumBuckets = NumBlocks;
+    TArray<uint16> BucketOf;
+    BucketOf.SetNumUninitialized(Num);
+    TArray<int32> Counts;
+    Counts.Init(0, NumBlocks * NumBuckets);
+
+    ParallelFor(NumBlocks, [&](int32 Block)
+    {
+        FRandomStream Stream(StreamSeed(Seed, ScatterSalt, Block));
+        int32* BlockCounts = Counts.GetData() + Block * NumBuckets;
+        const int32 End = FMath::Min(Num, (Block + 1) * BlockSize);
+        for (int32 i = Block * BlockSize; i < End; i++)
+        {
+            const int32 Bucket = Stream.RandHelper(NumBuckets);
+            BucketOf[i] = (uint16)Bucket;
+            BlockCounts[Bucket]++;
+        }
+    });
+
+    // 2) Kova-öncelikli ofsetler - her (blok, kova) çifti kendi aralığına yazar
+    TArray<int32> Offsets;
+    Offsets.SetNumUninitialized(NumBlocks * NumBuckets);
+    TArray<int32> BucketStarts;
+    BucketStarts.SetNumUninitialized(NumBuckets + 1);
+
+    int32 Running = 0;
+    for (int32 Bucket = 0; Bucket < NumBuckets; Bucket++)
+    {
+        BucketStarts[Bucket] = Running;
+        for (int32 Block = 0; Block < NumBlocks; Block++)
+        {
+            Offsets[Block * NumBuckets + Bucket] = Running;
+            Running += Counts[Block * NumBuckets + Bucket];
+        }
+    }
+    BucketStarts[NumBuckets] = Running;
+
+    TArray<int32> Scattered;
+    Scattered.SetNumUninitialized(Num);
+
+    ParallelFor(NumBlocks, [&](int32 Block)
+    {
+        int32* BlockOffsets = Offsets.GetData() + Block * NumBuckets;
+        const int32 End = FMath::Min(Num, (Block + 1) * BlockSize);
+        for (int32 i = Block * BlockSize; i < End; i++)
+        {
+            Scattered[BlockOffsets[BucketOf[i]]++] = Values[i];
+        }
+    });
+
+    // 3) Kova içi karıştırma
+    ParallelFor(NumBuckets, [&](int32 Bucket)
+    {
+        FRandomStream Stream(StreamSeed(Seed, BucketSalt, Bucket));
+        FisherYates(Scattered.GetData() + BucketStarts[Bucket], BucketStarts[Bucket + 1] - BucketStarts[Bucket], Stream);
+    });
+
+    Values = MoveTemp(Scattered);
+}
+
+void FPuzzleShuffleGenerator::ResolveTargets(int32 NumCells, const FPuzzleShuffleSettings& Settings, int32& OutCorrect, int32& OutCycles)
+{
+    int32 Correct = Settings.TargetCorrectPieces;
+    int32 Cycles = Settings.TargetCycles;
+
+    if (Settings.TargetMinSwaps >= 0)
+    {
+        // MinSwaps = yanlış parça - döngü
+        const int32 MinSwaps = FMath::Min(Settings.TargetMinSwaps, FMath::Max(NumCells - 1, 0));
+        if (Correct >= 0)
+        {
+            Correct = FMath::Clamp(Correct, 0, NumCells);
+            Cycles = (NumCells - Correct) - MinSwaps;
+        }
+        else
+        {
+            Cycles = MinSwaps > 0 ? FMath::Max(Cycles, 1) : 0;
+            Correct = NumCells - (MinSwaps + Cycles);
+            if (Correct < 0)
+            {
+                Correct = 0;
+                Cycles = NumCells - MinSwaps;
+            }
+        }
+    }
+    else
+    {
+        Correct = FMath::Max(Correct, 0);
+        const int32 Misplaced = NumCells - FMath::Min(Correct, NumCells);
+
+        // Rastgele permütasyondaki gibi ~ln(M) döngü
+        if (Cycles < 0)
+        {
+            Cycles = FMath::Max(1, FMath::RoundToInt(FMath::Loge((float)FMath::Max(Misplaced, 1))));
+        }
+    }
+
+    // Tek yanlış parça döngü kuramaz
+    Correct = FMath::Clamp(Correct, 0, NumCells);
+    int32 Misplaced = NumCells - Correct;
+    if (Misplaced == 1)
+    {
+        Correct += Correct > 0 ? -1 : 1;
+        Misplaced = NumCells - Correct;
+    }
+
+    OutCorrect = Correct;
+    OutCycles = Misplaced == 0 ? 0 : FMath::Clamp(Cycles, 1, Misplaced / 2);
+}
+
+void FPuzzleShuffleGenerator::PickCycleStarts(int32 FirstIndex, int32 NumMisplaced, int32 NumCycles, int32 Seed, TArray<int32>& OutStarts)
+{
+    OutStarts.Reset(NumCycles + 1);
+    OutStarts.Add(FirstIndex);
+
+    // Uzunluk = 2 + ek; ekler (M - 2K) yıldız ve (K - 1) çubuğun rastgele dizilimi (Knuth S)
+    FRandomStream Stream(PuzzleShuffle::StreamSeed(Seed, PuzzleShuffle::CycleSalt, 0));
+    const int32 Slots = NumMisplaced - NumCycles - 1;
+    int32 BarsLeft = NumCycles - 1;
+    int32 Extra = 0;
+    int32 Cursor = FirstIndex;
+
+    for (int32 Slot = 0; Slot < Slots && BarsLeft > 0; Slot++)
+    {
+        if (Stream.RandHelper(Slots - Slot) < BarsLeft)
+        {
+            Cursor += 2 + Extra;
+            OutStarts.Add(Cursor);
+            Extra = 0;
+            BarsLeft--;
+        }
+        else
+        {
+            Extra++;
+        }
+    }
+
+    OutStarts.Add(FirstIndex + NumMisplaced);
+}
+
+void FPuzzleShuffleGenerator::CountStructure(FPuzzleShuffleResult& Result)
+{
+    const int32 NumCells = Result.Arrangement.Num();
+    TBitArray<> Visited(false, NumCells);
+
+    Result.CorrectPieces = 0;
+    Result.Cycles = 0;
+    for (int32 Cell = 0; Cell < NumCells; Cell++)
+    {
+        if (Visited[Cell])
+        {
+            continue;
+        }
+
+        if (Result.Arrangement[Cell] == Cell)
+        {
+            Result.CorrectPieces++;
+            Visited[Cell] = true;
+            continue;
+        }
+
+        Result.Cycles++;
+        for (int32 Walk = Cell; !Visited[Walk]; Walk = Result.Arrangement[Walk])
+        {
+            Visited[Walk] = true;
+        }
+    }
+
+    Result.MinSwaps = (NumCells - Result.CorrectPieces) - Result.Cycles;
+}
+
+void FPuzzleShuffleGenerator::Generate(int32 NumCells, const FPuzzleShuffleSettings& Settings, int32 Seed, FPuzzleShuffleResult& OutResult)
+{
+    TArray<int32> Order;
+    Order.SetNumUninitialized(NumCells);
+    for (int32 i = 0; i < NumCells; i++)
+    {
+        Order[i] = i;
+    }
+    ParallelShuffle(Order, Seed);
+
+    const bool bTargeted = Settings.TargetCorrectPieces >= 0 || Settings.TargetCycles >= 0 || Settings.TargetMinSwaps >= 0;
+    if (!bTargeted)
+    {
+        OutResult.Arrangement = MoveTemp(Order);
+        CountStructure(OutResult);
+        return;
+    }
+
+    int32 NumCorrect = 0;
+    int32 NumCycles = 0;
+    ResolveTargets(NumCells, Settings, NumCorrect, NumCycles);
+
+    // Karışık sıranın başı yerinde kalır, kalanı ardışık döngülere bölünür
+    TArray<int32> CycleStarts;
+    if (NumCycles > 0)
+    {
+        PickCycleStarts(NumCorrect, NumCells - NumCorrect, NumCycles, Seed, CycleStarts);
+    }
+
+    TArray<int32>& Arrangement = OutResult.Arrangement;
+    Arrangement.SetNumUninitialized(NumCells);
+
+    const int32 BlockSize = PuzzleShuffle::MinBlockSize;
+    ParallelFor(FMath::DivideAndRoundUp(NumCells, BlockSize), [&](int32 Block)
+    {
+        const int32 Start = Block * BlockSize;
+        const int32 End = FMath::Min(NumCells, Start + BlockSize);
+
+        int32 Cycle = CycleStarts.Num() > 0 ? Algo::UpperBound(CycleStarts, Start) - 1 : INDEX_NONE;
+        for (int32 i = Start; i < End; i++)
+        {
+            if (i < NumCorrect)
+            {
+                Arrangement[Order[i]] = Order[i];
+                continue;
+            }
+
+            while (CycleStarts[Cycle + 1] <= i)
+            {
+                Cycle++;
+            }
+
+            // Hücre, döngüdeki sonraki hücrenin parçasını taşır
+            const int32 NextIndex = (i + 1 < CycleStarts[Cycle + 1]) ? i + 1 : CycleStarts[Cycle];
+            Arrangement[Order[i]] = Order[NextIndex];
+        }
+    });
+
+    OutResult.CorrectPieces = NumCorrect;
+    OutResult.Cycles = NumCycles;
+    OutResult.MinSwaps = (NumCells - NumCorrect) - NumCycles;
+}
@@ -0,0 +1,64 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PuzzleShuffleGenerator.generated.h"
+
+// Karıştırma hedefleri - -1 olan hedef serbest bırakılır, hepsi -1 ise düzgün rastgele permütasyon
+USTRUCT(BlueprintType)
+struct PUZZLEGAME_API FPuzzleShuffleSettings
+{
+    GENERATED_BODY()
+
+    // 0: her başlangıçta yeni seed seçilir ve loglanır
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Shuffle")
+    int32 Seed = 0;
+
+    // Baştan doğru yerinde duran parça sayısı
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Shuffle")
+    int32 TargetCorrectPieces = -1;
+
+    // Yanlış parçaların oluşturduğu döngü sayısı (az döngü = uzun zincirler)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Shuffle")
+    int32 TargetCycles = -1;
+
+    // Çözüm için gereken en az takas sayısı
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Shuffle")
+    int32 TargetMinSwaps = -1;
+};
+
+struct PUZZLEGAME_API FPuzzleShuffleResult
+{
+    // GridID -> PieceID
+    TArray<int32> Arrangement;
+
+    // Ulaşılan değerler - hedefler board boyutuna göre kırpılmış olabilir
+    int32 CorrectPieces = 0;
+    int32 Cycles = 0;
+    int32 MinSwaps = 0;
+};
+
+/**
+ * Seeded permutation generator. The output depends only on the cell count, the settings
+ * and the seed - never on the worker thread count - so any board can be rebuilt from its
+ * seed. Shuffling uses a block scatter followed by per-bucket Fisher-Yates, both in
+ * ParallelFor, so 10M-cell boards stay within the startup budget.
+ */
+class PUZZLEGAME_API FPuzzleShuffleGenerator
+{
+public:
+    static void Generate(int32 NumCells, const FPuzzleShuffleSettings& Settings, int32 Seed, FPuzzleShuffleResult& OutResult);
+
+    // Düzgün rastgele karıştırma, thread sayısından bağımsız tekrarlanabilir
+    static void ParallelShuffle(TArray<int32>& Values, int32 Seed);
+
+private:
+    // Hedefleri tutarlı (doğru parça, döngü) çiftine çevirir
+    static void ResolveTargets(int32 NumCells, const FPuzzleShuffleSettings& Settings, int32& OutCorrect, int32& OutCycles);
+
+    // Her döngü en az 2 hücre - uzunluklar rastgele bileşimden seçilir
+    static void PickCycleStarts(int32 FirstIndex, int32 NumMisplaced, int32 NumCycles, int32 Seed, TArray<int32>& OutStarts);
+
+    static void CountStructure(FPuzzleShuffleResult& Result);
+};
@@ -0,0 +1,584 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "PuzzleSlidingSolver.h"
+#include "Async/ParallelFor.h"
+#include "Misc/ScopeLock.h"
+
+namespace PuzzleSliding
+{
+    // Kök alt ağaç sayısı - boşta kalan worker'lar kalan alt ağaçları alır
+    constexpr int32 TargetFrontierSize = 2048;
+    constexpr int32 MaxFrontierDepth = 24;
+
+    // 2^21 giriş x 16 byte = 32MB
+    constexpr int32 TableBits = 21;
+
+    // Sadece alt ağacı yeterince büyük düğümler tabloya girer
+    constexpr int32 TableMinRemaining = 6;
+
+    constexpr uint64 NodeCheckInterval = 4096;
+
+    uint64 SplitMix64(uint64& State)
+    {
+        uint64 Z = (State += 0x9E3779B97F4A7C15ull);
+        Z = (Z ^ (Z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        Z = (Z ^ (Z >> 27)) * 0x94D049BB133111EBull;
+        return Z ^ (Z >> 31);
+    }
+
+    // Sıra içinde en uzun artan alt dizi - en fazla 5 eleman
+    int32 LongestIncreasing(const int32* Values, int32 Num)
+    {
+        int32 Lengths[5];
+        int32 Best = 0;
+        for (int32 i = 0; i < Num; i++)
+        {
+            Lengths[i] = 1;
+            for (int32 j = 0; j < i; j++)
+            {
+                if (Values[j] < Values[i] && Lengths[j] + 1 > Lengths[i])
+                {
+                    Lengths[i] = Lengths[j] + 1;
+                }
+            }
+            Best = FMath::Max(Best, Lengths[i]);
+        }
+        return Best;
+    }
+}
+
+// Solve'lar arasında yeniden kullanılır - iterasyon sayacı sürdüğü için eski girişler eşleşmez, sıfırlama gerekmez
+struct FPuzzleSlidingSolver::FTranspositionTable
+{
+    TArray<int64> Keys;
+    TArray<int64> Data;
+    int64 Iteration = 0;
+};
+
+// Bir IDA* iterasyonunun tüm thread'lerce paylaşılan durumu
+struct FPuzzleSlidingSolver::FSharedSearch
+{
+    int32 Bound = 0;
+    int64 Iteration = 0;
+
+    std::atomic<bool> bStop{ false };
+    std::atomic<bool> bFound{ false };
+    std::atomic<int32> NextBound{ MAX_int32 };
+    std::atomic<uint64> Nodes{ 0 };
+
+    const std::atomic<bool>* bCancelled = nullptr;
+    uint64 MaxNodes = 0;
+
+    // Kilitsiz tablo: anahtar ^ veri ve veri ayrı yazılır, yırtık okuma eşleşmez
+    int64* TableKeys = nullptr;
+    int64* TableData = nullptr;
+    uint64 TableMask = 0;
+
+    FCriticalSection SolutionLock;
+    TArray<int32> Solution;
+
+    // Aynı iterasyonda daha küçük derinlikle görülmüşse true
+    bool ProbeAndStore(uint64 Key, int32 G)
+    {
+        const uint64 Index = Key & TableMask;
+        const uint64 Data = (uint64)FPlatformAtomics::AtomicRead_Relaxed(&TableData[Index]);
+        const uint64 StoredKey = (uint64)FPlatformAtomics::AtomicRead_Relaxed(&TableKeys[Index]) ^ Data;
+
+        if (StoredKey == Key && (int64)(Data >> 8) == Iteration && (int32)(Data & 0xFF) <= G)
+        {
+            return true;
+        }
+
+        const uint64 NewData = ((uint64)Iteration << 8) | (uint64)G;
+        FPlatformAtomics::AtomicStore_Relaxed(&TableData[Index], (int64)NewData);
+        FPlatformAtomics::AtomicStore_Relaxed(&TableKeys[Index], (int64)(Key ^ NewData));
+        return false;
+    }
+
+    void ReportBound(int32 Bound)
+    {
+        int32 Current = NextBound.load(std::memory_order_relaxed);
+        while (Bound < Current && !NextBound.compare_exchange_weak(Current, Bound, std::memory_order_relaxed))
+        {
+        }
+    }
+};
+
+// Tek bir kök alt ağacını arayan worker'ın yerel durumu
+struct FPuzzleSlidingSolver::FThreadContext
+{
+    FSharedSearch* Shared = nullptr;
+    int32 Bound = 0;
+    int32 NextBound = MAX_int32;
+    int32 GoalDepth = 0;
+    uint64 Nodes = 0;
+    bool bStopped = false;
+    int32 Path[MaxSolutionLength + 1];
+
+    bool CheckStop()
+    {
+        const uint64 Total = Shared->Nodes.fetch_add(PuzzleSliding::NodeCheckInterval, std::memory_order_relaxed) + PuzzleSliding::NodeCheckInterval;
+        if (Shared->bStop.load(std::memory_order_relaxed) ||
+            (Shared->bCancelled && Shared->bCancelled->load(std::memory_order_relaxed)) ||
+            (Shared->MaxNodes > 0 && Total > Shared->MaxNodes))
+        {
+            Shared->bStop.store(true, std::memory_order_relaxed);
+            bStopped = true;
+        }
+        return bStopped;
+    }
+};
+
+FPuzzleSlidingSolver::FPuzzleSlidingSolver(int32 InWidth, int32 InHeight, int32 InBlankTile,
+    TSharedPtr<const FPuzzlePatternDatabase, ESPMode::ThreadSafe> InPatternDatabase)
+    : Width(InWidth)
+    , Height(InHeight)
+    , NumCells(InWidth * InHeight)
+    , BlankTile(InBlankTile)
+{
+    check(NumCells <= MaxCells && Width <= 5 && Height <= 5);
+
+    if (InPatternDatabase.IsValid() && InPatternDatabase->IsCompatible(Width, Height, BlankTile))
+    {
+        PatternDatabase = MoveTemp(InPatternDatabase);
+    }
+
+    FMemory::Memset(TilePatterns, 0xFF);
+    if (PatternDatabase.IsValid())
+    {
+        for (int32 PatternIndex = 0; PatternIndex < PatternDatabase->GetNumPatterns(); PatternIndex++)
+        {
+            for (int32 Slot = 0; Slot < PatternDatabase->GetPatternSize(PatternIndex); Slot++)
+            {
+                TilePatterns[PatternDatabase->GetPatternTile(PatternIndex, Slot)] = (int8)PatternIndex;
+            }
+        }
+    }
+
+    // Yansıyan board aynı mesafededir - boşluğun hedefi köşegendeyse aynı tablolar kullanılır
+    for (int32 Cell = 0; Cell < NumCells; Cell++)
+    {
+        Transpose[Cell] = (uint8)((Cell % Width) * Width + Cell / Width);
+    }
+    bUseMirror = PatternDatabase.IsValid() && Width == Height && Transpose[BlankTile] == BlankTile;
+
+    uint64 Seed = 0x5EED5EEDull;
+    for (int32 Tile = 0; Tile < MaxCells; Tile++)
+    {
+        for (int32 Cell = 0; Cell < MaxCells; Cell++)
+        {
+            const int32 Dist = (Tile < NumCells && Cell < NumCells)
+                ? FMath::Abs(Tile % Width - Cell % Width) + FMath::Abs(Tile / Width - Cell / Width)
+                : 0;
+            Distance[Tile][Cell] = (uint8)Dist;
+            Zobrist[Tile][Cell] = PuzzleSliding::SplitMix64(Seed);
+        }
+    }
+
+    for (int32 Cell = 0; Cell < NumCells; Cell++)
+    {
+        const int32 Col = Cell % Width;
+        const int32 Row = Cell / Width;
+        NeighborCount[Cell] = 0;
+        if (Row > 0)          Neighbors[Cell][NeighborCount[Cell]++] = (uint8)(Cell - Width);
+        if (Col > 0)          Neighbors[Cell][NeighborCount[Cell]++] = (uint8)(Cell - 1);
+        if (Col < Width - 1)  Neighbors[Cell][NeighborCount[Cell]++] = (uint8)(Cell + 1);
+        if (Row < Height - 1) Neighbors[Cell][NeighborCount[Cell]++] = (uint8)(Cell + Width);
+    }
+}
+
+bool FPuzzleSlidingSolver::IsSolvable(int32 Width, int32 Height, int32 BlankTile, TArrayView<const int32> Tiles)
+{
+    const int32 Num = Tiles.Num();
+    if (Num != Width * Height || BlankTile < 0 || BlankTile >= Num)
+    {
+        return false;
+    }
+
+    // Permütasyon paritesi = (N - döngü sayısı) mod 2
+    TBitArray<> Visited(false, Num);
+    int32 Cycles = 0;
+    int32 BlankCell = INDEX_NONE;
+    for (int32 Cell = 0; Cell < Num; Cell++)
+    {
+        if (Tiles[Cell] < 0 || Tiles[Cell] >= Num)
+        {
+            return false;
+        }
+        if (Tiles[Cell] == BlankTile)
+        {
+            BlankCell = Cell;
+        }
+        if (Visited[Cell])
+        {
+            continue;
+        }
+        Cycles++;
+        for (int32 Walk = Cell; !Visited[Walk]; Walk = Tiles[Walk])
+        {
+            Visited[Walk] = true;
+        }
+    }
+
+    const int32 PermutationParity = (Num - Cycles) & 1;
+    const int32 BlankParity = (FMath::Abs(BlankCell % Width - BlankTile % Width) + FMath::Abs(BlankCell / Width - BlankTile / Width)) & 1;
+    return PermutationParity == BlankParity;
+}
+
+void FPuzzleSlidingSolver::InitState(TArrayView<const int32> Tiles, FState& OutState) const
+{
+    FMemory::Memzero(OutState);
+    OutState.PrevBlank = -1;
+
+    for (int32 Cell = 0; Cell < NumCells; Cell++)
+    {
+        const int32 Tile = Tiles[Cell];
+        OutState.Tiles[Cell] = (uint8)Tile;
+        OutState.Positions[Tile] = (uint8)Cell;
+        OutState.MirrorPositions[Transpose[Tile]] = Transpose[Cell];
+        if (Tile == BlankTile)
+        {
+            OutState.Blank = (int8)Cell;
+            continue;
+        }
+        OutState.Manhattan += Distance[Tile][Cell];
+        OutState.Key ^= Zobrist[Tile][Cell];
+    }
+
+    for (int32 Row = 0; Row < Height; Row++)
+    {
+        OutState.RowConflicts[Row] = (int8)ComputeRowConflicts(OutState, Row);
+        OutState.ConflictSum += OutState.RowConflicts[Row];
+    }
+    for (int32 Col = 0; Col < Width; Col++)
+    {
+        OutState.ColConflicts[Col] = (int8)ComputeColConflicts(OutState, Col);
+        OutState.ConflictSum += OutState.ColConflicts[Col];
+    }
+
+    if (PatternDatabase.IsValid())
+    {
+        for (int32 PatternIndex = 0; PatternIndex < PatternDatabase->GetNumPatterns(); PatternIndex++)
+        {
+            OutState.PatternCosts[PatternIndex] = PatternDatabase->Lookup(PatternIndex, OutState.Positions);
+            OutState.PatternSum += OutState.PatternCosts[PatternIndex];
+
+            if (bUseMirror)
+            {
+                OutState.MirrorCosts[PatternIndex] = PatternDatabase->Lookup(PatternIndex, OutState.MirrorPositions);
+                OutState.MirrorSum += OutState.MirrorCosts[PatternIndex];
+            }
+        }
+    }
+}
+
+void FPuzzleSlidingSolver::UpdatePatternCost(uint8* Costs, int16& Sum, const uint8* Positions, int32 Tile) const
+{
+    const int32 PatternIndex = TilePatterns[Tile];
+    if (PatternIndex >= 0)
+    {
+        const uint8 NewCost = PatternDatabase->Lookup(PatternIndex, Positions);
+        Sum += NewCost - Costs[PatternIndex];
+        Costs[PatternIndex] = NewCost;
+    }
+}
+
+int32 FPuzzleSlidingSolver::ComputeRowConflicts(const FState& State, int32 Row) const
+{
+    int32 GoalCols[5];
+    int32 Num = 0;
+    for (int32 Col = 0; Col < Width; Col++)
+    {
+        const int32 Tile = State.Tiles[Row * Width + Col];
+        if (Tile != BlankTile && Tile / Width == Row)
+        {
+            GoalCols[Num++] = Tile % Width;
+        }
+    }
+    return Num - PuzzleSliding::LongestIncreasing(GoalCols, Num);
+}
+
+int32 FPuzzleSlidingSolver::ComputeColConflicts(const FState& State, int32 Col) const
+{
+    int32 GoalRows[5];
+    int32 Num = 0;
+    for (int32 Row = 0; Row < Height; Row++)
+    {
+        const int32 Tile = State.Tiles[Row * Width + Col];
+        if (Tile != BlankTile && Tile % Width == Col)
+        {
+            GoalRows[Num++] = Tile / Width;
+        }
+    }
+    return Num - PuzzleSliding::LongestIncreasing(GoalRows, Num);
+}
+
+void FPuzzleSlidingSolver::ApplyMove(FState& State, int32 NewBlank) const
+{
+    const int32 OldBlank = State.Blank;
+    const int32 Tile = State.Tiles[NewBlank];
+
+    State.Tiles[OldBlank] = (uint8)Tile;
+    State.Tiles[NewBlank] = (uint8)BlankTile;
+    State.Positions[Tile] = (uint8)OldBlank;
+    State.Positions[BlankTile] = (uint8)NewBlank;
+    State.Manhattan += Distance[Tile][OldBlank] - Distance[Tile][NewBlank];
+    State.Key ^= Zobrist[Tile][NewBlank] ^ Zobrist[Tile][OldBlank];
+
+    // Sadece kayan taşın pattern'i değişir
+    UpdatePatternCost(State.PatternCosts, State.PatternSum, State.Positions, Tile);
+    if (bUseMirror)
+    {
+        State.MirrorPositions[Transpose[Tile]] = Transpose[OldBlank];
+        State.MirrorPositions[BlankTile] = Transpose[NewBlank];
+        UpdatePatternCost(State.MirrorCosts, State.MirrorSum, State.MirrorPositions, Transpose[Tile]);
+    }
+
+    // Dikey hamle sadece iki satırın çakışmasını, yatay hamle iki sütununkini değiştirir
+    if (OldBlank / Width != NewBlank / Width)
+    {
+        const int32 RowA = OldBlank / Width;
+        const int32 RowB = NewBlank / Width;
+        const int32 NewA = ComputeRowConflicts(State, RowA);
+        const int32 NewB = ComputeRowConflicts(State, RowB);
+        State.ConflictSum += (NewA - State.RowConflicts[RowA]) + (NewB - State.RowConflicts[RowB]);
+        State.RowConflicts[RowA] = (int8)NewA;
+        State.RowConflicts[RowB] = (int8)NewB;
+    }
+    else
+    {
+        const int32 ColA = OldBlank % Width;
+        const int32 ColB = NewBlank % Width;
+        const int32 NewA = ComputeColConflicts(State, ColA);
+        const int32 NewB = ComputeColConflicts(State, ColB);
+        State.ConflictSum += (NewA - State.ColConflicts[ColA]) + (NewB - State.ColConflicts[ColB]);
+        State.ColConflicts[ColA] = (int8)NewA;
+        State.ColConflicts[ColB] = (int8)NewB;
+    }
+
+    State.PrevBlank = (int8)OldBlank;
+    State.Blank = (int8)NewBlank;
+    State.G++;
+}
+
+bool FPuzzleSlidingSolver::SearchNode(FThreadContext& Context, const FState& State) const
+{
+    const int32 H = Heuristic(State);
+    const int32 F = State.G + H;
+    if (F > Context.Bound)
+    {
+        Context.NextBound = FMath::Min(Context.NextBound, F);
+        return false;
+    }
+
+    if (H == 0)
+    {
+        Context.GoalDepth = State.G;
+        return true;
+    }
+
+    if ((++Context.Nodes % PuzzleSliding::NodeCheckInterval) == 0 && Context.CheckStop())
+    {
+        return false;
+    }
+
+    if (Context.Bound - State.G >= PuzzleSliding::TableMinRemaining && Context.Shared->ProbeAndStore(State.Key, State.G))
+    {
+        return false;
+    }
+
+    for (int32 Index = 0; Index < NeighborCount[State.Blank]; Index++)
+    {
+        const int32 Next = Neighbors[State.Blank][Index];
+        if (Next == State.PrevBlank)
+        {
+            continue;
+        }
+
+        FState Child = State;
+        ApplyMove(Child, Next);
+        Context.Path[State.G] = Next;
+
+        if (SearchNode(Context, Child))
+        {
+            return true;
+        }
+        if (Context.bStopped)
+        {
+            return false;
+        }
+    }
+
+    return false;
+}
+
+int32 FPuzzleSlidingSolver::EstimateMoves(TArrayView<const int32> Tiles) const
+{
+    if (Tiles.Num() != NumCells)
+    {
+        return -1;
+    }
+
+    FState State;
+    InitState(Tiles, State);
+    return Heuristic(State);
+}
+
+FPuzzleSlidingSolver::~FPuzzleSlidingSolver() = default;
+
+TUniquePtr<FPuzzleSlidingSolver::FTranspositionTable> FPuzzleSlidingSolver::AcquireTable() const
+{
+    {
+        FScopeLock Lock(&TablePoolLock);
+        if (TablePool.Num() > 0)
+        {
+            return TablePool.Pop(EAllowShrinking::No);
+        }
+    }
+
+    // Sadece eşzamanlı ilk Solve'lar ayırır - ipucu ve otomatik çözüm aynı anda çalışabilir
+    TUniquePtr<FTranspositionTable> Table = MakeUnique<FTranspositionTable>();
+    Table->Keys.Init(0, 1 << PuzzleSliding::TableBits);
+    Table->Data.Init(0, 1 << PuzzleSliding::TableBits);
+    return Table;
+}
+
+void FPuzzleSlidingSolver::ReleaseTable(TUniquePtr<FTranspositionTable> Table) const
+{
+    FScopeLock Lock(&TablePoolLock);
+    TablePool.Add(MoveTemp(Table));
+}
+
+bool FPuzzleSlidingSolver::Solve(TArrayView<const int32> Tiles, FPuzzleSlidingSolution& OutSolution,
+    const std::atomic<bool>* bCancelled, uint64 MaxNodes) const
+{
+    const double StartTime = FPlatformTime::Seconds();
+    OutSolution = FPuzzleSlidingSolution();
+
+    if (Tiles.Num() != NumCells || !IsSolvable(Width, Height, BlankTile, Tiles))
+    {
+        return false;
+    }
+
+    FState Root;
+    InitState(Tiles, Root);
+    if (Heuristic(Root) == 0)
+    {
+        OutSolution.bSolved = true;
+        OutSolution.Seconds = FPlatformTime::Seconds() - StartTime;
+        return true;
+    }
+
+    // Kök alt ağaçları genişlikte açılır - bu seviyelerdeki çözüm de en kısa olur
+    TArray<FFrontierNode> Frontier;
+    Frontier.Add({ Root, {} });
+    for (int32 Depth = 0; Frontier.Num() < PuzzleSliding::TargetFrontierSize && Depth < PuzzleSliding::MaxFrontierDepth; Depth++)
+    {
+        TArray<FFrontierNode> NextLevel;
+        NextLevel.Reserve(Frontier.Num() * 3);
+        for (const FFrontierNode& Node : Frontier)
+        {
+            for (int32 Index = 0; Index < NeighborCount[Node.State.Blank]; Index++)
+            {
+                const int32 Next = Neighbors[Node.State.Blank][Index];
+                if (Next == Node.State.PrevBlank)
+                {
+                    continue;
+                }
+
+                FFrontierNode& Child = NextLevel.Add_GetRef({ Node.State, Node.Path });
+                ApplyMove(Child.State, Next);
+                Child.Path.Add(Next);
+
+                if (Heuristic(Child.State) == 0)
+                {
+                    OutSolution.bSolved = true;
+                    OutSolution.Moves = Child.Path;
+                    OutSolution.Seconds = FPlatformTime::Seconds() - StartTime;
+                    return true;
+                }
+            }
+        }
+        Frontier = MoveTemp(NextLevel);
+    }
+
+    int32 Bound = MAX_int32;
+    for (const FFrontierNode& Node : Frontier)
+    {
+        Bound = FMath::Min(Bound, Node.State.G + Heuristic(Node.State));
+    }
+
+    FSharedSearch Shared;
+    Shared.bCancelled = bCancelled;
+    Shared.MaxNodes = MaxNodes;
+    TUniquePtr<FTranspositionTable> Table = AcquireTable();
+    Shared.TableKeys = Table->Keys.GetData();
+    Shared.TableData = Table->Data.GetData();
+    Shared.TableMask = (uint64)Table->Keys.Num() - 1;
+    Shared.Iteration = Table->Iteration;
+
+    while (Bound <= MaxSolutionLength)
+    {
+        Shared.Bound = Bound;
+        Shared.Iteration++;
+        Shared.NextBound.store(MAX_int32);
+        OutSolution.Iterations++;
+
+        ParallelFor(Frontier.Num(), [this, &Shared, &Frontier](int32 FrontierIndex)
+        {
+            if (Shared.bStop.load(std::memory_order_relaxed))
+            {
+                return;
+            }
+
+            const FFrontierNode& Node = Frontier[FrontierIndex];
+
+            FThreadContext Context;
+            Context.Shared = &Shared;
+            Context.Bound = Shared.Bound;
+            for (int32 Index = 0; Index < Node.Path.Num(); Index++)
+            {
+                Context.Path[Index] = Node.Path[Index];
+            }
+
+            const bool bFound = SearchNode(Context, Node.State);
+
+            Shared.Nodes.fetch_add(Context.Nodes % PuzzleSliding::NodeCheckInterval, std::memory_order_relaxed);
+            Shared.ReportBound(Context.NextBound);
+
+            if (bFound)
+            {
+                FScopeLock Lock(&Shared.SolutionLock);
+                if (!Shared.bFound.load())
+                {
+                    // Aynı eşikteki her çözüm eşit uzunlukta - ilk bulunan alınır
+                    Shared.Solution.Append(Context.Path, Context.GoalDepth);
+                    Shared.bFound.store(true);
+                    Shared.bStop.store(true);
+                }
+            }
+        }, EParallelForFlags::Unbalanced);
+
+        if (Shared.bFound.load())
+        {
+            OutSolution.bSolved = true;
+            OutSolution.Moves = MoveTemp(Shared.Solution);
+            break;
+        }
+
+        // İptal veya düğüm bütçesi
+        if (Shared.bStop.load())
+        {
+            break;
+        }
+
+        Bound = Shared.NextBound.load();
+    }
+
+    Table->Iteration = Shared.Iteration;
+    ReleaseTable(MoveTemp(Table));
+
+    OutSolution.NodesExpanded = Shared.Nodes.load();
+    OutSolution.Seconds = FPlatformTime::Seconds() - StartTime;
+    return OutSolution.bSolved;
+}
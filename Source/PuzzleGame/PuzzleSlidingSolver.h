@@ -0,0 +1,138 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PuzzlePatternDatabase.h"
+#include "HAL/CriticalSection.h"
+#include <atomic>
+
+// Tek bir sliding-tile çözümü
+struct PUZZLEGAME_API FPuzzleSlidingSolution
+{
+    bool bSolved = false;
+
+    // Her hamlede boşluğa kayan taşın hücresi - hamleden sonra boşluk bu hücrededir
+    TArray<int32> Moves;
+
+    uint64 NodesExpanded = 0;
+    int32 Iterations = 0;
+    double Seconds = 0.0;
+};
+
+/**
+ * Optimal solver for sliding-tile boards up to 5x5. Tiles[Cell] is the tile at that cell;
+ * the goal has every tile on its own index and the blank tile on the blank's index.
+ *
+ * Parallel IDA*: a breadth-first frontier of root subtrees is expanded once, then every
+ * threshold iteration hands those subtrees to ParallelFor(Unbalanced) so idle workers
+ * pick up the remaining ones. A lock-free transposition table prunes nodes that were
+ * already reached with a smaller depth in the same iteration. The heuristic is Manhattan
+ * distance plus linear conflicts, both updated incrementally per move; with a compatible
+ * pattern database it is the largest of that, the additive pattern sum and, on square
+ * boards, the pattern sum of the transposed board (same tables, mirrored lookup).
+ * Transposition tables (32 MB each) are pooled on the solver and reused across solves.
+ *
+ * The 6-6-3 database for 4x4 ships in Content/PatternDatabases and is used by default; with it
+ * the hard Korf instances (BenchmarkSlidingSolver, PuzzleGame.Sliding.KorfInstances) expand
+ * about 10x fewer nodes and solve in under a second on a multi-core machine. Without it they
+ * take about 0.5-10 s.
+ */
+class PUZZLEGAME_API FPuzzleSlidingSolver
+{
+public:
+    static constexpr int32 MaxCells = 25;
+    static constexpr int32 MaxSolutionLength = 250;
+
+    // Boyutu/boşluğu uymayan pattern database yok sayılır
+    FPuzzleSlidingSolver(int32 InWidth, int32 InHeight, int32 InBlankTile,
+        TSharedPtr<const FPuzzlePatternDatabase, ESPMode::ThreadSafe> InPatternDatabase = nullptr);
+    ~FPuzzleSlidingSolver();
+
+    // Permütasyon paritesi boşluğun hedefe Manhattan mesafesi paritesine eşit olmalı
+    static bool IsSolvable(int32 Width, int32 Height, int32 BlankTile, TArrayView<const int32> Tiles);
+
+    // bCancelled/MaxNodes ile sınırlı arama (ipucu); sınır aşılırsa false
+    bool Solve(TArrayView<const int32> Tiles, FPuzzleSlidingSolution& OutSolution,
+        const std::atomic<bool>* bCancelled = nullptr, uint64 MaxNodes = 0) const;
+
+    // Başlangıç durumunun heuristic değeri (alt sınır)
+    int32 EstimateMoves(TArrayView<const int32> Tiles) const;
+
+    int32 GetWidth() const { return Width; }
+    int32 GetHeight() const { return Height; }
+    int32 GetBlankTile() const { return BlankTile; }
+    bool HasPatternDatabase() const { return PatternDatabase.IsValid(); }
+
+private:
+    struct FState
+    {
+        uint8 Tiles[MaxCells];
+        int8 Blank;
+        int8 PrevBlank;
+        int16 Manhattan;
+        int16 ConflictSum;
+        int8 RowConflicts[5];
+        int8 ColConflicts[5];
+        uint8 Positions[MaxCells];
+        uint8 PatternCosts[FPuzzlePatternDatabase::MaxPatterns];
+        int16 PatternSum;
+        uint8 MirrorPositions[MaxCells];
+        uint8 MirrorCosts[FPuzzlePatternDatabase::MaxPatterns];
+        int16 MirrorSum;
+        int32 G;
+        uint64 Key;
+    };
+
+    struct FFrontierNode
+    {
+        FState State;
+        TArray<int32> Path;
+    };
+
+    struct FSharedSearch;
+    struct FThreadContext;
+    struct FTranspositionTable;
+
+    // Havuzdan tablo al, yoksa yenisini ayır - Solve thread-safe kalır
+    TUniquePtr<FTranspositionTable> AcquireTable() const;
+    void ReleaseTable(TUniquePtr<FTranspositionTable> Table) const;
+
+    void InitState(TArrayView<const int32> Tiles, FState& OutState) const;
+    void ApplyMove(FState& State, int32 NewBlank) const;
+
+    int32 Heuristic(const FState& State) const
+    {
+        return FMath::Max3(State.Manhattan + 2 * State.ConflictSum, (int32)State.PatternSum, (int32)State.MirrorSum);
+    }
+
+    // Pattern maliyetini sadece kayan taşın pattern'i için yeniler
+    void UpdatePatternCost(uint8* Costs, int16& Sum, const uint8* Positions, int32 Tile) const;
+
+    // Satır/sütundaki ters sıralı hedef taş sayısı: n - LIS
+    int32 ComputeRowConflicts(const FState& State, int32 Row) const;
+    int32 ComputeColConflicts(const FState& State, int32 Col) const;
+
+    bool SearchNode(FThreadContext& Context, const FState& State) const;
+
+    int32 Width;
+    int32 Height;
+    int32 NumCells;
+    int32 BlankTile;
+
+    uint8 Distance[MaxCells][MaxCells];
+    uint8 Neighbors[MaxCells][4];
+    uint8 NeighborCount[MaxCells];
+    uint64 Zobrist[MaxCells][MaxCells];
+
+    // Taş -> pattern indeksi (-1: pattern dışı)
+    TSharedPtr<const FPuzzlePatternDatabase, ESPMode::ThreadSafe> PatternDatabase;
+    int8 TilePatterns[MaxCells];
+
+    // Köşegen yansıması: hücre ve taş indeksleri aynı dönüşümle eşlenir
+    bool bUseMirror = false;
+    uint8 Transpose[MaxCells];
+
+    mutable FCriticalSection TablePoolLock;
+    mutable TArray<TUniquePtr<FTranspositionTable>> TablePool;
+};
@@ -0,0 +1,55 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "PuzzleSlidingSolver.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPuzzleSlidingKorfTest, "PuzzleGame.Sliding.KorfInstances",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FPuzzleSlidingKorfTest::RunTest(const FString& Parameters)
+{
+    // BenchmarkSlidingSolver'ın Korf örnekleri ve optimal uzunlukları - boşluk 0, hedef sıralı
+    static const int32 Instances[][16] =
+    {
+        { 14, 13, 15, 7, 11, 12, 9, 5, 6, 0, 2, 1, 4, 8, 10, 3 },
+        { 13, 5, 4, 10, 9, 12, 8, 14, 2, 3, 7, 1, 0, 15, 11, 6 },
+        { 14, 7, 8, 2, 13, 11, 10, 4, 9, 12, 5, 0, 3, 6, 1, 15 },
+    };
+    static const int32 OptimalMoves[] = { 57, 55, 59 };
+
+    // Oyunla gelen database kullanılır - yoksa 1 saniye sınırı anlamsız
+    const TSharedPtr<const FPuzzlePatternDatabase, ESPMode::ThreadSafe> Database = FPuzzlePatternDatabase::FindOrLoad(4, 4);
+    if (!TestTrue(FString::Printf(TEXT("Pattern database at %s"), *FPuzzlePatternDatabase::GetDefaultPath(4, 4)), Database.IsValid()))
+    {
+        return false;
+    }
+
+    const FPuzzleSlidingSolver Solver(4, 4, 15, Database);
+    TestTrue(TEXT("Solver uses the pattern database"), Solver.HasPatternDatabase());
+
+    for (int32 Index = 0; Index < UE_ARRAY_COUNT(Instances); Index++)
+    {
+        // Oyunun database'i boşluğu son taş sayar - board merkeze göre yansıtılır
+        int32 Tiles[16];
+        for (int32 Cell = 0; Cell < 16; Cell++)
+        {
+            Tiles[15 - Cell] = 15 - Instances[Index][Cell];
+        }
+
+        FPuzzleSlidingSolution Solution;
+        Solver.Solve(MakeArrayView(Tiles, 16), Solution);
+
+        const FString Label = FString::Printf(TEXT("Korf board #%d"), Index + 1);
+        TestTrue(Label + TEXT(" solved"), Solution.bSolved);
+        TestEqual(Label + TEXT(" optimal length"), Solution.Moves.Num(), OptimalMoves[Index]);
+        TestTrue(FString::Printf(TEXT("%s under 1s (%.3fs, %llu nodes)"), *Label, Solution.Seconds, Solution.NodesExpanded),
+            Solution.Seconds < 1.0);
+    }
+
+    return true;
+}
+
+#endif
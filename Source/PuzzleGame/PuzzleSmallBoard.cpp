@@ -0,0 +1,45 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "PuzzleSmallBoard.h"
+
+void FPuzzleGenericBoard::Init(int32 InWidth, int32 InHeight)
+{
+    const int32 NumCells = InWidth * InHeight;
+    Occupancy.Init(-1, NumCells);
+    PieceCells.Init(-1, NumCells);
+    CorrectCells = 0;
+}
+
+void FPuzzleGenericBoard::Reset()
+{
+    Init(Occupancy.Num(), 1);
+}
+
+void FPuzzleGenericBoard::Set(int32 Cell, int32 PieceID)
+{
+    // Eski parça başka hücreye taşınmadıysa board dışına çıkar
+    const int32 OldPieceID = Occupancy[Cell];
+    if (OldPieceID >= 0 && PieceCells[OldPieceID] == Cell)
+    {
+        PieceCells[OldPieceID] = -1;
+    }
+
+    CorrectCells += (PieceID == Cell ? 1 : 0) - (OldPieceID == Cell ? 1 : 0);
+    Occupancy[Cell] = PieceID;
+
+    if (PieceID >= 0)
+    {
+        PieceCells[PieceID] = Cell;
+    }
+}
+
+uint64 FPuzzleGenericBoard::GetHash() const
+{
+    uint64 Hash = 0x9E3779B97F4A7C15ull * Occupancy.Num();
+    for (const int32 PieceID : Occupancy)
+    {
+        Hash = (Hash ^ (uint32)(PieceID + 1)) * 0xFF51AFD7ED558CCDull;
+        Hash ^= Hash >> 33;
+    }
+    return Hash;
+}
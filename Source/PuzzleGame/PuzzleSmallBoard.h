@@ -0,0 +1,260 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Occupancy of a fixed-size board packed into a few 64-bit words. Each cell is a lane of
+ * BitsPerCell bits holding PieceID + 1 (0 is empty); lanes never straddle words. Swap is
+ * two XORs, IsSolved compares against compile-time solved words and CountCorrect/FindPiece
+ * use SWAR zero-lane detection, so none of them loop over cells.
+ *
+ * Shares its interface with FPuzzleGenericBoard; DispatchPuzzleBoard picks one at runtime.
+ * Used where whole boards are simulated in bulk (replay validation). The live game keeps
+ * GridOccupancy as a TArray: renderers, clusters and the journal index it directly, and its
+ * completion check and Zobrist hash are already O(1) incremental counters per write.
+ */
+template<int32 InWidth, int32 InHeight>
+class TPuzzleSmallBoard
+{
+public:
+    static constexpr int32 Width = InWidth;
+    static constexpr int32 Height = InHeight;
+    static constexpr int32 NumCells = InWidth * InHeight;
+
+private:
+    static constexpr int32 ComputeBitsPerCell()
+    {
+        // Parçalar + boş değeri
+        int32 Bits = 1;
+        while ((1 << Bits) < NumCells + 1)
+        {
+            Bits++;
+        }
+        return Bits;
+    }
+
+public:
+    static constexpr int32 BitsPerCell = ComputeBitsPerCell();
+    static constexpr int32 CellsPerWord = 64 / BitsPerCell;
+    static constexpr int32 NumWords = (NumCells + CellsPerWord - 1) / CellsPerWord;
+
+private:
+    static constexpr uint64 LaneMask = (1ull << BitsPerCell) - 1;
+
+    struct FWords
+    {
+        uint64 Values[NumWords];
+    };
+
+    static constexpr uint64 MakeLowOnes()
+    {
+        uint64 Result = 0;
+        for (int32 Lane = 0; Lane < CellsPerWord; Lane++)
+        {
+            Result |= 1ull << (Lane * BitsPerCell);
+        }
+        return Result;
+    }
+
+    static constexpr FWords MakeSolvedWords()
+    {
+        FWords Result{};
+        for (int32 Cell = 0; Cell < NumCells; Cell++)
+        {
+            Result.Values[Cell / CellsPerWord] |= (uint64)(Cell + 1) << ((Cell % CellsPerWord) * BitsPerCell);
+        }
+        return Result;
+    }
+
+    // Her lane'in en düşük biti / en yüksek biti / yüksek bit hariç kalanı
+    static constexpr uint64 LowOnes = MakeLowOnes();
+    static constexpr uint64 HighBits = LowOnes << (BitsPerCell - 1);
+    static constexpr uint64 LowBits = HighBits - LowOnes;
+    static constexpr FWords SolvedWords = MakeSolvedWords();
+
+    // Son word'de board dışında kalan lane'ler hep 0 - boş hücre araması onları eşlememeli
+    static constexpr int32 LastWordCells = NumCells - (NumWords - 1) * CellsPerWord;
+    static constexpr uint64 LastWordHighBits = HighBits & (LastWordCells * BitsPerCell >= 64 ? ~0ull : (1ull << (LastWordCells * BitsPerCell)) - 1);
+
+    // Sıfır olmayan lane'lerin yüksek biti set edilir - lane'ler arası taşma olmaz
+    static uint64 NonZeroLanes(uint64 Value)
+    {
+        return (((Value & LowBits) + LowBits) | Value) & HighBits;
+    }
+
+public:
+    static_assert(NumCells <= 64, "Use FPuzzleGenericBoard for larger boards");
+
+    TPuzzleSmallBoard()
+    {
+        Reset();
+    }
+
+    void Init(int32 InitWidth, int32 InitHeight)
+    {
+        check(InitWidth == Width && InitHeight == Height);
+        Reset();
+    }
+
+    void Reset()
+    {
+        FMemory::Memzero(Words);
+    }
+
+    int32 GetNumCells() const { return NumCells; }
+
+    int32 Get(int32 Cell) const
+    {
+        return (int32)GetLane(Cell) - 1;
+    }
+
+    void Set(int32 Cell, int32 PieceID)
+    {
+        const int32 Shift = (Cell % CellsPerWord) * BitsPerCell;
+        uint64& Word = Words[Cell / CellsPerWord];
+        Word = (Word & ~(LaneMask << Shift)) | ((uint64)(PieceID + 1) << Shift);
+    }
+
+    void Swap(int32 CellA, int32 CellB)
+    {
+        const uint64 Diff = GetLane(CellA) ^ GetLane(CellB);
+        Words[CellA / CellsPerWord] ^= Diff << ((CellA % CellsPerWord) * BitsPerCell);
+        Words[CellB / CellsPerWord] ^= Diff << ((CellB % CellsPerWord) * BitsPerCell);
+    }
+
+    // Parçanın hücresi, board'da değilse -1 - PieceID -1 ilk boş hücreyi bulur
+    int32 FindPiece(int32 PieceID) const
+    {
+        const uint64 Pattern = LowOnes * (uint64)(PieceID + 1);
+        for (int32 WordIndex = 0; WordIndex < NumWords; WordIndex++)
+        {
+            const uint64 ValidLanes = WordIndex == NumWords - 1 ? LastWordHighBits : HighBits;
+            const uint64 ZeroLanes = ~(NonZeroLanes(Words[WordIndex] ^ Pattern) | LowBits) & ValidLanes;
+            if (ZeroLanes != 0)
+            {
+                return WordIndex * CellsPerWord + (int32)FMath::CountTrailingZeros64(ZeroLanes) / BitsPerCell;
+            }
+        }
+        return -1;
+    }
+
+    bool IsSolved() const
+    {
+        for (int32 WordIndex = 0; WordIndex < NumWords; WordIndex++)
+        {
+            if (Words[WordIndex] != SolvedWords.Values[WordIndex])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    int32 CountCorrect() const
+    {
+        // Son word'deki kullanılmayan lane'ler iki tarafta da 0 - yanlış sayılmaz
+        int32 Wrong = 0;
+        for (int32 WordIndex = 0; WordIndex < NumWords; WordIndex++)
+        {
+            Wrong += (int32)FMath::CountBits(NonZeroLanes(Words[WordIndex] ^ SolvedWords.Values[WordIndex]));
+        }
+        return NumCells - Wrong;
+    }
+
+    uint64 GetHash() const
+    {
+        uint64 Hash = 0x9E3779B97F4A7C15ull * NumCells;
+        for (int32 WordIndex = 0; WordIndex < NumWords; WordIndex++)
+        {
+            Hash = (Hash ^ Words[WordIndex]) * 0xFF51AFD7ED558CCDull;
+            Hash ^= Hash >> 33;
+        }
+        return Hash;
+    }
+
+    void CopyTo(TArray<int32>& OutOccupancy) const
+    {
+        OutOccupancy.SetNumUninitialized(NumCells);
+        for (int32 Cell = 0; Cell < NumCells; Cell++)
+        {
+            OutOccupancy[Cell] = Get(Cell);
+        }
+    }
+
+    bool operator==(const TPuzzleSmallBoard& Other) const
+    {
+        return FMemory::Memcmp(Words, Other.Words, sizeof(Words)) == 0;
+    }
+
+private:
+    uint64 GetLane(int32 Cell) const
+    {
+        return (Words[Cell / CellsPerWord] >> ((Cell % CellsPerWord) * BitsPerCell)) & LaneMask;
+    }
+
+    uint64 Words[NumWords];
+};
+
+/**
+ * TArray-backed board with the TPuzzleSmallBoard interface, for sizes without a
+ * specialization. Keeps a PieceID -> cell map and a correct-cell count so FindPiece and
+ * IsSolved stay O(1).
+ */
+class PUZZLEGAME_API FPuzzleGenericBoard
+{
+public:
+    void Init(int32 InWidth, int32 InHeight);
+    void Reset();
+
+    int32 GetNumCells() const { return Occupancy.Num(); }
+    int32 Get(int32 Cell) const { return Occupancy[Cell]; }
+    void Set(int32 Cell, int32 PieceID);
+
+    void Swap(int32 CellA, int32 CellB)
+    {
+        const int32 PieceA = Occupancy[CellA];
+        Set(CellA, Occupancy[CellB]);
+        Set(CellB, PieceA);
+    }
+
+    int32 FindPiece(int32 PieceID) const { return PieceCells[PieceID]; }
+    bool IsSolved() const { return Occupancy.Num() > 0 && CorrectCells == Occupancy.Num(); }
+    int32 CountCorrect() const { return CorrectCells; }
+    uint64 GetHash() const;
+
+    void CopyTo(TArray<int32>& OutOccupancy) const { OutOccupancy = Occupancy; }
+
+private:
+    TArray<int32> Occupancy;
+    TArray<int32> PieceCells;
+    int32 CorrectCells = 0;
+};
+
+/**
+ * Calls Func with an empty board of the matching compile-time size (3x3 to 6x6), or with
+ * an FPuzzleGenericBoard otherwise. Func takes the board by value and must return the same
+ * type for every board type, e.g. [&](auto Board) { Board.Init(W, H); ... }.
+ */
+template<typename FuncType>
+auto DispatchPuzzleBoard(int32 Width, int32 Height, FuncType&& Func)
+{
+#define PUZZLE_SMALL_BOARD_CASE(W, H) case (W) * 8 + (H): return Func(TPuzzleSmallBoard<W, H>());
+
+    if (Width >= 3 && Width <= 6 && Height >= 3 && Height <= 6)
+    {
+        switch (Width * 8 + Height)
+        {
+        PUZZLE_SMALL_BOARD_CASE(3, 3) PUZZLE_SMALL_BOARD_CASE(3, 4) PUZZLE_SMALL_BOARD_CASE(3, 5) PUZZLE_SMALL_BOARD_CASE(3, 6)
+        PUZZLE_SMALL_BOARD_CASE(4, 3) PUZZLE_SMALL_BOARD_CASE(4, 4) PUZZLE_SMALL_BOARD_CASE(4, 5) PUZZLE_SMALL_BOARD_CASE(4, 6)
+        PUZZLE_SMALL_BOARD_CASE(5, 3) PUZZLE_SMALL_BOARD_CASE(5, 4) PUZZLE_SMALL_BOARD_CASE(5, 5) PUZZLE_SMALL_BOARD_CASE(5, 6)
+        PUZZLE_SMALL_BOARD_CASE(6, 3) PUZZLE_SMALL_BOARD_CASE(6, 4) PUZZLE_SMALL_BOARD_CASE(6, 5) PUZZLE_SMALL_BOARD_CASE(6, 6)
+        default: break;
+        }
+    }
+
+#undef PUZZLE_SMALL_BOARD_CASE
+
+    return Func(FPuzzleGenericBoard());
+}
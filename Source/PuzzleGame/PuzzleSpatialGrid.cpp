@@ -0,0 +1,76 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "PuzzleSpatialGrid.h"
+
+void FPuzzleSpatialGrid::Init(float InCellSize, int32 MaxItems)
+{
+    Reset();
+    InvCellSize = 1.0f / FMath::Max(InCellSize, UE_KINDA_SMALL_NUMBER);
+    Positions.SetNumZeroed(MaxItems);
+    ItemCells.SetNumZeroed(MaxItems);
+    ItemSlots.Init(-1, MaxItems);
+}
+
+void FPuzzleSpatialGrid::Reset()
+{
+    Cells.Empty();
+    Positions.Empty();
+    ItemCells.Empty();
+    ItemSlots.Empty();
+    NumItems = 0;
+}
+
+void FPuzzleSpatialGrid::Update(int32 Item, const FVector2D& Position)
+{
+    const FIntPoint Cell = GetCell(Position);
+    Positions[Item] = Position;
+
+    if (ItemSlots[Item] >= 0)
+    {
+        if (ItemCells[Item] == Cell)
+        {
+            return;
+        }
+        RemoveFromCell(Item);
+    }
+    else
+    {
+        NumItems++;
+    }
+
+    TArray<int32>& CellItems = Cells.FindOrAdd(Cell);
+    ItemCells[Item] = Cell;
+    ItemSlots[Item] = CellItems.Add(Item);
+}
+
+void FPuzzleSpatialGrid::Remove(int32 Item)
+{
+    if (!Contains(Item))
+    {
+        return;
+    }
+
+    RemoveFromCell(Item);
+    ItemSlots[Item] = -1;
+    NumItems--;
+}
+
+void FPuzzleSpatialGrid::RemoveFromCell(int32 Item)
+{
+    TArray<int32>* CellItems = Cells.Find(ItemCells[Item]);
+    check(CellItems);
+
+    // Son öğe boşalan yere taşınır, yeri güncellenir
+    const int32 Slot = ItemSlots[Item];
+    CellItems->RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+    if (CellItems->IsValidIndex(Slot))
+    {
+        ItemSlots[(*CellItems)[Slot]] = Slot;
+    }
+
+    // Boş hücreler tutulmaz - masa sınırsız, dağınık parçalar haritayı şişirmesin
+    if (CellItems->Num() == 0)
+    {
+        Cells.Remove(ItemCells[Item]);
+    }
+}
@@ -0,0 +1,74 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Uniform hash grid over 2D item positions. Cells are keyed by integer coordinates in a
+ * map, so the table is unbounded and only occupied cells cost memory. Each item remembers
+ * its cell and slot, which makes moves and removals O(1) (swap-remove within the cell).
+ * With the cell size set to the query radius a query touches at most 3x3 cells.
+ */
+class PUZZLEGAME_API FPuzzleSpatialGrid
+{
+public:
+    void Init(float InCellSize, int32 MaxItems);
+    void Reset();
+
+    // Yoksa ekler, varsa taşır - hücre değişmezse sadece konum yazılır
+    void Update(int32 Item, const FVector2D& Position);
+    void Remove(int32 Item);
+
+    bool Contains(int32 Item) const { return ItemCells.IsValidIndex(Item) && ItemSlots[Item] >= 0; }
+    const FVector2D& GetPosition(int32 Item) const { return Positions[Item]; }
+    int32 Num() const { return NumItems; }
+    int32 GetNumCells() const { return Cells.Num(); }
+
+    // Merkeze Radius'tan yakın tüm öğeler - Func(Item, Position)
+    template<typename FuncType>
+    void ForEachInRadius(const FVector2D& Center, float Radius, FuncType&& Func) const
+    {
+        const FIntPoint MinCell = GetCell(Center - FVector2D(Radius, Radius));
+        const FIntPoint MaxCell = GetCell(Center + FVector2D(Radius, Radius));
+        const double RadiusSquared = (double)Radius * Radius;
+
+        for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; CellY++)
+        {
+            for (int32 CellX = MinCell.X; CellX <= MaxCell.X; CellX++)
+            {
+                const TArray<int32>* CellItems = Cells.Find(FIntPoint(CellX, CellY));
+                if (!CellItems)
+                {
+                    continue;
+                }
+
+                for (const int32 Item : *CellItems)
+                {
+                    if (FVector2D::DistSquared(Positions[Item], Center) <= RadiusSquared)
+                    {
+                        Func(Item, Positions[Item]);
+                    }
+                }
+            }
+        }
+    }
+
+private:
+    FIntPoint GetCell(const FVector2D& Position) const
+    {
+        return FIntPoint(FMath::FloorToInt32(Position.X * InvCellSize), FMath::FloorToInt32(Position.Y * InvCellSize));
+    }
+
+    void RemoveFromCell(int32 Item);
+
+    float InvCellSize = 1.0f;
+    int32 NumItems = 0;
+
+    TMap<FIntPoint, TArray<int32>> Cells;
+
+    // Öğe başına: konum, hücre ve hücre dizisindeki yeri (-1: yok)
+    TArray<FVector2D> Positions;
+    TArray<FIntPoint> ItemCells;
+    TArray<int32> ItemSlots;
+};
@@ -0,0 +1,196 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "PuzzleSwapDistance.h"
+
+void FPuzzleSwapDistance::Init(int32 NumCells)
+{
+    Next.Init(-1, NumCells);
+    Left.Init(-1, NumCells);
+    Right.Init(-1, NumCells);
+    Parent.Init(-1, NumCells);
+    Sizes.Init(1, NumCells);
+
+    // Deterministik öncelikler - aynı board aynı ağaç şeklini verir
+    Priorities.SetNumUninitialized(NumCells);
+    for (int32 Cell = 0; Cell < NumCells; Cell++)
+    {
+        Priorities[Cell] = FCrc::MemCrc32(&Cell, sizeof(Cell));
+    }
+
+    EdgeCount = 0;
+    CycleCount = 0;
+}
+
+void FPuzzleSwapDistance::OnCellsChanged(TArrayView<const int32> ChangedGridIDs, const TArray<int32>& Occupancy)
+{
+    // Önce tüm eski kenarlar kesilir - aradaki her durum geçerli zincir/döngü kümesidir
+    for (const int32 Cell : ChangedGridIDs)
+    {
+        if (Next[Cell] >= 0 && Next[Cell] != Occupancy[Cell])
+        {
+            Cut(Cell);
+        }
+    }
+
+    for (const int32 Cell : ChangedGridIDs)
+    {
+        const int32 Target = Occupancy[Cell];
+        if (Target >= 0 && Target < Next.Num() && Next[Cell] != Target)
+        {
+            Link(Cell, Target);
+        }
+    }
+}
+
+void FPuzzleSwapDistance::Cut(int32 Cell)
+{
+    const int32 Root = FindRoot(Cell);
+    const bool bIsCycle = Next[Last(Root)] == First(Root);
+
+    int32 Head = INDEX_NONE;
+    int32 Tail = INDEX_NONE;
+    Split(Root, GetIndex(Cell) + 1, Head, Tail);
+
+    if (bIsCycle)
+    {
+        // Döngü açılır: Cell'den sonraki hücreyle başlayıp Cell ile biten tek zincir
+        CycleCount--;
+        const int32 NewRoot = Merge(Tail, Head);
+        Parent[NewRoot] = -1;
+    }
+
+    Next[Cell] = -1;
+    EdgeCount--;
+}
+
+void FPuzzleSwapDistance::Link(int32 From, int32 To)
+{
+    const int32 FromRoot = FindRoot(From);
+    const int32 ToRoot = FindRoot(To);
+
+    if (FromRoot == ToRoot)
+    {
+        // Zincirin sonu başına bağlandı - sıra aynı kalır
+        CycleCount++;
+    }
+    else
+    {
+        const int32 NewRoot = Merge(FromRoot, ToRoot);
+        Parent[NewRoot] = -1;
+    }
+
+    Next[From] = To;
+    EdgeCount++;
+}
+
+void FPuzzleSwapDistance::Update(int32 Node)
+{
+    Sizes[Node] = 1 + Size(Left[Node]) + Size(Right[Node]);
+    if (Left[Node] >= 0)
+    {
+        Parent[Left[Node]] = Node;
+    }
+    if (Right[Node] >= 0)
+    {
+        Parent[Right[Node]] = Node;
+    }
+}
+
+int32 FPuzzleSwapDistance::FindRoot(int32 Node) const
+{
+    while (Parent[Node] >= 0)
+    {
+        Node = Parent[Node];
+    }
+    return Node;
+}
+
+int32 FPuzzleSwapDistance::First(int32 Root) const
+{
+    while (Left[Root] >= 0)
+    {
+        Root = Left[Root];
+    }
+    return Root;
+}
+
+int32 FPuzzleSwapDistance::Last(int32 Root) const
+{
+    while (Right[Root] >= 0)
+    {
+        Root = Right[Root];
+    }
+    return Root;
+}
+
+int32 FPuzzleSwapDistance::GetIndex(int32 Node) const
+{
+    int32 Index = Size(Left[Node]);
+    while (Parent[Node] >= 0)
+    {
+        const int32 ParentNode = Parent[Node];
+        if (Right[ParentNode] == Node)
+        {
+            Index += Size(Left[ParentNode]) + 1;
+        }
+        Node = ParentNode;
+    }
+    return Index;
+}
+
+int32 FPuzzleSwapDistance::Merge(int32 A, int32 B)
+{
+    if (A < 0)
+    {
+        return B;
+    }
+    if (B < 0)
+    {
+        return A;
+    }
+
+    if (Priorities[A] > Priorities[B])
+    {
+        Right[A] = Merge(Right[A], B);
+        Update(A);
+        return A;
+    }
+
+    Left[B] = Merge(A, Left[B]);
+    Update(B);
+    return B;
+}
+
+void FPuzzleSwapDistance::Split(int32 Root, int32 Count, int32& OutLeft, int32& OutRight)
+{
+    if (Root < 0)
+    {
+        OutLeft = -1;
+        OutRight = -1;
+        return;
+    }
+
+    // Yeni kökler dışarıdan Parent -1 ile işaretlenir
+    Parent[Root] = -1;
+
+    if (Size(Left[Root]) >= Count)
+    {
+        int32 SplitLeft = -1;
+        int32 SplitRight = -1;
+        Split(Left[Root], Count, SplitLeft, SplitRight);
+        Left[Root] = SplitRight;
+        Update(Root);
+        OutLeft = SplitLeft;
+        OutRight = Root;
+    }
+    else
+    {
+        int32 SplitLeft = -1;
+        int32 SplitRight = -1;
+        Split(Right[Root], Count - Size(Left[Root]) - 1, SplitLeft, SplitRight);
+        Right[Root] = SplitLeft;
+        Update(Root);
+        OutLeft = Root;
+        OutRight = SplitRight;
+    }
+}
@@ -0,0 +1,59 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Tracks the minimum number of swaps needed to solve the board. Each occupied cell has an
+ * edge to the home cell of its piece, so the board decomposes into cycles and chains that
+ * end in an empty cell. A cycle of k cells needs k-1 swaps and a chain of k edges needs k
+ * moves, which gives MinSwaps = occupied cells - cycles (fixed pieces count as 1-cycles).
+ *
+ * Every cycle/chain is kept as a sequence in an implicit treap, so cutting or linking one
+ * edge and asking whether two cells share a cycle are O(log N) instead of walking cycles
+ * that can be O(N) long on a shuffled board. Pieces still in the tray are not counted.
+ */
+class PUZZLEGAME_API FPuzzleSwapDistance
+{
+public:
+    void Init(int32 NumCells);
+
+    // Değişen hücrelerin kenarlarını kes ve yeniden bağla - O(K log N)
+    void OnCellsChanged(TArrayView<const int32> ChangedGridIDs, const TArray<int32>& Occupancy);
+
+    int32 GetMinSwaps() const { return EdgeCount - CycleCount; }
+
+    int32 GetCycleCount() const { return CycleCount; }
+
+private:
+    // Hücrenin kenarı (Cell -> Next[Cell]) koparılır, zincir/döngü ikiye ayrılır
+    void Cut(int32 Cell);
+
+    // Zincir sonu From'u zincir başı To'ya bağlar, aynı zincirse döngü kapanır
+    void Link(int32 From, int32 To);
+
+    int32 Size(int32 Node) const { return Node >= 0 ? Sizes[Node] : 0; }
+    void Update(int32 Node);
+    int32 FindRoot(int32 Node) const;
+    int32 First(int32 Root) const;
+    int32 Last(int32 Root) const;
+
+    // Sıradaki konumu (0 tabanlı)
+    int32 GetIndex(int32 Node) const;
+
+    int32 Merge(int32 A, int32 B);
+    void Split(int32 Root, int32 Count, int32& OutLeft, int32& OutRight);
+
+    // Hücre -> bir sonraki hücre (parçanın doğru hücresi), -1 boş
+    TArray<int32> Next;
+
+    TArray<int32> Left;
+    TArray<int32> Right;
+    TArray<int32> Parent;
+    TArray<int32> Sizes;
+    TArray<uint32> Priorities;
+
+    int32 EdgeCount = 0;
+    int32 CycleCount = 0;
+};
@@ -0,0 +1,149 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "PuzzleWorkScheduler.h"
+
+uint32 FPuzzleWorkScheduler::Enqueue(FName JobName, EPuzzleWorkPriority Priority, FPuzzleWorkStep Step)
+{
+    if (!Step || Priority >= EPuzzleWorkPriority::Count)
+    {
+        return 0;
+    }
+
+    const uint32 JobID = NextJobID++;
+    Queues[(int32)Priority].Add({ JobID, JobName, MakeShared<FPuzzleWorkStep, ESPMode::NotThreadSafe>(MoveTemp(Step)), FPlatformTime::Seconds() });
+
+    Stats.QueueDepth = GetQueueDepth();
+    Stats.PeakQueueDepth = FMath::Max(Stats.PeakQueueDepth, Stats.QueueDepth);
+    return JobID;
+}
+
+bool FPuzzleWorkScheduler::Cancel(uint32 JobID)
+{
+    for (TArray<FJob>& Queue : Queues)
+    {
+        const int32 Index = Queue.IndexOfByPredicate([JobID](const FJob& Job) { return Job.JobID == JobID; });
+        if (Index != INDEX_NONE)
+        {
+            Queue.RemoveAt(Index);
+            Stats.QueueDepth = GetQueueDepth();
+            return true;
+        }
+    }
+    return false;
+}
+
+int32 FPuzzleWorkScheduler::CancelByName(FName JobName)
+{
+    int32 Removed = 0;
+    for (TArray<FJob>& Queue : Queues)
+    {
+        Removed += Queue.RemoveAll([JobName](const FJob& Job) { return Job.Name == JobName; });
+    }
+    Stats.QueueDepth = GetQueueDepth();
+    return Removed;
+}
+
+bool FPuzzleWorkScheduler::IsQueued(FName JobName) const
+{
+    for (const TArray<FJob>& Queue : Queues)
+    {
+        if (Queue.ContainsByPredicate([JobName](const FJob& Job) { return Job.Name == JobName; }))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+int32 FPuzzleWorkScheduler::GetQueueDepth() const
+{
+    int32 Depth = 0;
+    for (const TArray<FJob>& Queue : Queues)
+    {
+        Depth += Queue.Num();
+    }
+    return Depth;
+}
+
+bool FPuzzleWorkScheduler::RunStep(int32 QueueIndex)
+{
+    // Adım kuyruğu değiştirebilir (yeni iş, iptal) - işi ID ile yeniden bul
+    const uint32 JobID = Queues[QueueIndex][0].JobID;
+    const TSharedRef<FPuzzleWorkStep, ESPMode::NotThreadSafe> Step = Queues[QueueIndex][0].Step;
+    const bool bFinished = (*Step)();
+
+    const int32 Index = Queues[QueueIndex].IndexOfByPredicate([JobID](const FJob& Job) { return Job.JobID == JobID; });
+    if (Index == INDEX_NONE)
+    {
+        return false;
+    }
+
+    if (bFinished)
+    {
+        const double DeferredMs = (FPlatformTime::Seconds() - Queues[QueueIndex][Index].EnqueueTime) * 1000.0;
+        Queues[QueueIndex].RemoveAt(Index);
+
+        Stats.CompletedJobs++;
+        TotalDeferredMs += DeferredMs;
+        Stats.AverageDeferredMs = (float)(TotalDeferredMs / Stats.CompletedJobs);
+        Stats.MaxDeferredMs = FMath::Max(Stats.MaxDeferredMs, (float)DeferredMs);
+        return false;
+    }
+    return true;
+}
+
+void FPuzzleWorkScheduler::RunFrame(float BudgetMs)
+{
+    const double StartTime = FPlatformTime::Seconds();
+    const double BudgetSeconds = BudgetMs / 1000.0;
+    int32 Steps = 0;
+
+    for (;;)
+    {
+        int32 QueueIndex = 0;
+        while (QueueIndex < (int32)EPuzzleWorkPriority::Count && Queues[QueueIndex].Num() == 0)
+        {
+            QueueIndex++;
+        }
+        if (QueueIndex == (int32)EPuzzleWorkPriority::Count)
+        {
+            break;
+        }
+
+        RunStep(QueueIndex);
+        Steps++;
+
+        // En az bir adım her zaman çalışır, sonra bütçe kontrol edilir
+        if (FPlatformTime::Seconds() - StartTime >= BudgetSeconds)
+        {
+            break;
+        }
+    }
+
+    const float ElapsedMs = (float)((FPlatformTime::Seconds() - StartTime) * 1000.0);
+    Stats.StepsLastFrame = Steps;
+    Stats.LastFrameMs = ElapsedMs;
+    Stats.MaxFrameMs = FMath::Max(Stats.MaxFrameMs, ElapsedMs);
+    if (ElapsedMs > BudgetMs)
+    {
+        Stats.FramesOverBudget++;
+    }
+    Stats.QueueDepth = GetQueueDepth();
+}
+
+void FPuzzleWorkScheduler::RunAll()
+{
+    while (GetQueueDepth() > 0)
+    {
+        RunFrame(TNumericLimits<float>::Max());
+    }
+}
+
+void FPuzzleWorkScheduler::Reset()
+{
+    for (TArray<FJob>& Queue : Queues)
+    {
+        Queue.Reset();
+    }
+    Stats.QueueDepth = 0;
+}
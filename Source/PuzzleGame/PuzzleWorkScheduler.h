@@ -0,0 +1,103 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PuzzleWorkScheduler.generated.h"
+
+// Kuyruk önceliği - yüksek öncelikli işler her frame önce çalışır
+enum class EPuzzleWorkPriority : uint8
+{
+    High,
+    Normal,
+    Low,
+    Count
+};
+
+// Bir iş adımı, iş bittiğinde true döner
+using FPuzzleWorkStep = TFunction<bool()>;
+
+USTRUCT(BlueprintType)
+struct PUZZLEGAME_API FPuzzleWorkStats
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Performance")
+    int32 QueueDepth = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Performance")
+    int32 PeakQueueDepth = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Performance")
+    int32 CompletedJobs = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Performance")
+    int32 StepsLastFrame = 0;
+
+    // Son frame'de işlere harcanan süre
+    UPROPERTY(BlueprintReadOnly, Category = "Performance")
+    float LastFrameMs = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Performance")
+    float MaxFrameMs = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Performance")
+    int32 FramesOverBudget = 0;
+
+    // Kuyruğa girişten bitişe geçen süre
+    UPROPERTY(BlueprintReadOnly, Category = "Performance")
+    float AverageDeferredMs = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Performance")
+    float MaxDeferredMs = 0.0f;
+};
+
+/**
+ * Time-sliced job queue for bursty puzzle work. Jobs are split into short steps;
+ * RunFrame executes steps in priority order until the frame's millisecond budget
+ * is used up, always running at least one step so queued work keeps progressing.
+ */
+class PUZZLEGAME_API FPuzzleWorkScheduler
+{
+public:
+    // Aynı isimli işleri iptal etmek için JobName kullanılır
+    uint32 Enqueue(FName JobName, EPuzzleWorkPriority Priority, FPuzzleWorkStep Step);
+
+    bool Cancel(uint32 JobID);
+
+    int32 CancelByName(FName JobName);
+
+    bool IsQueued(FName JobName) const;
+
+    void RunFrame(float BudgetMs);
+
+    // Kalan tüm işleri bütçesiz bitir (EndPlay)
+    void RunAll();
+
+    void Reset();
+
+    int32 GetQueueDepth() const;
+
+    const FPuzzleWorkStats& GetStats() const { return Stats; }
+
+private:
+    struct FJob
+    {
+        uint32 JobID;
+        FName Name;
+        // Paylaşımlı - adım çalışırken kuyruk büyüyüp yer değiştirebilir
+        TSharedRef<FPuzzleWorkStep, ESPMode::NotThreadSafe> Step;
+        double EnqueueTime;
+    };
+
+    // Bir adımı çalıştırır, işin kuyrukta kalıp kalmadığını döner
+    bool RunStep(int32 QueueIndex);
+
+    TArray<FJob> Queues[(int32)EPuzzleWorkPriority::Count];
+
+    uint32 NextJobID = 1;
+
+    double TotalDeferredMs = 0.0;
+
+    FPuzzleWorkStats Stats;
+};
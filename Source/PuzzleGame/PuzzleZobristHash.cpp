@@ -0,0 +1,13 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "PuzzleZobristHash.h"
+
+uint64 FPuzzleZobristHash::Compute(TArrayView<const int32> Occupancy)
+{
+    uint64 Result = 0;
+    for (int32 GridID = 0; GridID < Occupancy.Num(); GridID++)
+    {
+        Result ^= GetKey(GridID, Occupancy[GridID]);
+    }
+    return Result;
+}
@@ -0,0 +1,50 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * 64-bit Zobrist hash of a board arrangement: the XOR of one key per (cell, piece) pair
+ * currently on the board. Empty cells contribute nothing, so a cleared board hashes to 0
+ * and every occupancy write is a two-key XOR.
+ *
+ * Keys are derived from (GridID, PieceID) with a SplitMix64 finalizer instead of being
+ * stored, since a table would need NumCells^2 entries. The same arrangement always
+ * hashes to the same value across sessions and machines, so hashes can be stored in
+ * replays and telemetry.
+ */
+class PUZZLEGAME_API FPuzzleZobristHash
+{
+public:
+    static uint64 GetKey(int32 GridID, int32 PieceID)
+    {
+        if (PieceID < 0)
+        {
+            return 0;
+        }
+
+        uint64 Z = (((uint64)(uint32)GridID << 32) | (uint32)PieceID) + KeySeed;
+        Z = (Z ^ (Z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        Z = (Z ^ (Z >> 27)) * 0x94D049BB133111EBull;
+        return Z ^ (Z >> 31);
+    }
+
+    // Tam hesap - O(N)
+    static uint64 Compute(TArrayView<const int32> Occupancy);
+
+    void Reset() { Hash = 0; }
+    void Reset(TArrayView<const int32> Occupancy) { Hash = Compute(Occupancy); }
+
+    void OnCellChanged(int32 GridID, int32 OldPieceID, int32 NewPieceID)
+    {
+        Hash ^= GetKey(GridID, OldPieceID) ^ GetKey(GridID, NewPieceID);
+    }
+
+    uint64 Get() const { return Hash; }
+
+private:
+    static constexpr uint64 KeySeed = 0x9E3779B97F4A7C15ull;
+
+    uint64 Hash = 0;
+};